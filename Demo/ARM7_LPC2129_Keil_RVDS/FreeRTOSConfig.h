@@ -65,8 +65,16 @@
 #define configQUEUE_REGISTRY_SIZE 	0
 /**********************EDF***************************************/
 #define configUSE_EDF_SCHEDULER		      	  1
+#define configUSE_EDF_BANDWIDTH_SERVER		  1
+#define configUSE_EDF_TASK_STATISTICS		  1
 #define configUSE_APPLICATION_TASK_TAG			1
 
+/* The CPU load is measured by the kernel over windows of
+configEDF_UTILISATION_WINDOW_TICKS ticks.  Timer 1 counts the CPU clock divided
+by its prescaler of 1000 + 1, which is 59.94 counts a tick, rounded to 60. */
+#define configUSE_EDF_UTILISATION_MONITOR	1
+#define configEDF_RUN_TIME_COUNTS_PER_TICK	( ( ( configCPU_CLOCK_HZ / 1001UL ) + ( configTICK_RATE_HZ / 2U ) ) / configTICK_RATE_HZ )
+
 
 /**********************************************************************/
 /* Co-routine definitions. */
@@ -83,6 +91,7 @@ to exclude the API function. */
 #define INCLUDE_vTaskSuspend			1
 #define INCLUDE_vTaskDelayUntil			1
 #define INCLUDE_vTaskDelay				1
+#define INCLUDE_xTaskGetIdleTaskHandle	1
 
 
 #define configUSE_STATS_FORMATTING_FUNCTIONS  1
@@ -92,84 +101,39 @@ to exclude the API function. */
 
 
 /**********************************Trace Macros**************************************************************/
-#define traceTASK_SWITCHED_IN(){																																					\
-																	if( PIN2 == (int)pxCurrentTCB->pxTaskTag )  														\
-																	{																																				\
-																		gl_u32_T1_In_Time = T1TC;																										\
-																	}																																				\
-																	else if( PIN3 == (int)pxCurrentTCB->pxTaskTag )													\
-																	{																																				\
-																		gl_u32_T2_In_Time = T1TC;																										\
-																	}																																				\
-																	else if( PIN4 == (int)pxCurrentTCB->pxTaskTag )													\
-																	{																																				\
-																		gl_u32_T3_In_Time = T1TC;																										\
-																	}																																				\
-																	else if( PIN5 == (int)pxCurrentTCB->pxTaskTag )													\
-																	{																																				\
-																		gl_u32_T4_In_Time = T1TC;																										\
-																	}																																				\
-																	else if( PIN6 == (int)pxCurrentTCB->pxTaskTag )													\
-																	{																																				\
-																		gl_u32_T5_In_Time = T1TC;																										\
-																	}																																				\
-																	else if( PIN7 == (int)pxCurrentTCB->pxTaskTag )													\
-																	{																																				\
-																		gl_u32_T6_In_Time = T1TC;																										\
-																	}																																				\
-																	else{}																																	\
-																	GPIO_write(PORT_0, (int)pxCurrentTCB->pxTaskTag, PIN_IS_HIGH );					\
-																}																																					\
-
-																
-#define traceTASK_SWITCHED_OUT(){																																					\
-																	if( PIN2 == (int)pxCurrentTCB->pxTaskTag )  														\
-																	{																																				\
-																		gl_u32_T1_Out_Time = T1TC;																										\
-																		gl_u32_T1_Total_Time += gl_u32_T1_Out_Time - gl_u32_T1_In_Time;														\
-																		gl_u32_T1_Execution_Time = gl_u32_T1_Out_Time - gl_u32_T1_In_Time ;										    \
-																	}																																				\
-																	else if( PIN3 == (int)pxCurrentTCB->pxTaskTag )													\
-																	{																																				\
-																		gl_u32_T2_Out_Time = T1TC;																										\
-																		gl_u32_T2_Total_Time += gl_u32_T2_Out_Time - gl_u32_T2_In_Time;														\
-																		gl_u32_T2_Execution_Time = gl_u32_T2_Out_Time - gl_u32_T2_In_Time ;										    \
-																	}																																				\
-																	else if( PIN4 == (int)pxCurrentTCB->pxTaskTag )													\
-																	{																																				\
-																		gl_u32_T3_Out_Time = T1TC;																										\
-																		gl_u32_T3_Total_Time += gl_u32_T3_Out_Time - gl_u32_T3_In_Time;														\
-																		gl_u32_T3_Execution_Time = gl_u32_T3_Out_Time - gl_u32_T3_In_Time ;                         \
-																	}																																				\
-																	else if( PIN5 == (int)pxCurrentTCB->pxTaskTag )													\
-																	{																																				\
-																		gl_u32_T4_Out_Time = T1TC;																										\
-																		gl_u32_T4_Total_Time += gl_u32_T4_Out_Time - gl_u32_T4_In_Time;														\
-																	 gl_u32_T4_Execution_Time = gl_u32_T4_Out_Time - gl_u32_T4_In_Time ;                         \
-																	}																																				\
-																	else if( PIN6 == (int)pxCurrentTCB->pxTaskTag )													\
-																	{																																				\
-																		gl_u32_T5_Out_Time = T1TC;																										\
-																		gl_u32_T5_Total_Time += gl_u32_T5_Out_Time - gl_u32_T5_In_Time;														\
-																		gl_u32_T5_Execution_Time = gl_u32_T5_Out_Time - gl_u32_T5_In_Time ;                         \
-																	}																																				\
-																	else if( PIN7 == (int)pxCurrentTCB->pxTaskTag )													\
-																	{																																				\
-																		gl_u32_T6_Out_Time = T1TC;																										\
-																		gl_u32_T6_Total_Time += gl_u32_T6_Out_Time - gl_u32_T6_In_Time;														\
-																    gl_u32_T6_Execution_Time = gl_u32_T6_Out_Time - gl_u32_T6_In_Time ;                         \
-																	}																																				\
-																	else{}																																	\
-																	GPIO_write(PORT_0, (int)pxCurrentTCB->pxTaskTag, PIN_IS_LOW );					\
-																																																					\
-																}																																					\
-
-extern uint32_t gl_u32_T1_In_Time , gl_u32_T1_Out_Time , gl_u32_T1_Total_Time ,gl_u32_T1_Execution_Time;
-extern uint32_t gl_u32_T2_In_Time , gl_u32_T2_Out_Time , gl_u32_T2_Total_Time ,gl_u32_T2_Execution_Time;
-extern uint32_t gl_u32_T3_In_Time , gl_u32_T3_Out_Time , gl_u32_T3_Total_Time ,gl_u32_T3_Execution_Time;
-extern uint32_t gl_u32_T4_In_Time , gl_u32_T4_Out_Time , gl_u32_T4_Total_Time ,gl_u32_T4_Execution_Time;
-extern uint32_t gl_u32_T5_In_Time , gl_u32_T5_Out_Time , gl_u32_T5_Total_Time ,gl_u32_T5_Execution_Time;
-extern uint32_t gl_u32_T6_In_Time , gl_u32_T6_Out_Time , gl_u32_T6_Total_Time ,gl_u32_T6_Execution_Time;
+/* Each task drives the GPIO pin of its tag while it runs.  The execution time
+of each task is measured by the kernel with the run time stats counter, and
+the job statistics by configUSE_EDF_TASK_STATISTICS. */
+#define traceTASK_SWITCHED_OUT()	GPIO_write( PORT_0, ( int ) pxCurrentTCB->pxTaskTag, PIN_IS_LOW )
+
+/* Set to 1 to also record the scheduling events in the binary recorder of the
+kernel, see recorder.h.  The recording is read out of RAM with the debugger
+from the address pvRecorderGetRecording() returns, for the length it returns,
+and decoded on the host.  RAM is short, so the buffer only holds the last few
+hundred milliseconds of scheduling. */
+#define configUSE_RECORDER			0
+
+#if( configUSE_RECORDER == 1 )
+	/* Timer 1 counts the peripheral clock, which is the CPU clock, divided by
+	its prescaler of 1000 + 1. */
+	#define configRECORDER_TIMESTAMP_HZ		( configCPU_CLOCK_HZ / 1001UL )
+	#define configRECORDER_BUFFER_LENGTH	( 128 )
+	#define configRECORDER_MAX_TASKS		( 8 )
+
+	/* The port does not nest interrupts, so the records are written with IRQ
+	disabled, and IRQ is only enabled again if it was enabled before. */
+	#define configRECORDER_SET_INTERRUPT_MASK()			( ( UBaseType_t ) __disable_irq() )
+	#define configRECORDER_CLEAR_INTERRUPT_MASK( x )	do { if( ( x ) == 0U ) { __enable_irq(); } } while( 0 )
+
+	#define traceTASK_SWITCHED_IN()												\
+		do																		\
+		{																		\
+			GPIO_write( PORT_0, ( int ) pxCurrentTCB->pxTaskTag, PIN_IS_HIGH );	\
+			recorderTASK_SWITCHED_IN();											\
+		} while( 0 )
+#else
+	#define traceTASK_SWITCHED_IN()		GPIO_write( PORT_0, ( int ) pxCurrentTCB->pxTaskTag, PIN_IS_HIGH )
+#endif
 
 
 /*****************************************************************************/
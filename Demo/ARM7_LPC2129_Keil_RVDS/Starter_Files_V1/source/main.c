@@ -111,6 +111,8 @@ static void prvSetupHardware( void );
 #define LOAD1_PRIODICITY    10  
 #define LOAD2_PRIODICITY    100
 #define TASKS_PRIORITY      2
+/* Uart_Receiver runs for at most UART_BUDGET ticks in every UART_PRIODICITY */
+#define UART_BUDGET         2
 
 /* Tasks Tags */
 #define BTN1_TAG    PIN2
@@ -146,15 +148,9 @@ TaskHandle_t Load_2_Simulation_Handler = NULL;
 xQueueHandle gl_queue_handle;
 
 /* Global Variables */
-/* Run-Time stats varibales */
-uint32_t gl_u32_T1_In_Time , gl_u32_T1_Out_Time , gl_u32_T1_Total_Time ,gl_u32_T1_Execution_Time;
-uint32_t gl_u32_T2_In_Time , gl_u32_T2_Out_Time , gl_u32_T2_Total_Time ,gl_u32_T2_Execution_Time;
-uint32_t gl_u32_T3_In_Time , gl_u32_T3_Out_Time , gl_u32_T3_Total_Time ,gl_u32_T3_Execution_Time;
-uint32_t gl_u32_T4_In_Time , gl_u32_T4_Out_Time , gl_u32_T4_Total_Time ,gl_u32_T4_Execution_Time;
-uint32_t gl_u32_T5_In_Time , gl_u32_T5_Out_Time , gl_u32_T5_Total_Time ,gl_u32_T5_Execution_Time;
-uint32_t gl_u32_T6_In_Time , gl_u32_T6_Out_Time , gl_u32_T6_Total_Time ,gl_u32_T6_Execution_Time;
-uint32_t gl_u32_currentTickSystem = ZERO_INIT ;
+/* The CPU load and the peak of its moving average in percent, read from the kernel utilisation monitor */
 uint32_t gl_u32_CPU_LOAD = ZERO_INIT ;
+uint32_t gl_u32_CPU_LOAD_PEAK = ZERO_INIT ;
 
 uint8_t gl_ch_buffer[Buffer_Size]={ZERO_INIT};
 /**********************************************/
@@ -172,13 +168,9 @@ void Button_1_Monitor (void * pvParameters)
 	const char* lc_ptr_ch_button_1_rising= "Button_1_RISING \n";
 	const char* lc_ptr_ch_button_1_falling= "Button_1_FALLING\n";
 		
-	TickType_t xLastWakeTime;
-	const TickType_t xFrequency = BTN1_PRIODICITY;
 	
 	vTaskSetApplicationTaskTag( NULL, (void*) BTN1_TAG);
 	
-	/* init the xLastWakeTime with the current time */
-	xLastWakeTime = xTaskGetTickCount();
 	
 	for( ;; )
 	{
@@ -196,7 +188,7 @@ void Button_1_Monitor (void * pvParameters)
 					
           lc_u8_button_pressed=RELEASED;
 				}	
-				vTaskDelayUntil(&xLastWakeTime, xFrequency);
+				xTaskJobComplete();
 	}
 }
 
@@ -211,13 +203,9 @@ void Button_2_Monitor (void * pvParameters)
 	const char* lc_ptr_ch_button_1_rising= "Button_2_RISING \n";
 	const char* lc_ptr_ch_button_1_falling= "Button_2_FALLING\n";
 	
-	TickType_t xLastWakeTime;
-	const TickType_t xFrequency = BTN2_PRIODICITY;
 	vTaskSetApplicationTaskTag( NULL, (void*) BTN2_TAG);
 
 	
- /* init the xLastWakeTime with the current time */
-	xLastWakeTime = xTaskGetTickCount();
 	for( ;; )
 	{		
     /* Task Code*/
@@ -234,7 +222,7 @@ void Button_2_Monitor (void * pvParameters)
 					
            lc_u8_button_pressed=RELEASED;
 				}				
-					vTaskDelayUntil(&xLastWakeTime, xFrequency);
+					xTaskJobComplete();
 	}
 }
 
@@ -244,19 +232,15 @@ void Periodic_Transmitter (void * pvParameters)
 	/* local variables */
 	const char* lc_ptr_ch_send_string= "periodic string \n";
 	
-	TickType_t xLastWakeTime;
-	const TickType_t xFrequency = TR_PRIODICITY;
 	
 	vTaskSetApplicationTaskTag( NULL, (void*) TR_TAG);
 	
-	/* init the xLastWakeTime with the current time */
-	xLastWakeTime = xTaskGetTickCount();
 	for( ;; )
 	{
 		/* Task Code*/
     xQueueSend(gl_queue_handle,&lc_ptr_ch_send_string,portMAX_DELAY);
 
-		vTaskDelayUntil(&xLastWakeTime, xFrequency);
+		xTaskJobComplete();
 	}	
 }
 
@@ -266,20 +250,15 @@ void Uart_Receiver (void * pvParameters)
 	/* local variables */
 	const char* lc_ptr_ch_receive_string;
 			
-	TickType_t xLastWakeTime;
-	const TickType_t xFrequency = UART_PRIODICITY;
 	vTaskSetApplicationTaskTag( NULL, (void*) UART_TAG);
 	
-	/* init the xLastWakeTime with the current time */
-	xLastWakeTime = xTaskGetTickCount();
 	for( ;; )
 	{	
-		/* Task Code*/
-		if (xQueueReceive(gl_queue_handle,&lc_ptr_ch_receive_string,0) == pdPASS )
+		/* Task Code: wait for a string rather than polling the queue, the server gives the task its deadlines */
+		if (xQueueReceive(gl_queue_handle,&lc_ptr_ch_receive_string,portMAX_DELAY) == pdPASS )
 		{
 		vSerialPutString((const signed char*)lc_ptr_ch_receive_string,STRING_SIZE);
 		}	
-		vTaskDelayUntil(&xLastWakeTime, xFrequency);
 	}
 }
 
@@ -290,13 +269,9 @@ void Load_1_Simulation (void * pvParameters)
 	
 	uint32_t gl_u32_counter= ZERO_INIT; 
 	
-	TickType_t xLastWakeTime;
-  const TickType_t xFrequency = LOAD1_PRIODICITY;
 	
 	vTaskSetApplicationTaskTag( NULL, (void*) LOAD1_TAG);
 	
-	/* init the xLastWakeTime with the current time */
-	xLastWakeTime = xTaskGetTickCount();
 	for( ;; )
 	{  
 				/* Task Code*/
@@ -304,10 +279,31 @@ void Load_1_Simulation (void * pvParameters)
 		{
 			;
 		}
-			vTaskDelayUntil(&xLastWakeTime, xFrequency);
+			xTaskJobComplete();
 	}
 }
 
+#if (PRINT_TASK_STATUS_SUMMERY==ENABLE_DEPUG_FEATURE)
+/* Print the job statistics the kernel keeps for a periodic task: jobs released, completed and missed,
+   the longest response time in ticks and the longest execution time in timer 1 counts */
+static void printJobStatistics(TaskHandle_t xTask)
+{
+	TaskJobStatistics_t lc_job_statistics;
+	
+	vTaskGetJobStatistics(xTask, &lc_job_statistics);
+	
+	snprintf((char*)gl_ch_buffer, Buffer_Size, "%s %lu %lu %lu %lu %lu\n",
+	         pcTaskGetName(xTask),
+	         (unsigned long)lc_job_statistics.ulJobsReleased,
+	         (unsigned long)lc_job_statistics.ulJobsCompleted,
+	         (unsigned long)lc_job_statistics.ulDeadlinesMissed,
+	         (unsigned long)lc_job_statistics.xMaxResponseTime,
+	         (unsigned long)lc_job_statistics.ulMaxExecutionTime);
+	
+	vSerialPutString((const signed char*)gl_ch_buffer,Buffer_Size);
+}
+#endif
+
 /* this task to create empty loop that loops X times to be with Execution time= 12ms */
 void Load_2_Simulation (void * pvParameters)
 {	
@@ -315,13 +311,9 @@ void Load_2_Simulation (void * pvParameters)
 	
 	uint32_t gl_u32_counter= ZERO_INIT; 
 	 
-	TickType_t xLastWakeTime;
-	const TickType_t xFrequency = LOAD2_PRIODICITY;
 	
 	vTaskSetApplicationTaskTag( NULL, (void*) LOAD2_TAG);
 	
-	/* init the xLastWakeTime with the current time */
-	xLastWakeTime = xTaskGetTickCount();
 	
 	for( ;; )
 	{  
@@ -339,9 +331,15 @@ void Load_2_Simulation (void * pvParameters)
 	  vSerialPutString((const signed char*)gl_ch_buffer,Buffer_Size);
 	
 	  xSerialPutChar('\n');
+	
+	  printJobStatistics(Load_1_Simulation_Handler);
+	  printJobStatistics(Load_2_Simulation_Handler);
+	  printJobStatistics(Button_1_Monitor_Handler);
+	  printJobStatistics(Button_2_Monitor_Handler);
+	  printJobStatistics(Periodic_Transmitter_Handler);
 	#endif
 
-	vTaskDelayUntil(&xLastWakeTime, xFrequency);
+	xTaskJobComplete();
 	}
 }
 
@@ -350,22 +348,31 @@ void vApplicationTickHook (void)
 {
 	GPIO_write(TICK_TAG_PORT,TICK_TAG,PIN_IS_HIGH);
 	GPIO_write(TICK_TAG_PORT,TICK_TAG,PIN_IS_LOW);
-	
-	gl_u32_currentTickSystem = T1TC ;
-	gl_u32_CPU_LOAD = (float)(gl_u32_T1_Total_Time+gl_u32_T2_Total_Time+gl_u32_T3_Total_Time +gl_u32_T4_Total_Time +gl_u32_T5_Total_Time +gl_u32_T6_Total_Time)/(float) gl_u32_currentTickSystem *PERCENTAGE;
 }
 
 /* Application idle hook callout */
 void vApplicationIdleHook (void)
 {
 	static uint8_t S_U8_LV_TagInit=ZERO_INIT;
+	static TickType_t S_LV_LastLoadTick=ZERO_INIT;
+	TaskUtilisation_t lc_utilisation;
 	
 	if(S_U8_LV_TagInit	==	ZERO_INIT)
 	{
 		vTaskSetApplicationTaskTag( NULL, (void*) IDLE_TAG);
 		S_U8_LV_TagInit=ONE_INIT;
 	}
+	
+	/* The kernel measures the CPU load, without the idle task, in fixed point. It only changes
+	   at the end of each window, so it is only read once a window */
+	if((xTaskGetTickCount() - S_LV_LastLoadTick) >= configEDF_UTILISATION_WINDOW_TICKS)
+	{
+		S_LV_LastLoadTick = xTaskGetTickCount();
+		vTaskGetSystemUtilisation(&lc_utilisation);
+		gl_u32_CPU_LOAD = (lc_utilisation.ulUtilisation * PERCENTAGE) / tskEDF_FULL_UTILISATION;
+		gl_u32_CPU_LOAD_PEAK = (lc_utilisation.ulPeakUtilisation * PERCENTAGE) / tskEDF_FULL_UTILISATION;
 	}
+}
 	
 
 /*****************************************************************/
@@ -433,15 +440,16 @@ gl_queue_handle = xQueueCreate(QUEUE_MAX, sizeof(const char*));
 							 BTN2_PRIODICITY                      /*used to pass task periodicity */
 );
 
-/* create Uart_Receiver */  
-	xTaskPeriodicCreate(
+/* create Uart_Receiver as a bandwidth server */  
+	xTaskServerCreate(
                Uart_Receiver,                 /* function that implements the task */
 	             "Uart_Receiver",                /* task's name */
 	             configMINIMAL_STACK_SIZE, /* stack size in words */
 	             (void *) NULL,           /* parameter passed to the task */
 		           TASKS_PRIORITY,                      /* task's priority */
 		           &Uart_Receiver_Handler,    /* task's handler */
-							 UART_PRIODICITY                     /*used to pass task periodicity */
+							 UART_BUDGET,                     /*used to pass server budget */
+							 UART_PRIODICITY                     /*used to pass server period */
 );
 /* create Periodic_Transmitter */
 	xTaskPeriodicCreate(
@@ -0,0 +1,228 @@
+/*
+ * FreeRTOS Kernel V10.3.0
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+/*-----------------------------------------------------------
+ * Application specific definitions.
+ *
+ * These definitions should be adjusted for your particular hardware and
+ * application requirements.
+ *
+ * THESE PARAMETERS ARE DESCRIBED WITHIN THE 'CONFIGURATION' SECTION OF THE
+ * FreeRTOS API DOCUMENTATION AVAILABLE ON THE FreeRTOS.org WEB SITE.
+ *
+ * See http://www.freertos.org/a00110.html
+ *
+ * The settings follow Demo/ARM7_LPC2129_Keil_RVDS/FreeRTOSConfig.h so the EDF
+ * kernel behaves on the host as it does on the target.  Each task is a pthread,
+ * so the minimal stack size must be at least PTHREAD_STACK_MIN bytes.
+ *----------------------------------------------------------*/
+
+#define configUSE_PREEMPTION		1
+#define configUSE_IDLE_HOOK			1
+#define configUSE_TICK_HOOK			1
+#define configTICK_RATE_HZ			( ( TickType_t ) 1000 )
+#define configMAX_PRIORITIES		( 4 )
+#define configMINIMAL_STACK_SIZE	( ( unsigned short ) 4096 )
+#define configTOTAL_HEAP_SIZE		( ( size_t ) 0 ) /* heap_3.c uses the C library heap. */
+#define configMAX_TASK_NAME_LEN		( 24 )
+#define configUSE_TRACE_FACILITY	1
+#ifndef configUSE_16_BIT_TICKS
+	#define configUSE_16_BIT_TICKS	0	/* Set from the make command line with "make TICK_BITS=16". */
+#endif
+#define configIDLE_SHOULD_YIELD		1
+
+/* The idle task is created from the heap unless this is set to 1, for example
+with "make CFLAGS_EXTRA=-DconfigSUPPORT_STATIC_ALLOCATION=1". */
+#ifndef configSUPPORT_STATIC_ALLOCATION
+	#define configSUPPORT_STATIC_ALLOCATION	0
+#endif
+
+#define configUSE_APPLICATION_TASK_TAG	1
+#define configUSE_TIME_SLICING		1
+#define configQUEUE_REGISTRY_SIZE	0
+
+/**********************EDF***************************************/
+#define configUSE_EDF_SCHEDULER		1
+
+/* Refuse periodic tasks that would make the task set unschedulable.  Can be
+turned off from the make command line with
+"make CFLAGS_EXTRA=-DconfigUSE_EDF_ADMISSION_CONTROL=0". */
+#ifndef configUSE_EDF_ADMISSION_CONTROL
+	#define configUSE_EDF_ADMISSION_CONTROL	1
+#endif
+
+/* Count the jobs that miss their deadlines or exceed their execution time
+budgets, measured with the run time stats counter below. */
+#define configUSE_EDF_OVERRUN_HANDLING		1
+#define configEDF_RUN_TIME_COUNTS_PER_TICK	( 1000000UL / configTICK_RATE_HZ )
+
+/* Run the UART receiver of the demo as a constant bandwidth server. */
+#define configUSE_EDF_BANDWIDTH_SERVER		1
+
+/* Release the jobs of the button monitors of the demo from the tick hook
+rather than polling the buttons. */
+#define configUSE_EDF_SPORADIC_TASKS		1
+#define configUSE_TASK_NOTIFICATIONS		1
+
+/* Schedule the tasks of priority above configEDF_MAX_PRIORITY by fixed
+priority, ahead of the EDF tasks.  Can be turned on with
+"make CFLAGS_EXTRA=-DconfigUSE_EDF_HYBRID_SCHEDULING=1", which adds a deferred
+interrupt handler to the demo. */
+#ifndef configUSE_EDF_HYBRID_SCHEDULING
+	#define configUSE_EDF_HYBRID_SCHEDULING	0
+#endif
+#define configEDF_MAX_PRIORITY				( configMAX_PRIORITIES - 2 )
+
+/* Keep statistics of the jobs of each periodic task, including a histogram of
+their response times in bins of 5 ticks. */
+#ifndef configUSE_EDF_TASK_STATISTICS
+	#define configUSE_EDF_TASK_STATISTICS	1
+#endif
+#define configEDF_RESPONSE_TIME_HISTOGRAM_BINS	( 10 )
+#define configEDF_RESPONSE_TIME_HISTOGRAM_WIDTH	( 5 )
+
+/* Measure the utilisation of each task, and of the processor, over windows of
+100 ticks. */
+#ifndef configUSE_EDF_UTILISATION_MONITOR
+	#define configUSE_EDF_UTILISATION_MONITOR	1
+#endif
+#define configEDF_UTILISATION_WINDOW_TICKS	( 100 )
+
+/* Allow the timing of the tasks to be changed while they run.  Can be turned
+on with "make CFLAGS_EXTRA=-DconfigUSE_EDF_MODE_CHANGE=1", which moves the
+demo through a transient mode. */
+#ifndef configUSE_EDF_MODE_CHANGE
+	#define configUSE_EDF_MODE_CHANGE		0
+#endif
+
+/* Run a software timer and pended function calls in the demo.  Can be turned
+on with "make CFLAGS_EXTRA=-DconfigUSE_TIMERS=1".  The timer service task is a
+constant bandwidth server with a budget of one tick in every 60, or with hybrid
+scheduling a task of the fixed priority band. */
+#ifndef configUSE_TIMERS
+	#define configUSE_TIMERS				0
+#endif
+#define configTIMER_QUEUE_LENGTH			( 10 )
+#define configTIMER_TASK_STACK_DEPTH		configMINIMAL_STACK_SIZE
+#if ( configUSE_EDF_HYBRID_SCHEDULING == 1 )
+	#define configTIMER_TASK_PRIORITY		( configMAX_PRIORITIES - 1 )
+#else
+	#define configTIMER_TASK_PRIORITY		( tskIDLE_PRIORITY + 2 )
+	#ifndef configTIMER_TASK_BUDGET
+		#define configTIMER_TASK_BUDGET		( ( TickType_t ) 1 )
+	#endif
+	#ifndef configTIMER_TASK_PERIOD
+		#define configTIMER_TASK_PERIOD		( ( TickType_t ) 60 )
+	#endif
+#endif
+
+/* The load tasks of the demo share a mutex, the holder of which inherits the
+deadline of a task blocked on it. */
+#define configUSE_MUTEXES					1
+
+/* Suppress the tick while the idle task runs.  Can be turned on from the make
+command line with "make CFLAGS_EXTRA=-DconfigUSE_TICKLESS_IDLE=1".  The buttons
+of the demo are sampled from the tick hook, which is not called for suppressed
+ticks, so each idle period ends no later than the next edge of a button. */
+#ifndef configUSE_TICKLESS_IDLE
+	#define configUSE_TICKLESS_IDLE			0
+#endif
+
+/* Only take the tick interrupt when an event is due, whichever task is running.
+Can be turned on with "make CFLAGS_EXTRA=-DconfigUSE_EVENT_DRIVEN_TICK=1".  The
+edges of the buttons are events too, for the same reason as above. */
+#ifndef configUSE_EVENT_DRIVEN_TICK
+	#define configUSE_EVENT_DRIVEN_TICK		0
+#endif
+
+/* Set to 1 by the makefile when the application is main_edf(), the buttons of
+which end each idle period, as above.  main_edf() is also the application run
+when none is selected. */
+#ifndef mainEDF_DEMO_SELECTED
+	#define mainEDF_DEMO_SELECTED			1
+#endif
+
+#if( mainEDF_DEMO_SELECTED == 1 )
+	extern unsigned long ulEDFDemoLimitIdleTime( unsigned long ulExpectedIdleTime );
+	#define configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING( x ) ( x ) = ( TickType_t ) ulEDFDemoLimitIdleTime( ( unsigned long ) ( x ) )
+#endif
+
+/**********************************************************************/
+/* Co-routine definitions. */
+#define configUSE_CO_ROUTINES 		0
+#define configMAX_CO_ROUTINE_PRIORITIES ( 2 )
+
+/* Set the following definitions to 1 to include the API function, or zero
+to exclude the API function. */
+
+#define INCLUDE_vTaskPrioritySet		1
+#define INCLUDE_uxTaskPriorityGet		1
+#define INCLUDE_vTaskDelete				1
+#define INCLUDE_vTaskCleanUpResources	0
+#define INCLUDE_vTaskSuspend			1
+#define INCLUDE_vTaskDelayUntil			1
+#define INCLUDE_vTaskDelay				1
+#define INCLUDE_xTimerPendFunctionCall	configUSE_TIMERS
+
+/* Run time stats use the microsecond counter provided by the port. */
+#define configUSE_STATS_FORMATTING_FUNCTIONS	1
+#define configGENERATE_RUN_TIME_STATS	1
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+#define portGET_RUN_TIME_COUNTER_VALUE()	ulPortGetRunTimeCounterValue()
+
+/* Set to 1 to run the simulation in virtual time, see portmacro.h.  Set from
+the make command line with "make VIRTUAL_TIME=1". */
+#ifndef configUSE_VIRTUAL_TIME
+	#define configUSE_VIRTUAL_TIME		0
+#endif
+
+/* Record the scheduling events in the binary recorder of the kernel, see
+recorder.h, which defines the trace macros not defined here.  The run time
+counter counts microseconds in both real and virtual time. */
+#define configUSE_RECORDER				1
+#define configRECORDER_TIMESTAMP_HZ		( 1000000UL )
+#define configRECORDER_BUFFER_LENGTH	( 1UL << 17 )
+#define configRECORDER_MAX_TASKS		( 64 )
+
+/* Also record every context switch so the scheduling decisions can be written
+to a trace file, see trace.h. */
+extern void vTraceTaskSwitchedIn( void *pvTask, unsigned long ulTickCount, unsigned long ulDeadline );
+#define traceTASK_SWITCHED_IN()																										\
+	do																																\
+	{																																\
+		vTraceTaskSwitchedIn( pxCurrentTCB, ( unsigned long ) xTickCount, ( unsigned long ) listGET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ) ) );	\
+		recorderTASK_SWITCHED_IN();																									\
+	} while( 0 )
+
+/* Stop the simulation, reporting the file and line, if an assert fails. */
+extern void vAssertCalled( const char * const pcFileName, unsigned long ulLine );
+#define configASSERT( x ) if( ( x ) == 0 ) vAssertCalled( __FILE__, __LINE__ )
+
+#endif /* FREERTOS_CONFIG_H */
@@ -0,0 +1,1157 @@
+/*
+ * FreeRTOS Kernel V10.3.0
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/******************************************************************************
+ * Decodes a recording of the kernel recorder, as returned by
+ * pvRecorderGetRecording(), see recorder.h.  Runs on the host rather than
+ * under the scheduler:
+ *
+ *   decoder [-f report|gantt|vcd|json] [-o file] [-s start] [-n columns]
+ *           [-t width] recording
+ *
+ * report (the default) prints, for each task, the number of times it was
+ * switched in and the time it ran for, then the jobs released, completed and
+ * aborted, the deadlines missed, the overruns reported by the kernel and the
+ * response times and lateness of the completed jobs, in ticks.  A job is
+ * completed late if it completes after its deadline, and aborted if the next
+ * job of its task is released first.  The operations on each queue and the
+ * time spent in the tick interrupt follow.
+ *
+ * gantt prints a chart with a row for each task and a column for each width
+ * counts of the run time counter, one tick by default, starting start columns
+ * into the recording.  A column holds '#' if the task ran in it, '-' if the
+ * task had a job released that it did not run in it, and '!' if a job missed
+ * its deadline in it.
+ *
+ * vcd writes a value change dump with a wire for each task that is high while
+ * it runs, a wire for each task that is high while it has a job released, an
+ * event for each deadline miss and a wire that is high in the tick interrupt.
+ *
+ * json writes a trace in the Chrome trace event format, which can be opened in
+ * chrome://tracing or Perfetto, with the tasks and the interrupt on the CPU
+ * and the jobs of each task underneath.
+ *
+ * The decoder must be run on a host of the same byte order as the target.
+ ******************************************************************************/
+
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+
+/* Kernel includes. */
+#include "recorder.h"
+
+/* The number of tasks that are told apart.  The task numbers in the records
+are mapped onto slots in the order the tasks are first seen, slot 0 being task
+number 0, and further tasks are counted together in the last slot. */
+#define decoderMAX_TASKS			( 256 )
+
+/* The number of queues that are told apart.  Further queues are counted
+together with the last. */
+#define decoderMAX_QUEUES			( 32 )
+
+/*-----------------------------------------------------------*/
+
+/* A record with its time since the start of the recording. */
+typedef struct DECODED_EVENT
+{
+	uint64_t ullTime;
+	uint8_t ucEvent;
+	uint32_t ulTask;				/*< The slot of the task in xTasks. */
+	uint32_t ulParam;
+} Event_t;
+
+/* What is known of a task. */
+typedef struct DECODED_TASK
+{
+	uint32_t ulNumber;
+	char cName[ recorderNAME_LENGTH ];
+	int iSeen;
+	int iHasJobs;
+
+	/* The execution of the task. */
+	uint32_t ulSwitchedIn;
+	uint64_t ullRunTime;
+
+	/* The job of the task that has been released, if iJobReleased is set. */
+	int iJobReleased;
+	uint64_t ullJobReleasedAt;
+	uint32_t ulRelease;
+	uint32_t ulDeadline;
+
+	/* The jobs of the task. */
+	uint32_t ulReleased;
+	uint32_t ulCompleted;
+	uint32_t ulAborted;
+	uint32_t ulMissed;
+	uint32_t ulDeadlineOverruns;
+	uint32_t ulBudgetOverruns;
+	int64_t llMinResponse;
+	int64_t llMaxResponse;
+	int64_t llTotalResponse;
+	int64_t llMaxLateness;
+} Task_t;
+
+/* The operations on a queue. */
+typedef struct DECODED_QUEUE
+{
+	uint32_t ulQueue;
+	uint32_t ulCount[ eRecorderEvents ];
+} Queue_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Read the recording in pcFileName into xHeader, xTasks and pxEvents.
+ * Returns 0 on success.
+ */
+static int prvRead( const char *pcFileName );
+
+/*
+ * The difference a - b between two tick counts, taking into account that the
+ * tick count overflows.
+ */
+static int64_t prvTickDifference( uint32_t ulA, uint32_t ulB );
+
+/*
+ * Convert a time in counts of the run time counter to microseconds.
+ */
+static double prvMicroseconds( uint64_t ullTime );
+
+/*
+ * The slot in xTasks of the task with the task number ulNumber, which is
+ * allocated the first time the task number is seen.
+ */
+static uint32_t prvTaskSlot( uint32_t ulNumber );
+
+/*
+ * The name of the task in the slot ulTask.
+ */
+static const char *prvName( uint32_t ulTask );
+
+/*
+ * Update the figures of the task pxEvent is about if pxEvent is a job event.
+ * Returns 1 if pxEvent completed a job, in which case *pllLateness is set to
+ * its lateness.
+ */
+static int prvJobEvent( const Event_t *pxEvent, int64_t *pllLateness );
+
+/*
+ * Find the tasks that completed or aborted jobs, which are the tasks whose
+ * jobs are shown.  A task that has not may be a server, whose first job is
+ * released when it is created as a periodic task, before it becomes a server.
+ */
+static void prvFindTasksWithJobs( void );
+
+/*
+ * The outputs.
+ */
+static void prvReport( FILE *pxOut );
+static void prvGantt( FILE *pxOut, uint64_t ullStart, unsigned uColumns, uint64_t ullWidth );
+static void prvVCD( FILE *pxOut );
+static void prvJSON( FILE *pxOut );
+
+/*
+ * Mark the columns of the row of a Gantt chart pcRow that the time from
+ * ullFrom up to ullTo falls in with cMark, or the column ullFrom falls in if
+ * the two are equal.
+ */
+static void prvPaint( char *pcRow, uint64_t ullFrom, uint64_t ullTo, uint64_t ullStart, unsigned uColumns, uint64_t ullWidth, char cMark );
+
+/*
+ * Write the identifier of VCD signal uSignal to pcIdentifier, and write a
+ * change of a signal at ullTime.
+ */
+static void prvVCDIdentifier( char *pcIdentifier, unsigned uSignal );
+static void prvVCDChange( FILE *pxOut, uint64_t ullTime, uint64_t *pullLastTime, char cValue, unsigned uSignal );
+
+/*
+ * Write one trace event, preceded by a comma unless it is the first.
+ */
+static void prvJSONEvent( FILE *pxOut, int *piFirst, const char *pcFormat, ... ) __attribute__( ( format( printf, 3, 4 ) ) );
+
+/*-----------------------------------------------------------*/
+
+static RecorderHeader_t xHeader;
+static Task_t xTasks[ decoderMAX_TASKS ];
+static uint32_t ulTaskSlots = 1;
+static Event_t *pxEvents = NULL;
+static size_t xEvents = 0;
+
+/*-----------------------------------------------------------*/
+
+int main( int argc, char *argv[] )
+{
+const char *pcFormat = "report", *pcOutput = NULL;
+unsigned long ulStart = 0, ulColumns = 100, ulWidth = 0;
+FILE *pxOut = stdout;
+int iOption;
+
+	while( ( iOption = getopt( argc, argv, "f:o:s:n:t:" ) ) != -1 )
+	{
+		switch( iOption )
+		{
+			case 'f': pcFormat = optarg; break;
+			case 'o': pcOutput = optarg; break;
+			case 's': ulStart = strtoul( optarg, NULL, 0 ); break;
+			case 'n': ulColumns = strtoul( optarg, NULL, 0 ); break;
+			case 't': ulWidth = strtoul( optarg, NULL, 0 ); break;
+			default: optind = argc + 1; break;
+		}
+	}
+
+	if( optind != ( argc - 1 ) )
+	{
+		fprintf( stderr, "usage: %s [-f report|gantt|vcd|json] [-o file] [-s start] [-n columns] [-t width] recording\n", argv[ 0 ] );
+		return EXIT_FAILURE;
+	}
+
+	if( prvRead( argv[ optind ] ) != 0 )
+	{
+		return EXIT_FAILURE;
+	}
+
+	if( pcOutput != NULL )
+	{
+		pxOut = fopen( pcOutput, "w" );
+
+		if( pxOut == NULL )
+		{
+			perror( pcOutput );
+			return EXIT_FAILURE;
+		}
+	}
+
+	/* The columns of the Gantt chart are one tick wide unless told
+	otherwise. */
+	if( ulWidth == 0 )
+	{
+		ulWidth = xHeader.ulTimestampHz / xHeader.ulTickHz;
+	}
+
+	if( strcmp( pcFormat, "report" ) == 0 )
+	{
+		prvReport( pxOut );
+	}
+	else if( strcmp( pcFormat, "gantt" ) == 0 )
+	{
+		prvGantt( pxOut, ( uint64_t ) ulStart * ( uint64_t ) ulWidth, ( unsigned ) ulColumns, ( uint64_t ) ulWidth );
+	}
+	else if( strcmp( pcFormat, "vcd" ) == 0 )
+	{
+		prvVCD( pxOut );
+	}
+	else if( strcmp( pcFormat, "json" ) == 0 )
+	{
+		prvJSON( pxOut );
+	}
+	else
+	{
+		fprintf( stderr, "unknown format %s\n", pcFormat );
+		return EXIT_FAILURE;
+	}
+
+	if( ( pxOut != stdout ) && ( fclose( pxOut ) != 0 ) )
+	{
+		perror( pcOutput );
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
+/*-----------------------------------------------------------*/
+
+static int prvRead( const char *pcFileName )
+{
+FILE *pxFile;
+RecorderTask_t xTask;
+RecorderRecord_t *pxRecords, *pxRecord;
+uint64_t ullTime = 0;
+uint32_t ulRecords, ulFirst, ulRecord, ulExtension = 0, ulTask;
+unsigned uTask;
+
+	pxFile = fopen( pcFileName, "rb" );
+
+	if( pxFile == NULL )
+	{
+		perror( pcFileName );
+		return -1;
+	}
+
+	if( ( fread( &xHeader, sizeof( xHeader ), 1, pxFile ) != 1 ) || ( xHeader.ulMagic != recorderMAGIC ) ||
+		( xHeader.usVersion != recorderVERSION ) || ( xHeader.usRecordSize != sizeof( RecorderRecord_t ) ) ||
+		( xHeader.ulTimestampHz == 0 ) || ( xHeader.ulTickHz == 0 ) || ( xHeader.ulRecordSlots == 0 ) )
+	{
+		fprintf( stderr, "%s is not a recording this decoder can read\n", pcFileName );
+		fclose( pxFile );
+		return -1;
+	}
+
+	for( uTask = 0; uTask < xHeader.usTaskSlots; uTask++ )
+	{
+		if( fread( &xTask, sizeof( xTask ), 1, pxFile ) != 1 )
+		{
+			fprintf( stderr, "%s is truncated\n", pcFileName );
+			fclose( pxFile );
+			return -1;
+		}
+
+		/* Unused slots have the task number 0. */
+		if( xTask.ulTask != 0 )
+		{
+			xTask.cName[ recorderNAME_LENGTH - 1U ] = '\0';
+			memcpy( xTasks[ prvTaskSlot( xTask.ulTask ) ].cName, xTask.cName, recorderNAME_LENGTH );
+		}
+	}
+
+	/* The whole ring buffer is stored, of which only the records written are
+	used. */
+	pxRecords = malloc( ( size_t ) xHeader.ulRecordSlots * sizeof( RecorderRecord_t ) );
+	ulRecords = ( xHeader.ulWritten < xHeader.ulRecordSlots ) ? xHeader.ulWritten : xHeader.ulRecordSlots;
+	pxEvents = malloc( ( ( size_t ) ulRecords + 1U ) * sizeof( Event_t ) );
+
+	if( ( pxRecords == NULL ) || ( pxEvents == NULL ) )
+	{
+		free( pxRecords );
+		fclose( pxFile );
+		return -1;
+	}
+
+	if( fread( pxRecords, sizeof( RecorderRecord_t ), xHeader.ulRecordSlots, pxFile ) != xHeader.ulRecordSlots )
+	{
+		fprintf( stderr, "%s is truncated\n", pcFileName );
+		free( pxRecords );
+		fclose( pxFile );
+		return -1;
+	}
+
+	fclose( pxFile );
+
+	/* Once the buffer has wrapped the oldest record is the one the next
+	record would overwrite.  The times are measured from the first record, as
+	the time of the record before it is not known. */
+	ulFirst = ( xHeader.ulWritten > xHeader.ulRecordSlots ) ? ( xHeader.ulWritten % xHeader.ulRecordSlots ) : 0U;
+
+	for( ulRecord = 0; ulRecord < ulRecords; ulRecord++ )
+	{
+		pxRecord = &( pxRecords[ ( ulFirst + ulRecord ) % xHeader.ulRecordSlots ] );
+
+		if( pxRecord->ucEvent == ( uint8_t ) eRecorderTimeExtension )
+		{
+			ulExtension = pxRecord->ulParam;
+		}
+		else if( pxRecord->ucEvent < ( uint8_t ) eRecorderEvents )
+		{
+			if( xEvents != 0 )
+			{
+				ullTime += ( uint64_t ) pxRecord->usDelta + ( uint64_t ) ulExtension;
+			}
+
+			ulExtension = 0;
+			ulTask = prvTaskSlot( pxRecord->ulTask );
+			pxEvents[ xEvents ].ullTime = ullTime;
+			pxEvents[ xEvents ].ucEvent = pxRecord->ucEvent;
+			pxEvents[ xEvents ].ulTask = ulTask;
+			pxEvents[ xEvents ].ulParam = pxRecord->ulParam;
+			xTasks[ ulTask ].iSeen = 1;
+			xEvents++;
+		}
+		else
+		{
+			fprintf( stderr, "%s: record %lu has the unknown event %u\n", pcFileName, ( unsigned long ) ulRecord, ( unsigned ) pxRecord->ucEvent );
+		}
+	}
+
+	free( pxRecords );
+
+	/* Task number 0 is only recorded for events before the first task was
+	switched in. */
+	xTasks[ 0 ].iSeen = 0;
+	prvFindTasksWithJobs();
+
+	return 0;
+}
+/*-----------------------------------------------------------*/
+
+static void prvFindTasksWithJobs( void )
+{
+Task_t xTask;
+size_t x;
+uint32_t ulTask;
+int64_t llLateness;
+
+	for( x = 0; x < xEvents; x++ )
+	{
+		( void ) prvJobEvent( &( pxEvents[ x ] ), &llLateness );
+	}
+
+	/* The figures are found again by each output. */
+	for( ulTask = 0; ulTask < decoderMAX_TASKS; ulTask++ )
+	{
+		xTask = xTasks[ ulTask ];
+		memset( &( xTasks[ ulTask ] ), 0x00, sizeof( Task_t ) );
+		xTasks[ ulTask ].ulNumber = xTask.ulNumber;
+		memcpy( xTasks[ ulTask ].cName, xTask.cName, recorderNAME_LENGTH );
+		xTasks[ ulTask ].iSeen = xTask.iSeen;
+		xTasks[ ulTask ].iHasJobs = ( ( xTask.ulCompleted + xTask.ulAborted ) != 0 ) ? 1 : 0;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static int64_t prvTickDifference( uint32_t ulA, uint32_t ulB )
+{
+	if( xHeader.ucTickBits == 16U )
+	{
+		return ( int64_t ) ( int16_t ) ( uint16_t ) ( ulA - ulB );
+	}
+	else
+	{
+		return ( int64_t ) ( int32_t ) ( ulA - ulB );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static double prvMicroseconds( uint64_t ullTime )
+{
+	return ( double ) ullTime * 1000000.0 / ( double ) xHeader.ulTimestampHz;
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvTaskSlot( uint32_t ulNumber )
+{
+uint32_t ulTask;
+
+	if( ulNumber == 0 )
+	{
+		return 0;
+	}
+
+	for( ulTask = 1; ulTask < ulTaskSlots; ulTask++ )
+	{
+		if( xTasks[ ulTask ].ulNumber == ulNumber )
+		{
+			return ulTask;
+		}
+	}
+
+	if( ulTaskSlots == decoderMAX_TASKS )
+	{
+		return decoderMAX_TASKS - 1U;
+	}
+
+	xTasks[ ulTaskSlots ].ulNumber = ulNumber;
+
+	return ulTaskSlots++;
+}
+/*-----------------------------------------------------------*/
+
+static const char *prvName( uint32_t ulTask )
+{
+static char cName[ 16 ];
+
+	if( xTasks[ ulTask ].cName[ 0 ] != '\0' )
+	{
+		return xTasks[ ulTask ].cName;
+	}
+
+	snprintf( cName, sizeof( cName ), "Task_%lu", ( unsigned long ) xTasks[ ulTask ].ulNumber );
+	return cName;
+}
+/*-----------------------------------------------------------*/
+
+static int prvJobEvent( const Event_t *pxEvent, int64_t *pllLateness )
+{
+Task_t *pxTask = &( xTasks[ pxEvent->ulTask ] );
+int64_t llResponse;
+int iCompleted = 0;
+
+	switch( pxEvent->ucEvent )
+	{
+		case eRecorderJobRelease:
+			/* A job is only released before the previous job of the task has
+			completed if the previous job was aborted. */
+			if( pxTask->iJobReleased != 0 )
+			{
+				pxTask->ulAborted++;
+			}
+
+			pxTask->iJobReleased = 1;
+			pxTask->ullJobReleasedAt = pxEvent->ullTime;
+			pxTask->ulRelease = pxEvent->ulParam;
+			pxTask->ulDeadline = pxEvent->ulParam;
+			pxTask->ulReleased++;
+			break;
+
+		case eRecorderJobDeadline:
+			pxTask->ulDeadline = pxEvent->ulParam;
+			break;
+
+		case eRecorderJobComplete:
+			/* The completion of a job released before the recording started
+			cannot be measured. */
+			if( pxTask->iJobReleased != 0 )
+			{
+				/* A job can complete before it is due if its task was resumed
+				early, in which case it responded at once. */
+				llResponse = prvTickDifference( pxEvent->ulParam, pxTask->ulRelease );
+
+				if( llResponse < 0 )
+				{
+					llResponse = 0;
+				}
+
+				*pllLateness = prvTickDifference( pxEvent->ulParam, pxTask->ulDeadline );
+
+				if( pxTask->ulCompleted == 0 )
+				{
+					pxTask->llMinResponse = llResponse;
+					pxTask->llMaxResponse = llResponse;
+					pxTask->llMaxLateness = *pllLateness;
+				}
+				else
+				{
+					if( llResponse < pxTask->llMinResponse )
+					{
+						pxTask->llMinResponse = llResponse;
+					}
+
+					if( llResponse > pxTask->llMaxResponse )
+					{
+						pxTask->llMaxResponse = llResponse;
+					}
+
+					if( *pllLateness > pxTask->llMaxLateness )
+					{
+						pxTask->llMaxLateness = *pllLateness;
+					}
+				}
+
+				if( *pllLateness > 0 )
+				{
+					pxTask->ulMissed++;
+				}
+
+				pxTask->llTotalResponse += llResponse;
+				pxTask->ulCompleted++;
+				pxTask->iJobReleased = 0;
+				iCompleted = 1;
+			}
+			break;
+
+		case eRecorderJobOverrun:
+			if( pxEvent->ulParam == 0 )
+			{
+				pxTask->ulDeadlineOverruns++;
+			}
+			else
+			{
+				pxTask->ulBudgetOverruns++;
+			}
+			break;
+
+		default:
+			break;
+	}
+
+	return iCompleted;
+}
+/*-----------------------------------------------------------*/
+
+static void prvReport( FILE *pxOut )
+{
+Queue_t xQueues[ decoderMAX_QUEUES ];
+unsigned uQueues = 0, uQueue;
+size_t x;
+const Event_t *pxEvent;
+uint64_t ullDuration, ullSwitchedIn = 0, ullISREntered = 0, ullISRTime = 0;
+uint32_t ulTask, ulISRs = 0, ulOverwritten;
+uint32_t ulRunning = 0;
+int64_t llLateness;
+Task_t *pxTask;
+
+	memset( xQueues, 0x00, sizeof( xQueues ) );
+	ullDuration = ( xEvents != 0 ) ? pxEvents[ xEvents - 1 ].ullTime : 0;
+
+	for( x = 0; x < xEvents; x++ )
+	{
+		pxEvent = &( pxEvents[ x ] );
+
+		switch( pxEvent->ucEvent )
+		{
+			case eRecorderTaskSwitchedIn:
+				ulRunning = pxEvent->ulTask;
+				ullSwitchedIn = pxEvent->ullTime;
+				xTasks[ ulRunning ].ulSwitchedIn++;
+				break;
+
+			case eRecorderTaskSwitchedOut:
+				if( ( ulRunning != 0 ) && ( ulRunning == pxEvent->ulTask ) )
+				{
+					xTasks[ ulRunning ].ullRunTime += pxEvent->ullTime - ullSwitchedIn;
+				}
+				ulRunning = 0;
+				break;
+
+			case eRecorderISREnter:
+				ullISREntered = pxEvent->ullTime;
+				ulISRs++;
+				break;
+
+			case eRecorderISRExit:
+				ullISRTime += pxEvent->ullTime - ullISREntered;
+				break;
+
+			case eRecorderQueueSend:
+			case eRecorderQueueSendFailed:
+			case eRecorderQueueReceive:
+			case eRecorderQueueReceiveFailed:
+			case eRecorderQueueBlockOnSend:
+			case eRecorderQueueBlockOnReceive:
+				for( uQueue = 0; uQueue < uQueues; uQueue++ )
+				{
+					if( xQueues[ uQueue ].ulQueue == pxEvent->ulParam )
+					{
+						break;
+					}
+				}
+
+				if( uQueue == uQueues )
+				{
+					if( uQueues < decoderMAX_QUEUES )
+					{
+						xQueues[ uQueues ].ulQueue = pxEvent->ulParam;
+						uQueues++;
+					}
+					else
+					{
+						uQueue = decoderMAX_QUEUES - 1U;
+					}
+				}
+
+				xQueues[ uQueue ].ulCount[ pxEvent->ucEvent ]++;
+				break;
+
+			default:
+				( void ) prvJobEvent( pxEvent, &llLateness );
+				break;
+		}
+	}
+
+	/* The task running at the end of the recording ran until then. */
+	if( ulRunning != 0 )
+	{
+		xTasks[ ulRunning ].ullRunTime += ullDuration - ullSwitchedIn;
+	}
+
+	ulOverwritten = ( xHeader.ulWritten > xHeader.ulRecordSlots ) ? ( xHeader.ulWritten - xHeader.ulRecordSlots ) : 0U;
+
+	fprintf( pxOut, "%lu records over %.0f us, %lu earlier records overwritten, tick %.0f us\n\n",
+			 ( unsigned long ) ( xHeader.ulWritten - ulOverwritten ), prvMicroseconds( ullDuration ), ( unsigned long ) ulOverwritten,
+			 1000000.0 / ( double ) xHeader.ulTickHz );
+
+	fprintf( pxOut, "%-24s%10s%14s%8s\n", "Task", "Switches", "Run time us", "CPU" );
+
+	for( ulTask = 1; ulTask < decoderMAX_TASKS; ulTask++ )
+	{
+		pxTask = &( xTasks[ ulTask ] );
+
+		if( pxTask->iSeen != 0 )
+		{
+			fprintf( pxOut, "%-24s%10lu%14.0f%7.1f%%\n", prvName( ulTask ), ( unsigned long ) pxTask->ulSwitchedIn,
+					 prvMicroseconds( pxTask->ullRunTime ), ( ullDuration != 0 ) ? ( 100.0 * ( double ) pxTask->ullRunTime / ( double ) ullDuration ) : 0.0 );
+		}
+	}
+
+	fprintf( pxOut, "%-24s%10lu%14.0f%7.1f%%\n\n", "(tick interrupt)", ( unsigned long ) ulISRs, prvMicroseconds( ullISRTime ),
+			 ( ullDuration != 0 ) ? ( 100.0 * ( double ) ullISRTime / ( double ) ullDuration ) : 0.0 );
+
+	fprintf( pxOut, "%-24s%9s%10s%9s%8s%10s%16s%9s\n", "Task", "Released", "Completed", "Aborted", "Missed", "Overruns", "Response", "Lateness" );
+
+	for( ulTask = 1; ulTask < decoderMAX_TASKS; ulTask++ )
+	{
+		pxTask = &( xTasks[ ulTask ] );
+
+		if( pxTask->iHasJobs != 0 )
+		{
+			fprintf( pxOut, "%-24s%9lu%10lu%9lu%8lu%5lu/%4lu%6lld/%4lld/%4lld%9lld\n", prvName( ulTask ),
+					 ( unsigned long ) pxTask->ulReleased, ( unsigned long ) pxTask->ulCompleted, ( unsigned long ) pxTask->ulAborted,
+					 ( unsigned long ) pxTask->ulMissed, ( unsigned long ) pxTask->ulDeadlineOverruns, ( unsigned long ) pxTask->ulBudgetOverruns,
+					 ( long long ) pxTask->llMinResponse, ( long long ) ( ( pxTask->ulCompleted != 0 ) ? ( pxTask->llTotalResponse / ( int64_t ) pxTask->ulCompleted ) : 0 ),
+					 ( long long ) pxTask->llMaxResponse, ( long long ) pxTask->llMaxLateness );
+		}
+	}
+
+	if( uQueues != 0 )
+	{
+		fprintf( pxOut, "\n%-24s%10s%10s%10s%10s%10s%10s\n", "Queue", "Sends", "Failed", "Blocked", "Receives", "Failed", "Blocked" );
+
+		for( uQueue = 0; uQueue < uQueues; uQueue++ )
+		{
+			fprintf( pxOut, "Queue_%-18u%10lu%10lu%10lu%10lu%10lu%10lu\n", uQueue + 1U,
+					 ( unsigned long ) xQueues[ uQueue ].ulCount[ eRecorderQueueSend ],
+					 ( unsigned long ) xQueues[ uQueue ].ulCount[ eRecorderQueueSendFailed ],
+					 ( unsigned long ) xQueues[ uQueue ].ulCount[ eRecorderQueueBlockOnSend ],
+					 ( unsigned long ) xQueues[ uQueue ].ulCount[ eRecorderQueueReceive ],
+					 ( unsigned long ) xQueues[ uQueue ].ulCount[ eRecorderQueueReceiveFailed ],
+					 ( unsigned long ) xQueues[ uQueue ].ulCount[ eRecorderQueueBlockOnReceive ] );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvPaint( char *pcRow, uint64_t ullFrom, uint64_t ullTo, uint64_t ullStart, unsigned uColumns, uint64_t ullWidth, char cMark )
+{
+uint64_t ullColumn, ullLast;
+
+	if( ( ullTo < ullStart ) || ( ( ullTo == ullStart ) && ( ullFrom < ullTo ) ) )
+	{
+		return;
+	}
+
+	ullColumn = ( ullFrom > ullStart ) ? ( ( ullFrom - ullStart ) / ullWidth ) : 0;
+
+	/* An interval that ends at the start of a column does not reach into
+	it. */
+	ullLast = ( ullTo > ullFrom ) ? ( ( ullTo - 1U - ullStart ) / ullWidth ) : ullColumn;
+
+	for( ; ( ullColumn <= ullLast ) && ( ullColumn < uColumns ); ullColumn++ )
+	{
+		/* A deadline miss is not hidden by running, which is not hidden by
+		waiting. */
+		if( ( cMark == '!' ) || ( ( cMark == '#' ) && ( pcRow[ ullColumn ] != '!' ) ) || ( pcRow[ ullColumn ] == '.' ) )
+		{
+			pcRow[ ullColumn ] = cMark;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvGantt( FILE *pxOut, uint64_t ullStart, unsigned uColumns, uint64_t ullWidth )
+{
+static char cRows[ decoderMAX_TASKS ][ 1024 ];
+uint64_t ullEnd = ullStart + ( ( uint64_t ) uColumns * ullWidth ), ullSwitchedIn = 0;
+uint32_t ulTask;
+uint32_t ulRunning = 0;
+unsigned uColumn;
+size_t x;
+const Event_t *pxEvent;
+int64_t llLateness;
+
+	if( uColumns > sizeof( cRows[ 0 ] ) - 1U )
+	{
+		uColumns = sizeof( cRows[ 0 ] ) - 1U;
+	}
+
+	for( ulTask = 0; ulTask < decoderMAX_TASKS; ulTask++ )
+	{
+		memset( cRows[ ulTask ], '.', uColumns );
+		cRows[ ulTask ][ uColumns ] = '\0';
+	}
+
+	for( x = 0; ( x < xEvents ) && ( pxEvents[ x ].ullTime < ullEnd ); x++ )
+	{
+		pxEvent = &( pxEvents[ x ] );
+
+		switch( pxEvent->ucEvent )
+		{
+			case eRecorderTaskSwitchedIn:
+				ulRunning = pxEvent->ulTask;
+				ullSwitchedIn = pxEvent->ullTime;
+				break;
+
+			case eRecorderTaskSwitchedOut:
+				if( ( ulRunning != 0 ) && ( pxEvent->ullTime > ullSwitchedIn ) )
+				{
+					prvPaint( cRows[ ulRunning ], ullSwitchedIn, pxEvent->ullTime, ullStart, uColumns, ullWidth, '#' );
+				}
+				ulRunning = 0;
+				break;
+
+			case eRecorderJobRelease:
+				/* The job released before, if any, was aborted. */
+				if( ( xTasks[ pxEvent->ulTask ].iJobReleased != 0 ) && ( xTasks[ pxEvent->ulTask ].iHasJobs != 0 ) )
+				{
+					prvPaint( cRows[ pxEvent->ulTask ], xTasks[ pxEvent->ulTask ].ullJobReleasedAt, pxEvent->ullTime, ullStart, uColumns, ullWidth, '-' );
+				}
+				( void ) prvJobEvent( pxEvent, &llLateness );
+				break;
+
+			case eRecorderJobComplete:
+				ulTask = pxEvent->ulTask;
+
+				if( xTasks[ ulTask ].iJobReleased != 0 )
+				{
+					prvPaint( cRows[ ulTask ], xTasks[ ulTask ].ullJobReleasedAt, pxEvent->ullTime, ullStart, uColumns, ullWidth, '-' );
+				}
+
+				if( ( prvJobEvent( pxEvent, &llLateness ) != 0 ) && ( llLateness > 0 ) )
+				{
+					prvPaint( cRows[ ulTask ], pxEvent->ullTime, pxEvent->ullTime, ullStart, uColumns, ullWidth, '!' );
+				}
+				break;
+
+			case eRecorderJobOverrun:
+				if( pxEvent->ulParam == 0 )
+				{
+					prvPaint( cRows[ pxEvent->ulTask ], pxEvent->ullTime, pxEvent->ullTime, ullStart, uColumns, ullWidth, '!' );
+				}
+				( void ) prvJobEvent( pxEvent, &llLateness );
+				break;
+
+			default:
+				( void ) prvJobEvent( pxEvent, &llLateness );
+				break;
+		}
+	}
+
+	/* Paint what was still going on at the end of the chart. */
+	if( ( ulRunning != 0 ) && ( x != 0 ) )
+	{
+		prvPaint( cRows[ ulRunning ], ullSwitchedIn, ( x < xEvents ) ? ullEnd : pxEvents[ x - 1 ].ullTime, ullStart, uColumns, ullWidth, '#' );
+	}
+
+	for( ulTask = 1; ulTask < decoderMAX_TASKS; ulTask++ )
+	{
+		if( ( xTasks[ ulTask ].iJobReleased != 0 ) && ( xTasks[ ulTask ].iHasJobs != 0 ) && ( x != 0 ) )
+		{
+			prvPaint( cRows[ ulTask ], xTasks[ ulTask ].ullJobReleasedAt, ( x < xEvents ) ? ullEnd : pxEvents[ x - 1 ].ullTime, ullStart, uColumns, ullWidth, '-' );
+		}
+	}
+
+	fprintf( pxOut, "%-24s", "Column" );
+
+	for( uColumn = 0; uColumn < uColumns; uColumn += 10U )
+	{
+		fprintf( pxOut, "%-10lu", ( unsigned long ) ( ( ullStart / ullWidth ) + uColumn ) );
+	}
+
+	fprintf( pxOut, "\n" );
+
+	for( ulTask = 1; ulTask < decoderMAX_TASKS; ulTask++ )
+	{
+		if( xTasks[ ulTask ].iSeen != 0 )
+		{
+			fprintf( pxOut, "%-24s%s\n", prvName( ulTask ), cRows[ ulTask ] );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvVCDIdentifier( char *pcIdentifier, unsigned uSignal )
+{
+	/* The identifiers are made of the printable characters. */
+	pcIdentifier[ 0 ] = ( char ) ( '!' + ( uSignal % 94U ) );
+	pcIdentifier[ 1 ] = ( uSignal >= 94U ) ? ( char ) ( '!' + ( uSignal / 94U ) ) : '\0';
+	pcIdentifier[ 2 ] = '\0';
+}
+/*-----------------------------------------------------------*/
+
+static void prvVCDChange( FILE *pxOut, uint64_t ullTime, uint64_t *pullLastTime, char cValue, unsigned uSignal )
+{
+char cIdentifier[ 3 ];
+
+	if( ullTime != *pullLastTime )
+	{
+		fprintf( pxOut, "#%llu\n", ( unsigned long long ) ullTime );
+		*pullLastTime = ullTime;
+	}
+
+	prvVCDIdentifier( cIdentifier, uSignal );
+	fprintf( pxOut, "%c%s\n", cValue, cIdentifier );
+}
+/*-----------------------------------------------------------*/
+
+static void prvVCD( FILE *pxOut )
+{
+/* Each task has three signals, running, released and missed.  The tick
+interrupt is signal 0. */
+#define decoderRUNNING( ulTask )	( ( unsigned ) ( ulTask ) * 3U - 2U )
+#define decoderRELEASED( ulTask )	( ( unsigned ) ( ulTask ) * 3U - 1U )
+#define decoderMISSED( ulTask )		( ( unsigned ) ( ulTask ) * 3U )
+char cIdentifier[ 3 ], cName[ recorderNAME_LENGTH ];
+uint64_t ullLastTime = UINT64_MAX;
+uint32_t ulTask;
+uint32_t ulRunning = 0;
+size_t x;
+char *pcSpace;
+const Event_t *pxEvent;
+int64_t llLateness;
+
+	/* The run time counter counts microseconds on the host, but the
+	timescale can only be a power of 10 seconds. */
+	fprintf( pxOut, "$version EDF recorder decoder $end\n" );
+	fprintf( pxOut, "$timescale %s $end\n", ( xHeader.ulTimestampHz == 1000000UL ) ? "1 us" : ( xHeader.ulTimestampHz == 1000UL ) ? "1 ms" : "1 ns" );
+	fprintf( pxOut, "$scope module scheduler $end\n" );
+	prvVCDIdentifier( cIdentifier, 0 );
+	fprintf( pxOut, "$var wire 1 %s tick_interrupt $end\n", cIdentifier );
+
+	for( ulTask = 1; ulTask < decoderMAX_TASKS; ulTask++ )
+	{
+		if( xTasks[ ulTask ].iSeen != 0 )
+		{
+			/* Names cannot hold spaces. */
+			strncpy( cName, prvName( ulTask ), sizeof( cName ) - 1U );
+			cName[ sizeof( cName ) - 1U ] = '\0';
+
+			while( ( pcSpace = strchr( cName, ' ' ) ) != NULL )
+			{
+				*pcSpace = '_';
+			}
+
+			prvVCDIdentifier( cIdentifier, decoderRUNNING( ulTask ) );
+			fprintf( pxOut, "$var wire 1 %s %s $end\n", cIdentifier, cName );
+
+			if( xTasks[ ulTask ].iHasJobs != 0 )
+			{
+				prvVCDIdentifier( cIdentifier, decoderRELEASED( ulTask ) );
+				fprintf( pxOut, "$var wire 1 %s %s_job $end\n", cIdentifier, cName );
+				prvVCDIdentifier( cIdentifier, decoderMISSED( ulTask ) );
+				fprintf( pxOut, "$var event 1 %s %s_miss $end\n", cIdentifier, cName );
+			}
+		}
+	}
+
+	fprintf( pxOut, "$upscope $end\n$enddefinitions $end\n$dumpvars\n" );
+	prvVCDIdentifier( cIdentifier, 0 );
+	fprintf( pxOut, "0%s\n", cIdentifier );
+
+	for( ulTask = 1; ulTask < decoderMAX_TASKS; ulTask++ )
+	{
+		if( xTasks[ ulTask ].iSeen != 0 )
+		{
+			prvVCDIdentifier( cIdentifier, decoderRUNNING( ulTask ) );
+			fprintf( pxOut, "0%s\n", cIdentifier );
+
+			if( xTasks[ ulTask ].iHasJobs != 0 )
+			{
+				prvVCDIdentifier( cIdentifier, decoderRELEASED( ulTask ) );
+				fprintf( pxOut, "0%s\n", cIdentifier );
+			}
+		}
+	}
+
+	fprintf( pxOut, "$end\n" );
+
+	for( x = 0; x < xEvents; x++ )
+	{
+		pxEvent = &( pxEvents[ x ] );
+		ulTask = pxEvent->ulTask;
+
+		switch( pxEvent->ucEvent )
+		{
+			case eRecorderTaskSwitchedIn:
+				ulRunning = ulTask;
+				prvVCDChange( pxOut, pxEvent->ullTime, &ullLastTime, '1', decoderRUNNING( ulTask ) );
+				break;
+
+			case eRecorderTaskSwitchedOut:
+				if( ulRunning != 0 )
+				{
+					prvVCDChange( pxOut, pxEvent->ullTime, &ullLastTime, '0', decoderRUNNING( ulRunning ) );
+				}
+				ulRunning = 0;
+				break;
+
+			case eRecorderISREnter:
+				prvVCDChange( pxOut, pxEvent->ullTime, &ullLastTime, '1', 0 );
+				break;
+
+			case eRecorderISRExit:
+				prvVCDChange( pxOut, pxEvent->ullTime, &ullLastTime, '0', 0 );
+				break;
+
+			case eRecorderJobRelease:
+				( void ) prvJobEvent( pxEvent, &llLateness );
+
+				if( xTasks[ ulTask ].iHasJobs != 0 )
+				{
+					prvVCDChange( pxOut, pxEvent->ullTime, &ullLastTime, '1', decoderRELEASED( ulTask ) );
+				}
+				break;
+
+			case eRecorderJobComplete:
+				if( prvJobEvent( pxEvent, &llLateness ) != 0 )
+				{
+					prvVCDChange( pxOut, pxEvent->ullTime, &ullLastTime, '0', decoderRELEASED( ulTask ) );
+
+					if( llLateness > 0 )
+					{
+						prvVCDChange( pxOut, pxEvent->ullTime, &ullLastTime, '1', decoderMISSED( ulTask ) );
+					}
+				}
+				break;
+
+			case eRecorderJobOverrun:
+				if( ( pxEvent->ulParam == 0 ) && ( xTasks[ ulTask ].iHasJobs != 0 ) )
+				{
+					prvVCDChange( pxOut, pxEvent->ullTime, &ullLastTime, '1', decoderMISSED( ulTask ) );
+				}
+				( void ) prvJobEvent( pxEvent, &llLateness );
+				break;
+
+			default:
+				( void ) prvJobEvent( pxEvent, &llLateness );
+				break;
+		}
+	}
+
+#undef decoderRUNNING
+#undef decoderRELEASED
+#undef decoderMISSED
+}
+/*-----------------------------------------------------------*/
+
+static void prvJSONEvent( FILE *pxOut, int *piFirst, const char *pcFormat, ... )
+{
+va_list xArgs;
+
+	fprintf( pxOut, "%s\n", ( *piFirst != 0 ) ? "" : "," );
+	*piFirst = 0;
+
+	va_start( xArgs, pcFormat );
+	vfprintf( pxOut, pcFormat, xArgs );
+	va_end( xArgs );
+}
+/*-----------------------------------------------------------*/
+
+static void prvJSON( FILE *pxOut )
+{
+/* The tasks and the tick interrupt are threads of process 1, and the jobs of
+each task are a thread of process 2. */
+uint64_t ullSwitchedIn = 0, ullISREntered = 0;
+uint32_t ulTask;
+uint32_t ulRunning = 0;
+size_t x;
+int iFirst = 1;
+const Event_t *pxEvent;
+Task_t *pxTask;
+uint64_t ullReleasedAt;
+uint32_t ulRelease, ulDeadline;
+int iReleased;
+int64_t llLateness;
+
+	fprintf( pxOut, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[" );
+	prvJSONEvent( pxOut, &iFirst, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"CPU\"}}" );
+	prvJSONEvent( pxOut, &iFirst, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":2,\"args\":{\"name\":\"Jobs\"}}" );
+	prvJSONEvent( pxOut, &iFirst, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Tick interrupt\"}}" );
+
+	for( ulTask = 1; ulTask < decoderMAX_TASKS; ulTask++ )
+	{
+		if( xTasks[ ulTask ].iSeen != 0 )
+		{
+			prvJSONEvent( pxOut, &iFirst, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%lu,\"args\":{\"name\":\"%s\"}}", ( unsigned long ) ulTask, prvName( ulTask ) );
+			prvJSONEvent( pxOut, &iFirst, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":2,\"tid\":%lu,\"args\":{\"name\":\"%s\"}}", ( unsigned long ) ulTask, prvName( ulTask ) );
+		}
+	}
+
+	for( x = 0; x < xEvents; x++ )
+	{
+		pxEvent = &( pxEvents[ x ] );
+		ulTask = pxEvent->ulTask;
+		pxTask = &( xTasks[ ulTask ] );
+
+		switch( pxEvent->ucEvent )
+		{
+			case eRecorderTaskSwitchedIn:
+				ulRunning = ulTask;
+				ullSwitchedIn = pxEvent->ullTime;
+				break;
+
+			case eRecorderTaskSwitchedOut:
+				if( ulRunning != 0 )
+				{
+					prvJSONEvent( pxOut, &iFirst, "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+								  prvName( ulRunning ), ( unsigned ) ulRunning, prvMicroseconds( ullSwitchedIn ), prvMicroseconds( pxEvent->ullTime - ullSwitchedIn ) );
+				}
+				ulRunning = 0;
+				break;
+
+			case eRecorderISREnter:
+				ullISREntered = pxEvent->ullTime;
+				break;
+
+			case eRecorderISRExit:
+				prvJSONEvent( pxOut, &iFirst, "{\"name\":\"tick\",\"ph\":\"X\",\"pid\":1,\"tid\":0,\"ts\":%.3f,\"dur\":%.3f}",
+							  prvMicroseconds( ullISREntered ), prvMicroseconds( pxEvent->ullTime - ullISREntered ) );
+				break;
+
+			case eRecorderJobRelease:
+			case eRecorderJobComplete:
+				/* The job is written once it has completed or been aborted,
+				as its end is not known before. */
+				iReleased = pxTask->iJobReleased;
+				ullReleasedAt = pxTask->ullJobReleasedAt;
+				ulRelease = pxTask->ulRelease;
+				ulDeadline = pxTask->ulDeadline;
+
+				if( prvJobEvent( pxEvent, &llLateness ) != 0 )
+				{
+					prvJSONEvent( pxOut, &iFirst, "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":2,\"tid\":%lu,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"release\":%lu,\"deadline\":%lu,\"completed\":%lu,\"lateness\":%lld}}",
+								  ( llLateness > 0 ) ? "late job" : "job", ( unsigned long ) ulTask, prvMicroseconds( ullReleasedAt ), prvMicroseconds( pxEvent->ullTime - ullReleasedAt ),
+								  ( unsigned long ) ulRelease, ( unsigned long ) ulDeadline, ( unsigned long ) pxEvent->ulParam, ( long long ) llLateness );
+				}
+				else if( ( pxEvent->ucEvent == eRecorderJobRelease ) && ( iReleased != 0 ) )
+				{
+					prvJSONEvent( pxOut, &iFirst, "{\"name\":\"aborted job\",\"ph\":\"X\",\"pid\":2,\"tid\":%lu,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"release\":%lu,\"deadline\":%lu}}",
+								  ( unsigned long ) ulTask, prvMicroseconds( ullReleasedAt ), prvMicroseconds( pxEvent->ullTime - ullReleasedAt ),
+								  ( unsigned long ) ulRelease, ( unsigned long ) ulDeadline );
+				}
+				break;
+
+			case eRecorderJobOverrun:
+				( void ) prvJobEvent( pxEvent, &llLateness );
+				prvJSONEvent( pxOut, &iFirst, "{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"pid\":2,\"tid\":%lu,\"ts\":%.3f}",
+							  ( pxEvent->ulParam == 0 ) ? "deadline missed" : "budget exhausted", ( unsigned long ) ulTask, prvMicroseconds( pxEvent->ullTime ) );
+				break;
+
+			case eRecorderQueueSend:
+			case eRecorderQueueSendFailed:
+			case eRecorderQueueReceive:
+			case eRecorderQueueReceiveFailed:
+			case eRecorderQueueBlockOnSend:
+			case eRecorderQueueBlockOnReceive:
+			{
+			static const char * const pcQueueEvents[] = { "send", "send failed", "receive", "receive failed", "block on send", "block on receive" };
+
+				prvJSONEvent( pxOut, &iFirst, "{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%lu,\"ts\":%.3f,\"args\":{\"queue\":\"0x%08lx\"}}",
+							  pcQueueEvents[ pxEvent->ucEvent - eRecorderQueueSend ], ( unsigned long ) ulTask, prvMicroseconds( pxEvent->ullTime ), ( unsigned long ) pxEvent->ulParam );
+				break;
+			}
+
+			default:
+				( void ) prvJobEvent( pxEvent, &llLateness );
+				break;
+		}
+	}
+
+	fprintf( pxOut, "\n]}\n" );
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,242 @@
+/*
+ * FreeRTOS Kernel V10.3.0
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/******************************************************************************
+ * This project runs the EDF scheduler on a Linux host using the Posix port.
+ * Each task is a pthread and the tick interrupt is simulated by a periodic
+ * signal, so the task set, the EDF ready list and xTaskPeriodicCreate() can be
+ * run, profiled and regression tested without the LPC2129 board.
+ *
+ * main() calls the application selected by mainSELECTED_APPLICATION, which is
+ * set from the make command line with "make DEMO=<name>" to run main_<name>():
+ *
+ * main_edf() (the default) creates the same six tasks as
+ * Demo/ARM7_LPC2129_Keil_RVDS/Starter_Files_V1/source/main.c, runs them for a
+ * fixed number of ticks, then ends the scheduler and reports whether any
+ * deadline was missed.  The process exit status is 0 if no errors were found,
+ * so the demo can be used as a CI check.
+ *
+ * main_benchmark() measures the cost of the tick as the number of EDF tasks
+ * grows, see main_benchmark.c.
+ *
+ * main_timer_benchmark() measures the cost of the software timers as the
+ * number of active timers grows, see main_timer_benchmark.c.
+ *
+ * Build with "make VIRTUAL_TIME=1" to run in virtual time, in which case the
+ * simulation runs much faster than real time and produces the same results on
+ * every run.  If a file name is given on the command line the context switches
+ * made while the demo ran are written to it, see trace.h.  If a file name is
+ * given after -r the binary recording of the scheduling events is written to
+ * it, see Source/include/recorder.h, which decoder.c can turn into a report, a Gantt chart, a
+ * VCD file or a Chrome trace.
+ *
+ * Tasks must not call printf() directly as the tick signal can switch tasks
+ * while the C library holds the stdout lock.  Use vConsolePrint() instead.
+ ******************************************************************************/
+
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Demo includes. */
+#include "console.h"
+#include "trace.h"
+
+/*-----------------------------------------------------------*/
+
+/* The application run by main(). */
+#ifndef mainSELECTED_APPLICATION
+	#define mainSELECTED_APPLICATION	main_edf
+#endif
+
+/*
+ * The demo applications, implemented in main_<name>.c.  Each returns the
+ * number of errors detected.
+ */
+extern int main_edf( void );
+extern int main_benchmark( void );
+extern int main_timer_benchmark( void );
+
+/*
+ * Stop the recorder of the kernel and write the recording to the file
+ * pcFileName.  Returns 0 on success.
+ */
+static int prvWriteRecording( const char *pcFileName );
+
+/*
+ * Releases the jobs of the button monitors of main_edf(), see main_edf.c.
+ */
+#if( mainEDF_DEMO_SELECTED == 1 )
+	extern void vEDFDemoTickHook( void );
+#endif
+
+/*
+ * Prototypes for the standard FreeRTOS callback/hook functions implemented
+ * within this file.
+ */
+void vApplicationIdleHook( void );
+void vApplicationTickHook( void );
+void vAssertCalled( const char * const pcFileName, unsigned long ulLine );
+
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	void vApplicationGetIdleTaskMemory( StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint32_t *pulIdleTaskStackSize );
+
+	#if( configUSE_TIMERS == 1 )
+		void vApplicationGetTimerTaskMemory( StaticTask_t **ppxTimerTaskTCBBuffer, StackType_t **ppxTimerTaskStackBuffer, uint32_t *pulTimerTaskStackSize );
+	#endif
+#endif
+
+/*-----------------------------------------------------------*/
+
+int main( int argc, char *argv[] )
+{
+int iErrors, iArg;
+
+	iErrors = mainSELECTED_APPLICATION();
+
+	for( iArg = 1; iArg < argc; iArg++ )
+	{
+		if( ( strcmp( argv[ iArg ], "-r" ) == 0 ) && ( ( iArg + 1 ) < argc ) )
+		{
+			iArg++;
+
+			if( prvWriteRecording( argv[ iArg ] ) != 0 )
+			{
+				iErrors++;
+			}
+		}
+		else if( iTraceWrite( argv[ iArg ] ) != 0 )
+		{
+			iErrors++;
+		}
+	}
+
+	return ( iErrors == 0 ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+/*-----------------------------------------------------------*/
+
+static int prvWriteRecording( const char *pcFileName )
+{
+FILE *pxFile;
+const void *pvRecording;
+size_t xLength;
+int iReturn = 0;
+
+	/* The scheduler has ended, but the recording is stopped anyway so it
+	is written as it stands. */
+	vRecorderStop();
+	pvRecording = pvRecorderGetRecording( &xLength );
+
+	pxFile = fopen( pcFileName, "wb" );
+
+	if( pxFile == NULL )
+	{
+		perror( pcFileName );
+		return -1;
+	}
+
+	if( fwrite( pvRecording, xLength, 1, pxFile ) != 1 )
+	{
+		perror( pcFileName );
+		iReturn = -1;
+	}
+
+	if( fclose( pxFile ) != 0 )
+	{
+		iReturn = -1;
+	}
+
+	return iReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationIdleHook( void )
+{
+	/* The idle task runs whenever no periodic task is ready.  There is
+	nothing to do here, time spent in the idle task is reported in the run
+	time statistics printed at the end of the demo. */
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationTickHook( void )
+{
+	/* Called from the simulated tick interrupt, so must not block or call
+	vConsolePrint(). */
+	#if( mainEDF_DEMO_SELECTED == 1 )
+	{
+		vEDFDemoTickHook();
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+void vAssertCalled( const char * const pcFileName, unsigned long ulLine )
+{
+	taskDISABLE_INTERRUPTS();
+	fprintf( stderr, "ASSERT! Line %lu, file %s\n", ulLine, pcFileName );
+	fflush( stderr );
+	abort();
+}
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+	void vApplicationGetIdleTaskMemory( StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint32_t *pulIdleTaskStackSize )
+	{
+	/* The idle task is created with these buffers, so they must outlive this
+	function. */
+	static StaticTask_t xIdleTaskTCB;
+	static StackType_t uxIdleTaskStack[ configMINIMAL_STACK_SIZE ];
+
+		*ppxIdleTaskTCBBuffer = &xIdleTaskTCB;
+		*ppxIdleTaskStackBuffer = uxIdleTaskStack;
+		*pulIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+	}
+	/*-----------------------------------------------------------*/
+
+	#if( configUSE_TIMERS == 1 )
+
+		void vApplicationGetTimerTaskMemory( StaticTask_t **ppxTimerTaskTCBBuffer, StackType_t **ppxTimerTaskStackBuffer, uint32_t *pulTimerTaskStackSize )
+		{
+		/* As the idle task memory above. */
+		static StaticTask_t xTimerTaskTCB;
+		static StackType_t uxTimerTaskStack[ configTIMER_TASK_STACK_DEPTH ];
+
+			*ppxTimerTaskTCBBuffer = &xTimerTaskTCB;
+			*ppxTimerTaskStackBuffer = uxTimerTaskStack;
+			*pulTimerTaskStackSize = configTIMER_TASK_STACK_DEPTH;
+		}
+
+	#endif /* configUSE_TIMERS */
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
@@ -0,0 +1,241 @@
+/*
+ * FreeRTOS Kernel V10.3.0
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/******************************************************************************
+ * Measures the cost of the EDF scheduler's tick as the number of tasks grows.
+ *
+ * A benchmark task, which always has the earliest deadline, creates worker
+ * tasks in steps from mainMIN_WORKERS to mainMAX_WORKERS.  The workers have
+ * scattered relative deadlines and all block until the start of the next
+ * frame of mainFRAME_LENGTH ticks, so the tick at the start of each frame
+ * releases every worker and adds it to the EDF ready queue.
+ *
+ * The benchmark task wakes one tick before the start of each frame and times
+ * the tick that releases the workers, then the following tick, which releases
+ * none, using vPortSimulateExecution(1) to process each tick in its own
+ * thread.  For each number of workers it prints the median of the release
+ * tick, the median of the quiet tick, and the cost per released worker, which
+ * is their difference divided by the number of workers.
+ *
+ * The benchmark needs the ticks to be processed synchronously, so it only runs
+ * in virtual time ("make DEMO=benchmark" selects it).
+ ******************************************************************************/
+
+/* Standard includes. */
+#include <stdlib.h>
+#include <time.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Demo includes. */
+#include "console.h"
+
+/* The range of the number of workers, which doubles at each step. */
+#define mainMIN_WORKERS					( 8 )
+#define mainMAX_WORKERS					( 512 )
+
+/* The workers are released at the start of each frame. */
+#define mainFRAME_LENGTH				( ( TickType_t ) 1000 )
+
+/* The number of frames measured for each number of workers. */
+#define mainROUNDS						( 64 )
+
+/* The relative deadlines of the workers are scattered over this range, so
+they are added to the ready queue in no particular deadline order.  They are
+kept shorter than the frame so every worker has run and blocked again before
+the next frame starts. */
+#define mainWORKER_MIN_DEADLINE			( ( TickType_t ) 10 )
+#define mainWORKER_DEADLINE_RANGE		( ( TickType_t ) 180 )
+
+/* The benchmark task has the shortest period, so it is never preempted by the
+workers it releases. */
+#define mainBENCHMARK_PERIOD			( ( TickType_t ) 1 )
+
+#define mainBENCHMARK_PRIORITY			( tskIDLE_PRIORITY + 2 )
+#define mainWORKER_PRIORITY				( tskIDLE_PRIORITY + 1 )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The tasks, see the comments at the top of this file.
+ */
+static void prvBenchmarkTask( void *pvParameters );
+static void prvWorkerTask( void *pvParameters );
+
+/*
+ * Block the calling task until xTicksBeforeFrame ticks before the start of the
+ * next frame.
+ */
+static void prvDelayUntilFrame( TickType_t xTicksBeforeFrame );
+
+/*
+ * Process one tick in the calling task and return the time it took in
+ * nanoseconds.
+ */
+static uint64_t prvTimeTick( void );
+
+/*
+ * Return the median of the xCount values in pullValues, which are sorted in
+ * place.
+ */
+static uint64_t prvMedian( uint64_t *pullValues, size_t xCount );
+static int prvCompareValues( const void *pvA, const void *pvB );
+
+/*-----------------------------------------------------------*/
+
+/* Set to non-zero if the benchmark could not be run. */
+static int iErrors = 0;
+
+/*-----------------------------------------------------------*/
+
+int main_benchmark( void )
+{
+	#if( configUSE_VIRTUAL_TIME == 1 )
+	{
+		xTaskPeriodicCreate( prvBenchmarkTask, "Benchmark", configMINIMAL_STACK_SIZE, NULL, mainBENCHMARK_PRIORITY, NULL, mainBENCHMARK_PERIOD );
+
+		/* Returns when the benchmark task ends the scheduler. */
+		vTaskStartScheduler();
+	}
+	#else
+	{
+		vConsolePrint( "The benchmark must be built with VIRTUAL_TIME=1\n" );
+		iErrors++;
+
+		/* The benchmark task is not created. */
+		( void ) prvBenchmarkTask;
+	}
+	#endif
+
+	return iErrors;
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchmarkTask( void *pvParameters )
+{
+static uint64_t ullReleaseTick[ mainROUNDS ], ullQuietTick[ mainROUNDS ];
+UBaseType_t uxWorkers = 0, uxTarget, uxRound;
+uint64_t ullRelease, ullQuiet;
+TickType_t xDeadline;
+
+	( void ) pvParameters;
+
+	vConsolePrint( "%8s%20s%20s%20s\n", "Workers", "Release tick (ns)", "Per worker (ns)", "Quiet tick (ns)" );
+
+	for( uxTarget = mainMIN_WORKERS; uxTarget <= mainMAX_WORKERS; uxTarget <<= 1 )
+	{
+		while( uxWorkers < uxTarget )
+		{
+			xDeadline = mainWORKER_MIN_DEADLINE + ( ( TickType_t ) uxWorkers * 37U ) % mainWORKER_DEADLINE_RANGE;
+
+			if( xTaskPeriodicCreate( prvWorkerTask, "Worker", configMINIMAL_STACK_SIZE, NULL, mainWORKER_PRIORITY, NULL, xDeadline ) != pdPASS )
+			{
+				vConsolePrint( "Could not create worker %lu\n", ( unsigned long ) uxWorkers );
+				iErrors++;
+				vTaskEndScheduler();
+			}
+
+			uxWorkers++;
+		}
+
+		/* Let the new workers run so they block until the next frame. */
+		prvDelayUntilFrame( 1 );
+
+		for( uxRound = 0; uxRound < mainROUNDS; uxRound++ )
+		{
+			ullReleaseTick[ uxRound ] = prvTimeTick();
+			ullQuietTick[ uxRound ] = prvTimeTick();
+
+			prvDelayUntilFrame( 1 );
+		}
+
+		ullRelease = prvMedian( ullReleaseTick, mainROUNDS );
+		ullQuiet = prvMedian( ullQuietTick, mainROUNDS );
+
+		vConsolePrint( "%8lu%20llu%20llu%20llu\n", ( unsigned long ) uxWorkers, ( unsigned long long ) ullRelease, ( unsigned long long ) ( ( ullRelease > ullQuiet ) ? ( ullRelease - ullQuiet ) / uxWorkers : 0 ), ( unsigned long long ) ullQuiet );
+	}
+
+	vTaskEndScheduler();
+}
+/*-----------------------------------------------------------*/
+
+static void prvWorkerTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		prvDelayUntilFrame( 0 );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvDelayUntilFrame( TickType_t xTicksBeforeFrame )
+{
+TickType_t xNow, xWakeTime;
+
+	xNow = xTaskGetTickCount();
+	xWakeTime = ( ( xNow / mainFRAME_LENGTH ) + 1 ) * mainFRAME_LENGTH - xTicksBeforeFrame;
+
+	if( xWakeTime <= xNow )
+	{
+		xWakeTime += mainFRAME_LENGTH;
+	}
+
+	vTaskDelay( xWakeTime - xNow );
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvTimeTick( void )
+{
+struct timespec xStart, xEnd;
+
+	( void ) clock_gettime( CLOCK_MONOTONIC, &xStart );
+	vPortSimulateExecution( 1 );
+	( void ) clock_gettime( CLOCK_MONOTONIC, &xEnd );
+
+	return ( uint64_t ) ( ( int64_t ) ( xEnd.tv_sec - xStart.tv_sec ) * 1000000000LL + ( int64_t ) ( xEnd.tv_nsec - xStart.tv_nsec ) );
+}
+/*-----------------------------------------------------------*/
+
+static int prvCompareValues( const void *pvA, const void *pvB )
+{
+uint64_t ullA = *( const uint64_t * ) pvA, ullB = *( const uint64_t * ) pvB;
+
+	return ( ullA > ullB ) - ( ullA < ullB );
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvMedian( uint64_t *pullValues, size_t xCount )
+{
+	qsort( pullValues, xCount, sizeof( uint64_t ), prvCompareValues );
+
+	return pullValues[ xCount / 2 ];
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,1350 @@
+/*
+ * FreeRTOS Kernel V10.3.0
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/******************************************************************************
+ * The EDF demo task set.
+ *
+ * Creates the six tasks of
+ * Demo/ARM7_LPC2129_Keil_RVDS/Starter_Files_V1/source/main.c with the same
+ * periods, with the board I/O replaced by simulated equivalents:
+ *
+ * Button 1 and Button 2 monitors:  Send a string to the queue on every edge of
+ * a simulated button derived from the tick count.  Rather than polling the
+ * buttons every 50 ticks, as on the board, the monitors are sporadic tasks
+ * created with xTaskSporadicCreate().  vEDFDemoTickHook() samples the buttons
+ * from the tick interrupt and gives a notification to a monitor on each edge,
+ * which releases a job.  The 50 ticks are the minimum inter-arrival time of the
+ * jobs.
+ *
+ * Periodic transmitter (period 100):  Sends a string to the queue.
+ *
+ * UART receiver:  Blocks on the queue and writes each string it receives to
+ * the console.  Rather than polling the queue every 20 ticks, as on the board,
+ * the receiver is created with xTaskServerCreate() so it runs whenever a string
+ * is available, with a budget of mainRECEIVER_BUDGET ticks in every 20.
+ *
+ * Load 1 (period 10) and Load 2 (period 100):  Consume 5 and 12 ticks of
+ * execution time respectively, as the empty loops on the board do.
+ *
+ * Load 2 must complete each job within half its period, and is created with a
+ * phase so its first job is not released at the same time as those of the
+ * other tasks.
+ *
+ * The last ticks of each job of both loads are spent updating a simulated
+ * resource they share, guarded by a mutex.  Load 2 inherits the deadline of
+ * Load 1 while Load 1 is blocked on the mutex, so Load 1 can only be blocked
+ * for as long as Load 2 holds the mutex, which is declared as the blocking time
+ * of Load 1 and included in the admission test.
+ *
+ * Every other task ends each job with xTaskJobComplete(), which releases the
+ * next job at the period given when the task was created, and counts the jobs
+ * it completes and the jobs that complete after their deadline.  The receiver
+ * counts the strings it receives as its jobs.
+ *
+ * When configUSE_EDF_ADMISSION_CONTROL is 1 the demo also tries to create two
+ * tasks the admission test must refuse, one that would overload the processor
+ * and one that would fit within the processor but could not meet its deadline.
+ *
+ * If mainLOAD_2_OVERRUN_TICKS is set above 0, for example with
+ * "make CFLAGS_EXTRA=-DmainLOAD_2_OVERRUN_TICKS=30", every
+ * mainLOAD_2_OVERRUN_INTERVAL-th job of Load 2 executes for that many ticks
+ * more than its budget.  Load 2 is then demoted to the background when it
+ * exhausts its budget, so its overruns must not make any other task miss a
+ * deadline.  mainLOAD_2_OVERRUN_POLICY can select another overrun policy, with
+ * which the other tasks only meet their deadlines if the policy also stops
+ * Load 2 running, as eOverrunAbortJob does.  When the demo runs in real time
+ * the host can also take the processor from a job while it is running, so a
+ * few budget overruns can be counted without mainLOAD_2_OVERRUN_TICKS.
+ *
+ * When configUSE_TICKLESS_IDLE is 1 the idle task suppresses the tick until the
+ * next job release or the next edge of a button, and the number of tick
+ * interrupts that were avoided is printed with the results.  The same is
+ * printed when configUSE_EVENT_DRIVEN_TICK is 1, in which case a tick interrupt
+ * is only taken when the kernel or a button has an event due, whichever task is
+ * running.
+ *
+ * When configUSE_EDF_HYBRID_SCHEDULING is 1 a deferred interrupt handler is
+ * added above the task set, in the fixed priority band.  vEDFDemoTickHook()
+ * simulates an interrupt every mainDEFERRED_INTERVAL ticks and defers its
+ * processing to the handler, which must run in the tick the interrupt occurred
+ * in whichever job is running.
+ *
+ * When configUSE_EDF_MODE_CHANGE is 1 the check task moves the task set into a
+ * transient mode after mainTRANSIENT_MODE_START ticks, in which Load 2 runs
+ * twice as often and the transmitter half as often, and back again after
+ * mainTRANSIENT_MODE_END ticks.  Each mode change is made with
+ * xTaskSetTimingGroup(), which applies the changes between jobs, so no task
+ * may miss a deadline while the modes change.  With admission control a
+ * change that would overload the processor must also be refused.  The modes
+ * are not changed when mainLOAD_2_OVERRUN_TICKS is above 0, as the transient
+ * mode leaves too little idle time for a demoted job of Load 2 to complete
+ * before its next job is due.
+ *
+ * When configUSE_TIMERS is 1 an auto-reload software timer expires every
+ * mainTIMER_PERIOD ticks, and the check task pends a function call to the
+ * timer service task at the end of each of its periods.  The timer service
+ * task is a constant bandwidth server, or a task of the fixed priority band when
+ * configUSE_EDF_HYBRID_SCHEDULING is 1, so the callbacks must run within
+ * mainTIMER_MAX_LATENCY ticks of when they are due without any task missing a
+ * deadline.
+ *
+ * A sporadic probe task checks that a job that arrives before the minimum
+ * inter-arrival time of a sporadic task has passed is not released until it
+ * has.  Every mainPROBE_CYCLE ticks the check task gives the probe a job, then
+ * a second job sooner than the minimum inter-arrival time of the probe allows,
+ * alternately itself and through vEDFDemoTickHook().  The second job must not
+ * start until the minimum inter-arrival time has passed since the first
+ * arrived.
+ *
+ * A check task makes sure every task is still completing jobs once every
+ * mainCHECK_INTERVAL ticks.  After mainRUN_TIME_TICKS ticks it prints the
+ * counts, the overruns counted by the kernel and the run time statistics, then
+ * ends the scheduler so main_edf() returns.  When configUSE_EDF_TASK_STATISTICS
+ * is 1 it also prints the statistics the kernel kept of the jobs of each
+ * periodic task, obtained with uxTaskGetSystemState(), which must agree with
+ * the counts kept by the tasks.  When configUSE_EDF_UTILISATION_MONITOR is 1
+ * it prints the utilisation the kernel measured of each task and of the
+ * processor beside the utilisation declared by the timing of each task, which
+ * no task that keeps to its budget may exceed.
+ ******************************************************************************/
+
+/* Standard includes. */
+#include <stdio.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "timers.h"
+
+/* Demo includes. */
+#include "console.h"
+
+/* Task periods, the same as on the board.  The periods of the buttons are
+the minimum inter-arrival times of the button edges. */
+#define mainBUTTON_1_PERIOD				( ( TickType_t ) 50 )
+#define mainBUTTON_2_PERIOD				( ( TickType_t ) 50 )
+#define mainTRANSMITTER_PERIOD			( ( TickType_t ) 100 )
+#define mainRECEIVER_PERIOD				( ( TickType_t ) 20 )
+#define mainLOAD_1_PERIOD				( ( TickType_t ) 10 )
+#define mainLOAD_2_PERIOD				( ( TickType_t ) 100 )
+#define mainCHECK_PERIOD				( ( TickType_t ) 100 )
+
+/* The relative deadlines that are shorter than the periods. */
+#define mainLOAD_2_DEADLINE				( ( TickType_t ) 50 )
+
+/* The offsets of the first releases from the start of the scheduler. */
+#define mainLOAD_2_PHASE				( ( TickType_t ) 5 )
+#define mainCHECK_INTERVAL				( ( TickType_t ) 1000 )
+
+/* The budget of the receiver in each of its periods. */
+#define mainRECEIVER_BUDGET				( ( TickType_t ) 2 )
+
+/* The execution time of the load tasks. */
+#define mainLOAD_1_EXECUTION_TICKS		( ( TickType_t ) 5 )
+#define mainLOAD_2_EXECUTION_TICKS		( ( TickType_t ) 12 )
+
+/* The ticks at the end of each job of the load tasks that are spent holding
+the mutex.  Load 1 can be blocked for as long as Load 2 holds it. */
+#define mainLOAD_1_CRITICAL_TICKS		( ( TickType_t ) 1 )
+#define mainLOAD_2_CRITICAL_TICKS		( ( TickType_t ) 3 )
+#define mainLOAD_1_BLOCKING_TICKS		mainLOAD_2_CRITICAL_TICKS
+
+/* The execution time budgets of the load tasks.  One tick more than the
+execution time is allowed for the time the tick interrupt and context switches
+take from each job when the demo runs in real time. */
+#define mainLOAD_1_BUDGET_TICKS			( mainLOAD_1_EXECUTION_TICKS + 1 )
+#define mainLOAD_2_BUDGET_TICKS			( mainLOAD_2_EXECUTION_TICKS + 1 )
+
+/* The extra execution time of the overrunning jobs of Load 2, see the
+comments at the top of this file. */
+#ifndef mainLOAD_2_OVERRUN_TICKS
+	#define mainLOAD_2_OVERRUN_TICKS	( ( TickType_t ) 0 )
+#endif
+#define mainLOAD_2_OVERRUN_INTERVAL		( 5UL )
+#ifndef mainLOAD_2_OVERRUN_POLICY
+	#define mainLOAD_2_OVERRUN_POLICY	eOverrunDemote
+#endif
+
+/* The simulated buttons are pressed for the first part of each cycle. */
+#define mainBUTTON_1_CYCLE				( ( TickType_t ) 400 )
+#define mainBUTTON_1_PRESSED			( ( TickType_t ) 150 )
+#define mainBUTTON_2_CYCLE				( ( TickType_t ) 700 )
+#define mainBUTTON_2_PRESSED			( ( TickType_t ) 300 )
+
+/* The number of ticks the demo runs for before the scheduler is ended.  Can
+be overridden from the make command line, and can be more than the tick count
+can hold. */
+#ifndef mainRUN_TIME_TICKS
+	#define mainRUN_TIME_TICKS			( 5000UL )
+#endif
+
+#define mainTASK_PRIORITY				( tskIDLE_PRIORITY + 2 )
+
+/* The deferred interrupt handler runs above the EDF band, see the comments at
+the top of this file.  The interval is a power of two so the interrupts stay
+evenly spaced when the tick count wraps. */
+#define mainDEFERRED_PRIORITY			( configMAX_PRIORITIES - 1 )
+#define mainDEFERRED_INTERVAL			( ( TickType_t ) 32 )
+
+/* The period of the software timer, and the most ticks a timer callback or
+pended function can run after it is due.  The server runs them by the end of
+its period, the fixed priority band in the tick they are due.  When the demo
+runs in real time the host can delay them into the next tick. */
+#define mainTIMER_PERIOD				( ( TickType_t ) 30 )
+#ifdef configTIMER_TASK_BUDGET
+	#define mainTIMER_MAX_LATENCY		configTIMER_TASK_PERIOD
+#else
+	#define mainTIMER_MAX_LATENCY		( ( TickType_t ) ( configUSE_VIRTUAL_TIME == 0 ) )
+#endif
+
+/* The ticks after which the check task changes mode, multiples of the period
+of the check task.  See the comments at the top of this file. */
+#define mainTRANSIENT_MODE_START		( 2000UL )
+#define mainTRANSIENT_MODE_END			( 3500UL )
+#define mainNUMBER_OF_MODE_TASKS		( 2 )
+
+/* The minimum inter-arrival time of the jobs of the sporadic probe, and the
+ticks into each cycle of the check task at which a job arrives on time, a job
+arrives early and the start of the early job is checked. */
+#define mainPROBE_MIN_INTER_ARRIVAL		( ( TickType_t ) 150 )
+#define mainPROBE_CYCLE					( 400UL )
+#define mainPROBE_ARRIVAL				( 100UL )
+#define mainPROBE_EARLY_ARRIVAL			( 200UL )
+#define mainPROBE_CHECK					( 0UL )
+
+/* Writing every received string to the console is only useful when the demo
+runs in real time. */
+#ifndef mainPRINT_RECEIVED_STRINGS
+	#define mainPRINT_RECEIVED_STRINGS	( configUSE_VIRTUAL_TIME == 0 )
+#endif
+
+#define mainQUEUE_LENGTH				( 10 )
+#define mainSTATS_BUFFER_SIZE			( 1024 )
+
+/* Room for the state of every task in the demo, including those of the
+kernel. */
+#define mainMAX_TASK_STATUSES			( 16 )
+
+/* A utilisation returned by the kernel in tenths of a percent, and the most by
+which utilisations measured by the kernel can differ from each other because
+of rounding. */
+#define mainPER_MILLE( ulUtilisation )	( ( ( ulUtilisation ) * 1000UL ) / tskEDF_FULL_UTILISATION )
+#define mainUTILISATION_ROUNDING		( tskEDF_FULL_UTILISATION / 1000UL )
+
+/* Indexes into xDemoTasks[]. */
+#define mainBUTTON_1_TASK				( 0 )
+#define mainBUTTON_2_TASK				( 1 )
+#define mainTRANSMITTER_TASK			( 2 )
+#define mainRECEIVER_TASK				( 3 )
+#define mainLOAD_1_TASK					( 4 )
+#define mainLOAD_2_TASK					( 5 )
+#define mainNUMBER_OF_TASKS				( 6 )
+#define mainNUMBER_OF_REFUSED_TASKS		( 2 )
+
+/*-----------------------------------------------------------*/
+
+/* The state kept for each task of the set. */
+typedef struct DEMO_TASK
+{
+	const char *pcName;				/*< The name of the task. */
+	TaskFunction_t pxTaskCode;		/*< The function that implements the task. */
+	TaskPeriodicParameters_t xTiming;	/*< The period, relative deadline, phase, execution time and blocking time. */
+	TaskHandle_t xHandle;			/*< The handle of the task, used to query its release jitter. */
+	volatile uint32_t ulJobs;		/*< The number of jobs completed. */
+	volatile uint32_t ulMisses;		/*< The number of jobs completed after their deadline. */
+	volatile uint32_t ulBlocked;	/*< The number of jobs that found the mutex held by the other load. */
+} DemoTask_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The tasks of the set, see the comments at the top of this file.
+ */
+static void prvButton1Task( void *pvParameters );
+static void prvButton2Task( void *pvParameters );
+static void prvTransmitterTask( void *pvParameters );
+static void prvReceiverTask( void *pvParameters );
+static void prvLoad1Task( void *pvParameters );
+static void prvLoad2Task( void *pvParameters );
+static void prvCheckTask( void *pvParameters );
+static void prvProbeTask( void *pvParameters );
+
+#if( configUSE_EDF_HYBRID_SCHEDULING == 1 )
+	static void prvDeferredHandlerTask( void *pvParameters );
+#endif
+
+/*
+ * Wait for the first edge of a button then, for each edge, send a string to
+ * the queue and wait for the next.
+ */
+static void prvMonitorButton( UBaseType_t uxTask, const char * const *ppcRising, const char * const *ppcFalling );
+
+/*
+ * Simulate xTicks of execution by load task uxTask while holding the mutex
+ * that guards the resource shared by the loads.
+ */
+static void prvUseSharedResource( UBaseType_t uxTask, TickType_t xTicks );
+
+/*
+ * Return pdTRUE if the simulated button is pressed at tick xTick.
+ */
+static BaseType_t prvButtonIsPressed( TickType_t xTick, TickType_t xCycle, TickType_t xPressedTicks );
+
+/*
+ * Called from the tick hook in main.c.  Samples the simulated buttons and
+ * releases a job of a button monitor on each edge, and simulates the interrupt
+ * of the deferred interrupt handler.
+ */
+void vEDFDemoTickHook( void );
+
+/*
+ * Called by the kernel before the idle task suppresses the tick, when
+ * configUSE_TICKLESS_IDLE is 1, and before the ticks up to the next event are
+ * stepped over, when configUSE_EVENT_DRIVEN_TICK is 1.  Returns the expected
+ * idle time shortened so the tick at the next edge of a button, or of the next
+ * simulated interrupt, is not suppressed.
+ */
+unsigned long ulEDFDemoLimitIdleTime( unsigned long ulExpectedIdleTime );
+
+/*
+ * Return the number of ticks from xTick to the next edge of a simulated
+ * button.
+ */
+static TickType_t prvTicksToNextEdge( TickType_t xTick, TickType_t xCycle, TickType_t xPressedTicks );
+
+/*
+ * Complete the current job of task uxTask, noting whether it completed after
+ * its deadline, and wait for the release of the next job.
+ */
+static void prvJobCompleted( UBaseType_t uxTask );
+
+/*
+ * Called by the check task at the end of each of its periods to give the
+ * sporadic probe its jobs, and to check when the early job started.
+ */
+static void prvGiveProbeJobs( uint32_t ulElapsedTicks );
+
+/*
+ * Called when the demo has run for mainRUN_TIME_TICKS ticks to print the
+ * results.
+ */
+static void prvPrintResults( void );
+
+#if( configUSE_EDF_TASK_STATISTICS == 1 )
+
+	/*
+	 * Called by prvPrintResults() to print the statistics the kernel kept of
+	 * the jobs of each periodic task, and to check them against the counts
+	 * kept by the tasks of the set.
+	 */
+	static void prvPrintJobStatistics( void );
+
+#endif
+
+#if( configUSE_EDF_UTILISATION_MONITOR == 1 )
+
+	/*
+	 * Called by prvPrintResults() to print the utilisation the kernel
+	 * measured of each task of the set, and of the processor, and to check
+	 * them against the utilisations declared by the timing of the tasks.
+	 */
+	static void prvPrintUtilisation( void );
+
+#endif
+
+#if( configUSE_TIMERS == 1 )
+
+	/*
+	 * The callback of the software timer, and the function the check task
+	 * pends, which is passed the tick it was pended at.  Both record how late
+	 * they run.
+	 */
+	static void prvTimerCallback( TimerHandle_t xTimer );
+	static void prvPendedFunction( void *pvParameter1, uint32_t ulParameter2 );
+
+	/*
+	 * Note the latency of a timer callback or pended function that was due at
+	 * xDueTick.
+	 */
+	static void prvRecordTimerLatency( TickType_t xDueTick );
+
+#endif
+
+#if( configUSE_EDF_MODE_CHANGE == 1 )
+
+	/*
+	 * Called by the check task at the end of each of its periods to move the
+	 * task set into or out of the transient mode when it is time to.
+	 */
+	static void prvChangeMode( uint32_t ulElapsedTicks );
+
+#endif
+
+/*-----------------------------------------------------------*/
+
+static DemoTask_t xDemoTasks[ mainNUMBER_OF_TASKS ] =
+{
+	{ "Button_1_Monitor",		prvButton1Task,		{ mainBUTTON_1_PERIOD,		mainBUTTON_1_PERIOD,	0,					0,							0 }, NULL, 0, 0, 0 },
+	{ "Button_2_Monitor",		prvButton2Task,		{ mainBUTTON_2_PERIOD,		mainBUTTON_2_PERIOD,	0,					0,							0 }, NULL, 0, 0, 0 },
+	{ "Periodic_Transmitter",	prvTransmitterTask,	{ mainTRANSMITTER_PERIOD,	mainTRANSMITTER_PERIOD,	0,					0,							0 }, NULL, 0, 0, 0 },
+	{ "Uart_Receiver",			prvReceiverTask,	{ mainRECEIVER_PERIOD,		mainRECEIVER_PERIOD,	0,					mainRECEIVER_BUDGET,		0 }, NULL, 0, 0, 0 },
+	{ "Load_1_Simulation",		prvLoad1Task,		{ mainLOAD_1_PERIOD,		mainLOAD_1_PERIOD,		0,					mainLOAD_1_BUDGET_TICKS,	mainLOAD_1_BLOCKING_TICKS }, NULL, 0, 0, 0 },
+	{ "Load_2_Simulation",		prvLoad2Task,		{ mainLOAD_2_PERIOD,		mainLOAD_2_DEADLINE,	mainLOAD_2_PHASE,	mainLOAD_2_BUDGET_TICKS,	0 }, NULL, 0, 0, 0 }
+};
+
+
+#if( configUSE_EDF_ADMISSION_CONTROL == 1 )
+
+	/* The timing of tasks that cannot be added to the set.  The first needs
+	more than the processor time Load 1 leaves, the second needs 8 ticks within
+	12 ticks of its release, when Load 1 can also need 6. */
+	static const TaskPeriodicParameters_t xRefusedTiming[ mainNUMBER_OF_REFUSED_TASKS ] =
+	{
+		{ 10,	10,	0,	6,	0 },
+		{ 100,	12,	0,	8,	0 }
+	};
+
+#endif /* configUSE_EDF_ADMISSION_CONTROL */
+
+/* The queue used to pass strings to the receiver task. */
+static QueueHandle_t xQueue = NULL;
+
+/* The mutex that guards the resource shared by the load tasks. */
+static SemaphoreHandle_t xMutex = NULL;
+
+/* Incremented each time the check task finds an error. */
+static volatile int iErrors = 0;
+
+/* The sporadic probe, the tick its last on time job arrived at and the number
+of jobs it had completed then, the tick its last job started at, the number of
+jobs it has completed, the number of early jobs checked, and set when the tick
+interrupt is to give it the next job. */
+static TaskHandle_t xProbe = NULL;
+static TickType_t xProbeArrivalTick = 0;
+static uint32_t ulProbeJobsAtArrival = 0;
+static volatile TickType_t xProbeJobStart = 0;
+static volatile uint32_t ulProbeJobs = 0;
+static uint32_t ulProbeChecks = 0;
+static volatile BaseType_t xProbeArrivalFromISR = pdFALSE;
+
+#if( configUSE_TIMERS == 1 )
+
+	/* The number of timer callbacks and pended functions run, and the most
+	ticks one of them ran after it was due. */
+	static volatile uint32_t ulTimerCallbacks = 0;
+	static volatile uint32_t ulPendedFunctions = 0;
+	static volatile TickType_t xTimerMaxLatency = 0;
+
+#endif /* configUSE_TIMERS */
+
+#if( configUSE_EDF_HYBRID_SCHEDULING == 1 )
+
+	/* The deferred interrupt handler, the tick of the last simulated
+	interrupt, the number of interrupts handled and the most ticks the handler
+	took to start handling one. */
+	static TaskHandle_t xDeferredHandler = NULL;
+	static volatile TickType_t xDeferredInterruptTick = 0;
+	static volatile uint32_t ulDeferredHandled = 0;
+	static volatile TickType_t xDeferredMaxLatency = 0;
+
+#endif /* configUSE_EDF_HYBRID_SCHEDULING */
+
+#if( configUSE_EDF_MODE_CHANGE == 1 )
+
+	/* The tasks that change timing in the transient mode, and their timing in
+	that mode.  Load 2 needs more processor time, which the transmitter gives
+	up. */
+	static const UBaseType_t uxModeTasks[ mainNUMBER_OF_MODE_TASKS ] = { mainLOAD_2_TASK, mainTRANSMITTER_TASK };
+	static const TaskPeriodicParameters_t xTransientTiming[ mainNUMBER_OF_MODE_TASKS ] =
+	{
+		{ mainLOAD_2_PERIOD / 2,			mainLOAD_2_DEADLINE,		0,	mainLOAD_2_BUDGET_TICKS,	0 },
+		{ mainTRANSMITTER_PERIOD * 2,	mainTRANSMITTER_PERIOD * 2,	0,	0,							0 }
+	};
+
+	#if( configUSE_EDF_ADMISSION_CONTROL == 1 )
+
+		/* Load 2 cannot run this often beside Load 1. */
+		static const TaskPeriodicParameters_t xRefusedModeTiming = { mainLOAD_2_PERIOD / 5, mainLOAD_2_PERIOD / 5, 0, mainLOAD_2_BUDGET_TICKS, 0 };
+
+	#endif
+
+	/* The number of mode changes accepted. */
+	static uint32_t ulModeChanges = 0;
+
+#endif /* configUSE_EDF_MODE_CHANGE */
+
+/*-----------------------------------------------------------*/
+
+int main_edf( void )
+{
+UBaseType_t uxTask;
+BaseType_t xReturned;
+
+	xQueue = xQueueCreate( mainQUEUE_LENGTH, sizeof( const char * ) );
+	configASSERT( xQueue );
+
+	xMutex = xSemaphoreCreateMutex();
+	configASSERT( xMutex );
+
+	for( uxTask = 0; uxTask < mainNUMBER_OF_TASKS; uxTask++ )
+	{
+		if( ( uxTask == mainBUTTON_1_TASK ) || ( uxTask == mainBUTTON_2_TASK ) )
+		{
+			xReturned = xTaskSporadicCreate( xDemoTasks[ uxTask ].pxTaskCode, xDemoTasks[ uxTask ].pcName, configMINIMAL_STACK_SIZE, NULL, mainTASK_PRIORITY, &( xDemoTasks[ uxTask ].xHandle ), &( xDemoTasks[ uxTask ].xTiming ) );
+		}
+		else if( uxTask == mainRECEIVER_TASK )
+		{
+			xReturned = xTaskServerCreate( xDemoTasks[ uxTask ].pxTaskCode, xDemoTasks[ uxTask ].pcName, configMINIMAL_STACK_SIZE, NULL, mainTASK_PRIORITY, &( xDemoTasks[ uxTask ].xHandle ), xDemoTasks[ uxTask ].xTiming.xWorstCaseExecutionTime, xDemoTasks[ uxTask ].xTiming.xPeriod );
+		}
+		else
+		{
+			xReturned = xTaskPeriodicCreateConstrained( xDemoTasks[ uxTask ].pxTaskCode, xDemoTasks[ uxTask ].pcName, configMINIMAL_STACK_SIZE, NULL, mainTASK_PRIORITY, &( xDemoTasks[ uxTask ].xHandle ), &( xDemoTasks[ uxTask ].xTiming ) );
+		}
+
+		configASSERT( xReturned == pdPASS );
+	}
+
+	xReturned = xTaskPeriodicCreate( prvCheckTask, "Check", configMINIMAL_STACK_SIZE, NULL, mainTASK_PRIORITY, NULL, mainCHECK_PERIOD );
+	configASSERT( xReturned == pdPASS );
+
+	{
+	static const TaskPeriodicParameters_t xProbeTiming = { mainPROBE_MIN_INTER_ARRIVAL, mainPROBE_MIN_INTER_ARRIVAL, 0, 0, 0 };
+
+		xReturned = xTaskSporadicCreate( prvProbeTask, "Probe", configMINIMAL_STACK_SIZE, NULL, mainTASK_PRIORITY, &xProbe, &xProbeTiming );
+		configASSERT( xReturned == pdPASS );
+	}
+
+	#if( configUSE_EDF_HYBRID_SCHEDULING == 1 )
+	{
+		/* The handler has no deadline, and is created above
+		configEDF_MAX_PRIORITY so it is scheduled by its priority rather than
+		in the background. */
+		xReturned = xTaskBackgroundCreate( prvDeferredHandlerTask, "Deferred_Handler", configMINIMAL_STACK_SIZE, NULL, mainDEFERRED_PRIORITY, &xDeferredHandler );
+		configASSERT( xReturned == pdPASS );
+	}
+	#endif /* configUSE_EDF_HYBRID_SCHEDULING */
+
+	#if( configUSE_TIMERS == 1 )
+	{
+	TimerHandle_t xTimer;
+
+		/* The timer starts when the scheduler does. */
+		xTimer = xTimerCreate( "Timer", mainTIMER_PERIOD, pdTRUE, NULL, prvTimerCallback );
+		configASSERT( xTimer );
+		xReturned = xTimerStart( xTimer, 0 );
+		configASSERT( xReturned == pdPASS );
+	}
+	#endif /* configUSE_TIMERS */
+
+	/* Load 2 must not hold up the other tasks when it overruns. */
+	vTaskSetOverrunPolicy( xDemoTasks[ mainLOAD_2_TASK ].xHandle, mainLOAD_2_OVERRUN_POLICY );
+
+	#if( configUSE_EDF_ADMISSION_CONTROL == 1 )
+	{
+		for( uxTask = 0; uxTask < mainNUMBER_OF_REFUSED_TASKS; uxTask++ )
+		{
+			xReturned = xTaskPeriodicCreateConstrained( prvLoad1Task, "Refused", configMINIMAL_STACK_SIZE, NULL, mainTASK_PRIORITY, NULL, &( xRefusedTiming[ uxTask ] ) );
+
+			if( xReturned != errTASK_SET_NOT_SCHEDULABLE )
+			{
+				vConsolePrint( "ERROR: the admission test accepted task %lu\n", ( unsigned long ) uxTask );
+				iErrors++;
+			}
+		}
+	}
+	#endif /* configUSE_EDF_ADMISSION_CONTROL */
+
+	/* Returns when the check task ends the scheduler. */
+	vTaskStartScheduler();
+
+	return iErrors;
+}
+/*-----------------------------------------------------------*/
+
+static void prvJobCompleted( UBaseType_t uxTask )
+{
+	xDemoTasks[ uxTask ].ulJobs++;
+
+	if( xTaskJobComplete() != pdPASS )
+	{
+		xDemoTasks[ uxTask ].ulMisses++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvButtonIsPressed( TickType_t xTick, TickType_t xCycle, TickType_t xPressedTicks )
+{
+	return ( ( xTick % xCycle ) < xPressedTicks ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void vEDFDemoTickHook( void )
+{
+static BaseType_t xPressed[ 2 ] = { pdFALSE, pdFALSE };
+BaseType_t xPressedNow[ 2 ], xHigherPriorityTaskWoken = pdFALSE;
+TickType_t xTick;
+UBaseType_t uxButton;
+
+	/* The hook is also called when main_edf() is not the selected
+	application. */
+	if( xDemoTasks[ mainBUTTON_2_TASK ].xHandle != NULL )
+	{
+		xTick = xTaskGetTickCountFromISR();
+		xPressedNow[ 0 ] = prvButtonIsPressed( xTick, mainBUTTON_1_CYCLE, mainBUTTON_1_PRESSED );
+		xPressedNow[ 1 ] = prvButtonIsPressed( xTick, mainBUTTON_2_CYCLE, mainBUTTON_2_PRESSED );
+
+		for( uxButton = 0; uxButton < 2; uxButton++ )
+		{
+			if( xPressedNow[ uxButton ] != xPressed[ uxButton ] )
+			{
+				/* The tasks of the buttons are at indexes 0 and 1. */
+				vTaskNotifyGiveFromISR( xDemoTasks[ uxButton ].xHandle, &xHigherPriorityTaskWoken );
+				xPressed[ uxButton ] = xPressedNow[ uxButton ];
+			}
+		}
+
+		/* Give the probe the early job the check task left to the tick
+		interrupt. */
+		if( xProbeArrivalFromISR != pdFALSE )
+		{
+			xProbeArrivalFromISR = pdFALSE;
+			vTaskNotifyGiveFromISR( xProbe, &xHigherPriorityTaskWoken );
+		}
+
+		#if( configUSE_EDF_HYBRID_SCHEDULING == 1 )
+		{
+			if( ( xTick % mainDEFERRED_INTERVAL ) == 0 )
+			{
+				xDeferredInterruptTick = xTick;
+				vTaskNotifyGiveFromISR( xDeferredHandler, &xHigherPriorityTaskWoken );
+			}
+		}
+		#endif /* configUSE_EDF_HYBRID_SCHEDULING */
+
+		/* The tick switches context if a button monitor now has the earliest
+		deadline, or to the deferred interrupt handler. */
+		( void ) xHigherPriorityTaskWoken;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static TickType_t prvTicksToNextEdge( TickType_t xTick, TickType_t xCycle, TickType_t xPressedTicks )
+{
+TickType_t xPosition = xTick % xCycle, xTicks;
+
+	if( xPosition < xPressedTicks )
+	{
+		xTicks = xPressedTicks - xPosition;
+	}
+	else
+	{
+		xTicks = xCycle - xPosition;
+	}
+
+	/* The tick count does not wrap at a multiple of the cycle, so the button
+	can also change state when it wraps. */
+	if( ( TickType_t ) ( ( TickType_t ) 0 - xTick ) < xTicks )
+	{
+		xTicks = ( TickType_t ) 0 - xTick;
+	}
+
+	return xTicks;
+}
+/*-----------------------------------------------------------*/
+
+unsigned long ulEDFDemoLimitIdleTime( unsigned long ulExpectedIdleTime )
+{
+TickType_t xTick, xTicks;
+
+	/* As vEDFDemoTickHook(). */
+	if( xDemoTasks[ mainBUTTON_2_TASK ].xHandle != NULL )
+	{
+		/* Called with the scheduler suspended, or from the tick interrupt. */
+		xTick = xTaskGetTickCountFromISR();
+		xTicks = prvTicksToNextEdge( xTick, mainBUTTON_1_CYCLE, mainBUTTON_1_PRESSED );
+
+		if( prvTicksToNextEdge( xTick, mainBUTTON_2_CYCLE, mainBUTTON_2_PRESSED ) < xTicks )
+		{
+			xTicks = prvTicksToNextEdge( xTick, mainBUTTON_2_CYCLE, mainBUTTON_2_PRESSED );
+		}
+
+		#if( configUSE_EDF_HYBRID_SCHEDULING == 1 )
+		{
+			/* Nor is the tick of the next simulated interrupt. */
+			if( ( mainDEFERRED_INTERVAL - ( xTick % mainDEFERRED_INTERVAL ) ) < xTicks )
+			{
+				xTicks = mainDEFERRED_INTERVAL - ( xTick % mainDEFERRED_INTERVAL );
+			}
+		}
+		#endif /* configUSE_EDF_HYBRID_SCHEDULING */
+
+		/* The tick at the end of the idle period is not suppressed. */
+		if( ( unsigned long ) xTicks < ulExpectedIdleTime )
+		{
+			ulExpectedIdleTime = ( unsigned long ) xTicks;
+		}
+	}
+
+	return ulExpectedIdleTime;
+}
+/*-----------------------------------------------------------*/
+
+static void prvMonitorButton( UBaseType_t uxTask, const char * const *ppcRising, const char * const *ppcFalling )
+{
+BaseType_t xPressed = pdFALSE;
+
+	/* The first job is released when the task is created, rather than by an
+	edge, so is not counted. */
+	( void ) xTaskJobComplete();
+
+	for( ;; )
+	{
+		/* The buttons are released when the demo starts, so the edges
+		alternate between rising and falling starting with rising. */
+		xPressed = ( xPressed == pdFALSE ) ? pdTRUE : pdFALSE;
+		( void ) xQueueSend( xQueue, ( xPressed != pdFALSE ) ? ppcRising : ppcFalling, portMAX_DELAY );
+		prvJobCompleted( uxTask );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvButton1Task( void *pvParameters )
+{
+static const char * const pcRising = "Button_1_RISING\n";
+static const char * const pcFalling = "Button_1_FALLING\n";
+
+	( void ) pvParameters;
+
+	prvMonitorButton( mainBUTTON_1_TASK, &pcRising, &pcFalling );
+}
+/*-----------------------------------------------------------*/
+
+static void prvButton2Task( void *pvParameters )
+{
+static const char * const pcRising = "Button_2_RISING\n";
+static const char * const pcFalling = "Button_2_FALLING\n";
+
+	( void ) pvParameters;
+
+	prvMonitorButton( mainBUTTON_2_TASK, &pcRising, &pcFalling );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTransmitterTask( void *pvParameters )
+{
+static const char * const pcString = "periodic string\n";
+
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		( void ) xQueueSend( xQueue, &pcString, portMAX_DELAY );
+		prvJobCompleted( mainTRANSMITTER_TASK );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvReceiverTask( void *pvParameters )
+{
+const char *pcReceived;
+
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		if( xQueueReceive( xQueue, &pcReceived, portMAX_DELAY ) == pdPASS )
+		{
+			#if( mainPRINT_RECEIVED_STRINGS == 1 )
+			{
+				vConsolePrint( "%5lu: %s", ( unsigned long ) xTaskGetTickCount(), pcReceived );
+			}
+			#else
+			{
+				( void ) pcReceived;
+			}
+			#endif
+
+			xDemoTasks[ mainRECEIVER_TASK ].ulJobs++;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvUseSharedResource( UBaseType_t uxTask, TickType_t xTicks )
+{
+	if( xSemaphoreTake( xMutex, 0 ) == pdFAIL )
+	{
+		/* The other load holds the mutex, and runs with the deadline of this
+		task until it gives the mutex back. */
+		xDemoTasks[ uxTask ].ulBlocked++;
+		( void ) xSemaphoreTake( xMutex, portMAX_DELAY );
+	}
+
+	vPortSimulateExecution( xTicks );
+	( void ) xSemaphoreGive( xMutex );
+}
+/*-----------------------------------------------------------*/
+
+static void prvLoad1Task( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		vPortSimulateExecution( mainLOAD_1_EXECUTION_TICKS - mainLOAD_1_CRITICAL_TICKS );
+		prvUseSharedResource( mainLOAD_1_TASK, mainLOAD_1_CRITICAL_TICKS );
+		prvJobCompleted( mainLOAD_1_TASK );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvLoad2Task( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		vPortSimulateExecution( mainLOAD_2_EXECUTION_TICKS - mainLOAD_2_CRITICAL_TICKS );
+		prvUseSharedResource( mainLOAD_2_TASK, mainLOAD_2_CRITICAL_TICKS );
+
+		if( ( ( xDemoTasks[ mainLOAD_2_TASK ].ulJobs + 1UL ) % mainLOAD_2_OVERRUN_INTERVAL ) == 0UL )
+		{
+			vPortSimulateExecution( mainLOAD_2_OVERRUN_TICKS );
+		}
+
+		prvJobCompleted( mainLOAD_2_TASK );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckTask( void *pvParameters )
+{
+uint32_t ulLastJobs[ mainNUMBER_OF_TASKS ] = { 0 };
+UBaseType_t uxTask;
+uint32_t ulElapsedTicks = 0;
+
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		/* The checks are made at the end of each period rather than when the
+		first job is released with the other tasks. */
+		( void ) xTaskJobComplete();
+		ulElapsedTicks += mainCHECK_PERIOD;
+
+		#if( configUSE_EDF_MODE_CHANGE == 1 )
+		{
+			prvChangeMode( ulElapsedTicks );
+		}
+		#endif
+
+		prvGiveProbeJobs( ulElapsedTicks );
+
+		#if( configUSE_TIMERS == 1 )
+		{
+			if( xTimerPendFunctionCall( prvPendedFunction, NULL, ( uint32_t ) xTaskGetTickCount(), 0 ) != pdPASS )
+			{
+				vConsolePrint( "ERROR: the timer queue is full\n" );
+				iErrors++;
+			}
+		}
+		#endif
+
+		/* Every task must have completed at least one job since the last
+		check. */
+		if( ( ulElapsedTicks % mainCHECK_INTERVAL ) == 0 )
+		{
+			for( uxTask = 0; uxTask < mainNUMBER_OF_TASKS; uxTask++ )
+			{
+				if( xDemoTasks[ uxTask ].ulJobs == ulLastJobs[ uxTask ] )
+				{
+					vConsolePrint( "ERROR: %s has stopped\n", xDemoTasks[ uxTask ].pcName );
+					iErrors++;
+				}
+
+				ulLastJobs[ uxTask ] = xDemoTasks[ uxTask ].ulJobs;
+			}
+		}
+
+		if( ulElapsedTicks >= mainRUN_TIME_TICKS )
+		{
+			prvPrintResults();
+			vTaskEndScheduler();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvProbeTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	/* The first job is released when the task is created, rather than by an
+	arrival, so is not counted. */
+	( void ) xTaskJobComplete();
+
+	for( ;; )
+	{
+		xProbeJobStart = xTaskGetTickCount();
+		ulProbeJobs++;
+		( void ) xTaskJobComplete();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvGiveProbeJobs( uint32_t ulElapsedTicks )
+{
+	switch( ulElapsedTicks % mainPROBE_CYCLE )
+	{
+		case mainPROBE_ARRIVAL :
+			/* The probe has waited longer than its minimum inter-arrival time
+			for this job, so it is released when it arrives, which is no
+			earlier than now. */
+			xProbeArrivalTick = xTaskGetTickCount();
+			ulProbeJobsAtArrival = ulProbeJobs;
+			( void ) xTaskNotifyGive( xProbe );
+			break;
+
+		case mainPROBE_EARLY_ARRIVAL :
+			/* The probe completed the last job long ago and waits for this
+			one, which arrives before its minimum inter-arrival time has
+			passed. */
+			if( ( ( ulElapsedTicks / mainPROBE_CYCLE ) % 2UL ) == 0UL )
+			{
+				( void ) xTaskNotifyGive( xProbe );
+			}
+			else
+			{
+				xProbeArrivalFromISR = pdTRUE;
+			}
+			break;
+
+		case mainPROBE_CHECK :
+			/* Both jobs have completed, and the early one must not have
+			started before it could be released. */
+			if( ( ulProbeJobs != ( ulProbeJobsAtArrival + 2UL ) ) ||
+				( ( TickType_t ) ( xProbeJobStart - xProbeArrivalTick ) < mainPROBE_MIN_INTER_ARRIVAL ) )
+			{
+				vConsolePrint( "ERROR: the sporadic probe started a job %lu ticks after the last arrived\n", ( unsigned long ) ( TickType_t ) ( xProbeJobStart - xProbeArrivalTick ) );
+				iErrors++;
+			}
+
+			ulProbeChecks++;
+			break;
+
+		default :
+			break;
+	}
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_EDF_HYBRID_SCHEDULING == 1 )
+
+	static void prvDeferredHandlerTask( void *pvParameters )
+	{
+	TickType_t xLatency;
+
+		( void ) pvParameters;
+
+		for( ;; )
+		{
+			( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+			xLatency = xTaskGetTickCount() - xDeferredInterruptTick;
+
+			if( xLatency > xDeferredMaxLatency )
+			{
+				xDeferredMaxLatency = xLatency;
+			}
+
+			ulDeferredHandled++;
+		}
+	}
+
+#endif /* configUSE_EDF_HYBRID_SCHEDULING */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TIMERS == 1 )
+
+	static void prvTimerCallback( TimerHandle_t xTimer )
+	{
+		/* The timer has already been reloaded, so was due one period before
+		it next expires. */
+		prvRecordTimerLatency( xTimerGetExpiryTime( xTimer ) - mainTIMER_PERIOD );
+		ulTimerCallbacks++;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvPendedFunction( void *pvParameter1, uint32_t ulParameter2 )
+	{
+		( void ) pvParameter1;
+
+		prvRecordTimerLatency( ( TickType_t ) ulParameter2 );
+		ulPendedFunctions++;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvRecordTimerLatency( TickType_t xDueTick )
+	{
+	TickType_t xLatency;
+
+		xLatency = xTaskGetTickCount() - xDueTick;
+
+		if( xLatency > xTimerMaxLatency )
+		{
+			xTimerMaxLatency = xLatency;
+		}
+	}
+
+#endif /* configUSE_TIMERS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_EDF_MODE_CHANGE == 1 )
+
+	static void prvChangeMode( uint32_t ulElapsedTicks )
+	{
+	TaskHandle_t xTasks[ mainNUMBER_OF_MODE_TASKS ];
+	TaskPeriodicParameters_t xTiming[ mainNUMBER_OF_MODE_TASKS ];
+	UBaseType_t uxTask;
+	BaseType_t xReturned;
+
+		if( ( mainLOAD_2_OVERRUN_TICKS > 0U ) || ( ( ulElapsedTicks != mainTRANSIENT_MODE_START ) && ( ulElapsedTicks != mainTRANSIENT_MODE_END ) ) )
+		{
+			return;
+		}
+
+		#if( configUSE_EDF_ADMISSION_CONTROL == 1 )
+		{
+			if( ulElapsedTicks == mainTRANSIENT_MODE_START )
+			{
+				xReturned = xTaskSetTiming( xDemoTasks[ mainLOAD_2_TASK ].xHandle, &xRefusedModeTiming );
+
+				if( xReturned != errTASK_SET_NOT_SCHEDULABLE )
+				{
+					vConsolePrint( "ERROR: the admission test accepted a change of timing that overloads the processor\n" );
+					iErrors++;
+				}
+			}
+		}
+		#endif /* configUSE_EDF_ADMISSION_CONTROL */
+
+		/* The transient mode is left by giving the tasks back the timing they
+		were created with. */
+		for( uxTask = 0; uxTask < mainNUMBER_OF_MODE_TASKS; uxTask++ )
+		{
+			xTasks[ uxTask ] = xDemoTasks[ uxModeTasks[ uxTask ] ].xHandle;
+			xTiming[ uxTask ] = ( ulElapsedTicks == mainTRANSIENT_MODE_START ) ? xTransientTiming[ uxTask ] : xDemoTasks[ uxModeTasks[ uxTask ] ].xTiming;
+		}
+
+		xReturned = xTaskSetTimingGroup( xTasks, xTiming, mainNUMBER_OF_MODE_TASKS );
+
+		if( xReturned == pdPASS )
+		{
+			ulModeChanges++;
+		}
+		else
+		{
+			vConsolePrint( "ERROR: the change of mode was refused (%ld)\n", ( long ) xReturned );
+			iErrors++;
+		}
+	}
+
+#endif /* configUSE_EDF_MODE_CHANGE */
+/*-----------------------------------------------------------*/
+
+static void prvPrintResults( void )
+{
+static char cStatsBuffer[ mainSTATS_BUFFER_SIZE ];
+UBaseType_t uxTask;
+TaskReleaseJitter_t xJitter;
+TaskOverrunStatus_t xOverruns;
+
+	vConsolePrint( "\n%-24s%10s%10s%10s%10s%12s%10s\n", "Task", "Period", "Deadline", "Jobs", "Misses", "Max jitter", "Overruns" );
+
+	for( uxTask = 0; uxTask < mainNUMBER_OF_TASKS; uxTask++ )
+	{
+		vTaskGetReleaseJitter( xDemoTasks[ uxTask ].xHandle, &xJitter );
+		vTaskGetOverrunStatus( xDemoTasks[ uxTask ].xHandle, &xOverruns );
+		vConsolePrint( "%-24s%10lu%10lu%10lu%10lu%12lu%10lu\n", xDemoTasks[ uxTask ].pcName, ( unsigned long ) xDemoTasks[ uxTask ].xTiming.xPeriod, ( unsigned long ) xDemoTasks[ uxTask ].xTiming.xRelativeDeadline, ( unsigned long ) xDemoTasks[ uxTask ].ulJobs, ( unsigned long ) xDemoTasks[ uxTask ].ulMisses, ( unsigned long ) xJitter.xMaxJitter, ( unsigned long ) xOverruns.ulBudgetOverruns );
+
+		/* Only Load 2 is allowed to miss deadlines, and only when it is made
+		to overrun.  Every miss the kernel counts must also be reported by
+		xTaskJobComplete(), except for that of a job still running at the end
+		of the demo. */
+		if( ( xDemoTasks[ uxTask ].ulMisses != 0 ) && ( ( uxTask != mainLOAD_2_TASK ) || ( mainLOAD_2_OVERRUN_TICKS == 0 ) ) )
+		{
+			iErrors++;
+		}
+
+		if( xOverruns.ulDeadlineMisses > ( xDemoTasks[ uxTask ].ulMisses + 1UL ) )
+		{
+			vConsolePrint( "ERROR: the kernel counted %lu deadline misses of %s\n", ( unsigned long ) xOverruns.ulDeadlineMisses, xDemoTasks[ uxTask ].pcName );
+			iErrors++;
+		}
+	}
+
+	vConsolePrint( "\nLoad 1 blocked on the mutex %lu times, Load 2 %lu times\n", ( unsigned long ) xDemoTasks[ mainLOAD_1_TASK ].ulBlocked, ( unsigned long ) xDemoTasks[ mainLOAD_2_TASK ].ulBlocked );
+
+	/* The early jobs of the probe are checked once every cycle. */
+	vConsolePrint( "\nSporadic probe jobs %lu, early jobs checked %lu\n", ( unsigned long ) ulProbeJobs, ( unsigned long ) ulProbeChecks );
+
+	if( ulProbeChecks < ( mainRUN_TIME_TICKS / mainPROBE_CYCLE ) )
+	{
+		iErrors++;
+	}
+
+	#if( configUSE_EDF_TASK_STATISTICS == 1 )
+	{
+		prvPrintJobStatistics();
+	}
+	#endif
+
+	#if( configUSE_EDF_UTILISATION_MONITOR == 1 )
+	{
+		prvPrintUtilisation();
+	}
+	#endif
+
+	#if( configUSE_TICKLESS_IDLE == 1 )
+	{
+		/* The idle periods of the task set are long enough for some ticks to
+		be suppressed. */
+		vConsolePrint( "\nTick interrupts suppressed by tickless idle %lu\n", ( unsigned long ) ulPortGetSuppressedTickCount() );
+
+		if( ulPortGetSuppressedTickCount() == 0UL )
+		{
+			iErrors++;
+		}
+	}
+	#elif( configUSE_EVENT_DRIVEN_TICK == 1 )
+	{
+		/* The loads run for several ticks at a time without an event being
+		due, so ticks are stepped over while tasks run as well as while the
+		idle task does. */
+		vConsolePrint( "\nTick interrupts suppressed by the event driven tick %lu\n", ( unsigned long ) ulPortGetSuppressedTickCount() );
+
+		if( ulPortGetSuppressedTickCount() == 0UL )
+		{
+			iErrors++;
+		}
+	}
+	#endif
+
+	#if( configUSE_EDF_HYBRID_SCHEDULING == 1 )
+	{
+		/* The handler preempts any job of the task set, so handles each
+		interrupt in the tick it occurred in.  When the demo runs in real time
+		the host can delay it into the next tick. */
+		vConsolePrint( "\nDeferred interrupts handled %lu, max latency %lu ticks\n", ( unsigned long ) ulDeferredHandled, ( unsigned long ) xDeferredMaxLatency );
+
+		if( ( ulDeferredHandled == 0UL ) || ( xDeferredMaxLatency > ( TickType_t ) ( configUSE_VIRTUAL_TIME == 0 ) ) )
+		{
+			iErrors++;
+		}
+	}
+	#endif
+
+	#if( configUSE_TIMERS == 1 )
+	{
+		/* The timer expires every period of the demo but the last, and a
+		function is pended in every period of the check task but the last. */
+		vConsolePrint( "\nTimer callbacks %lu, pended functions %lu, max latency %lu ticks\n", ( unsigned long ) ulTimerCallbacks, ( unsigned long ) ulPendedFunctions, ( unsigned long ) xTimerMaxLatency );
+
+		if( ( ulTimerCallbacks < ( ( mainRUN_TIME_TICKS / mainTIMER_PERIOD ) - 1UL ) ) ||
+			( ulPendedFunctions < ( ( mainRUN_TIME_TICKS / mainCHECK_PERIOD ) - 1UL ) ) ||
+			( xTimerMaxLatency > mainTIMER_MAX_LATENCY ) )
+		{
+			iErrors++;
+		}
+	}
+	#endif
+
+	#if( configUSE_EDF_MODE_CHANGE == 1 )
+	{
+		vConsolePrint( "\nMode changes %lu\n", ( unsigned long ) ulModeChanges );
+
+		if( ulModeChanges != ( ( mainLOAD_2_OVERRUN_TICKS > 0U ) ? 0UL : 2UL ) )
+		{
+			iErrors++;
+		}
+	}
+	#endif
+
+	#if( configUSE_EDF_ADMISSION_CONTROL == 1 )
+	{
+		vConsolePrint( "\nDeclared utilisation %lu%%\n", ( unsigned long ) ( ( ulTaskGetEDFUtilisation() * 100UL ) / tskEDF_FULL_UTILISATION ) );
+	}
+	#endif
+
+	vTaskGetRunTimeStats( cStatsBuffer );
+	vConsolePrint( "\n%s\n%s\n", cStatsBuffer, ( iErrors == 0 ) ? "PASS" : "FAIL" );
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_EDF_TASK_STATISTICS == 1 )
+
+	static void prvPrintJobStatistics( void )
+	{
+	static TaskStatus_t xStatuses[ mainMAX_TASK_STATUSES ];
+	UBaseType_t uxTasks, uxTask, uxBin;
+	TaskJobStatistics_t *pxStatistics, xStatistics;
+	uint32_t ulJobs;
+
+		uxTasks = uxTaskGetSystemState( xStatuses, mainMAX_TASK_STATUSES, NULL );
+
+		/* Response times and lateness are in ticks, execution times in
+		microseconds. */
+		vConsolePrint( "\n%-24s%10s%10s%10s%16s%10s%16s\n", "Task", "Released", "Completed", "Missed", "Response", "Lateness", "Execution" );
+
+		for( uxTask = 0; uxTask < uxTasks; uxTask++ )
+		{
+			pxStatistics = &( xStatuses[ uxTask ].xJobStatistics );
+
+			if( pxStatistics->ulJobsCompleted > 0UL )
+			{
+				vConsolePrint( "%-24s%10lu%10lu%10lu%6lu/%4lu/%4lu%10ld%8lu/%7lu\n", xStatuses[ uxTask ].pcTaskName,
+							   ( unsigned long ) pxStatistics->ulJobsReleased,
+							   ( unsigned long ) pxStatistics->ulJobsCompleted,
+							   ( unsigned long ) pxStatistics->ulDeadlinesMissed,
+							   ( unsigned long ) pxStatistics->xMinResponseTime,
+							   ( unsigned long ) ( pxStatistics->ulTotalResponseTime / pxStatistics->ulJobsCompleted ),
+							   ( unsigned long ) pxStatistics->xMaxResponseTime,
+							   ( long ) pxStatistics->lMaxLateness,
+							   ( unsigned long ) ( pxStatistics->ulTotalExecutionTime / pxStatistics->ulJobsCompleted ),
+							   ( unsigned long ) pxStatistics->ulMaxExecutionTime );
+			}
+		}
+
+		#if( configEDF_RESPONSE_TIME_HISTOGRAM_BINS > 0 )
+		{
+			vConsolePrint( "\n%-24s", "Response time" );
+
+			for( uxBin = 0; uxBin < configEDF_RESPONSE_TIME_HISTOGRAM_BINS; uxBin++ )
+			{
+				vConsolePrint( "%5lu%c", ( unsigned long ) ( uxBin * configEDF_RESPONSE_TIME_HISTOGRAM_WIDTH ), ( uxBin == ( configEDF_RESPONSE_TIME_HISTOGRAM_BINS - 1 ) ) ? '+' : ' ' );
+			}
+
+			vConsolePrint( "\n" );
+
+			for( uxTask = 0; uxTask < uxTasks; uxTask++ )
+			{
+				if( xStatuses[ uxTask ].xJobStatistics.ulJobsCompleted > 0UL )
+				{
+					vConsolePrint( "%-24s", xStatuses[ uxTask ].pcTaskName );
+
+					for( uxBin = 0; uxBin < configEDF_RESPONSE_TIME_HISTOGRAM_BINS; uxBin++ )
+					{
+						vConsolePrint( "%5lu ", ( unsigned long ) xStatuses[ uxTask ].xJobStatistics.ulResponseTimeHistogram[ uxBin ] );
+					}
+
+					vConsolePrint( "\n" );
+				}
+			}
+		}
+		#endif /* configEDF_RESPONSE_TIME_HISTOGRAM_BINS */
+
+		/* Every job released to a task of the set was either completed or
+		aborted, except the job still running at the end of the demo.  Each
+		completed job was ended by xTaskJobComplete(), which the task also
+		calls at the end of the code of an aborted job.  The server has no
+		jobs. */
+		for( uxTask = 0; uxTask < mainNUMBER_OF_TASKS; uxTask++ )
+		{
+			vTaskGetJobStatistics( xDemoTasks[ uxTask ].xHandle, &xStatistics );
+			ulJobs = xStatistics.ulJobsCompleted + xStatistics.ulJobsAborted;
+
+			if( uxTask == mainRECEIVER_TASK )
+			{
+				if( xStatistics.ulJobsReleased != 0UL )
+				{
+					vConsolePrint( "ERROR: the kernel recorded jobs of the server\n" );
+					iErrors++;
+				}
+			}
+			else if( ( xStatistics.ulJobsReleased < ulJobs ) || ( xStatistics.ulJobsReleased > ( ulJobs + 1UL ) ) ||
+					 ( xStatistics.ulJobsCompleted > ( xDemoTasks[ uxTask ].ulJobs + 1UL ) ) || ( xDemoTasks[ uxTask ].ulJobs > ( ulJobs + 1UL ) ) ||
+					 ( xStatistics.ulDeadlinesMissed > ( xDemoTasks[ uxTask ].ulMisses + 1UL ) ) ||
+					 ( ( xDemoTasks[ uxTask ].ulMisses == 0UL ) && ( xStatistics.lMaxLateness > 0L ) ) )
+			{
+				vConsolePrint( "ERROR: the kernel recorded %lu jobs and %lu misses of %s\n", ( unsigned long ) ulJobs, ( unsigned long ) xStatistics.ulDeadlinesMissed, xDemoTasks[ uxTask ].pcName );
+				iErrors++;
+			}
+		}
+	}
+
+#endif /* configUSE_EDF_TASK_STATISTICS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_EDF_UTILISATION_MONITOR == 1 )
+
+	static void prvPrintUtilisation( void )
+	{
+	UBaseType_t uxTask;
+	TaskUtilisation_t xUtilisation;
+	uint32_t ulTotal = 0UL, ulLimit;
+
+		vConsolePrint( "\n%-24s%10s%10s%10s%12s\n", "Utilisation (0.1%)", "Declared", "Average", "Last", "Peak (avg)" );
+
+		for( uxTask = 0; uxTask < mainNUMBER_OF_TASKS; uxTask++ )
+		{
+			vTaskGetUtilisation( xDemoTasks[ uxTask ].xHandle, &xUtilisation );
+			vConsolePrint( "%-24s%10lu%10lu%10lu%12lu\n", xDemoTasks[ uxTask ].pcName, ( unsigned long ) mainPER_MILLE( xUtilisation.ulDeclaredUtilisation ), ( unsigned long ) mainPER_MILLE( xUtilisation.ulUtilisation ), ( unsigned long ) mainPER_MILLE( xUtilisation.ulLastWindow ), ( unsigned long ) mainPER_MILLE( xUtilisation.ulPeakUtilisation ) );
+			ulTotal += xUtilisation.ulUtilisation;
+
+			/* A task that completes its jobs within their budgets cannot use
+			more of the processor than its timing declares, except that a
+			window can hold the end of a job released in the window before as
+			well as the jobs released in it.  Load 2 exceeds its budget when it
+			is made to overrun.  The last window is checked rather than the
+			average, which still includes the transient mode when the modes are
+			changed. */
+			ulLimit = xUtilisation.ulDeclaredUtilisation + ( ( ( uint32_t ) xDemoTasks[ uxTask ].xTiming.xWorstCaseExecutionTime * tskEDF_FULL_UTILISATION ) / ( uint32_t ) configEDF_UTILISATION_WINDOW_TICKS );
+
+			if( ( xUtilisation.ulDeclaredUtilisation != 0UL ) && ( xUtilisation.ulLastWindow > ulLimit ) && ( ( uxTask != mainLOAD_2_TASK ) || ( mainLOAD_2_OVERRUN_TICKS == 0 ) ) )
+			{
+				vConsolePrint( "ERROR: %s used more than its declared utilisation\n", xDemoTasks[ uxTask ].pcName );
+				iErrors++;
+			}
+		}
+
+		vTaskGetSystemUtilisation( &xUtilisation );
+		vConsolePrint( "%-24s%10lu%10lu%10lu%12lu\n", "Processor", ( unsigned long ) mainPER_MILLE( xUtilisation.ulDeclaredUtilisation ), ( unsigned long ) mainPER_MILLE( xUtilisation.ulUtilisation ), ( unsigned long ) mainPER_MILLE( xUtilisation.ulLastWindow ), ( unsigned long ) mainPER_MILLE( xUtilisation.ulPeakUtilisation ) );
+
+		/* The processor is used by the tasks of the set, and a little by the
+		check task and the tasks of the kernel. */
+		if( ( ( ulTotal + ( mainUTILISATION_ROUNDING * mainNUMBER_OF_TASKS ) ) < xUtilisation.ulUtilisation ) ||
+			( ulTotal > ( xUtilisation.ulUtilisation + ( mainUTILISATION_ROUNDING * mainNUMBER_OF_TASKS ) ) ) )
+		{
+			vConsolePrint( "ERROR: the utilisation of the processor is not that of the tasks\n" );
+			iErrors++;
+		}
+	}
+
+#endif /* configUSE_EDF_UTILISATION_MONITOR */
+/*-----------------------------------------------------------*/
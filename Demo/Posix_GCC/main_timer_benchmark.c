@@ -0,0 +1,363 @@
+/*
+ * FreeRTOS Kernel V10.3.0
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/******************************************************************************
+ * Measures the cost of the software timers as the number of active timers
+ * grows, for comparing the sorted timer lists with the timing wheel
+ * (configUSE_TIMER_WHEEL).
+ *
+ * A benchmark task, which always has the earliest deadline, creates auto
+ * reload timers in the steps listed in uxTimerCounts.  For each number of timers:
+ *
+ * + The timers are given long, scattered periods so none expire, then the
+ *   benchmark task queues batches of resets, bracketed by two pended function
+ *   calls that read the clock.  The timer service task only runs once the
+ *   benchmark task blocks, so it processes each batch in one go and the time
+ *   between the two pended functions is the time it took to process the
+ *   resets.  The median per reset is printed.
+ *
+ * + The timers are given short periods that are multiples of
+ *   mainEXPIRY_STEP, so they expire in batches, and the benchmark task blocks
+ *   while they run.  The callbacks read the clock, and the time between the
+ *   first and last callback of a batch divided by the number of callbacks
+ *   after the first is the time taken to process each expiry.  The median per
+ *   expiry is printed.
+ *
+ * "make timer-benchmark" runs the benchmark with both implementations.  It
+ * needs the timer service task to run synchronously, so it only runs in
+ * virtual time ("make DEMO=timer_benchmark" selects it).
+ ******************************************************************************/
+
+/* Standard includes. */
+#include <stdlib.h>
+#include <time.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+
+/* Demo includes. */
+#include "console.h"
+
+/* The numbers of timers measured. */
+#define mainTIMER_COUNTS				( sizeof( uxTimerCounts ) / sizeof( uxTimerCounts[ 0 ] ) )
+#define mainMAX_TIMERS					( 1000 )
+
+/* The number of batches of resets measured for each number of timers.  A
+batch fills the timer command queue, less the two pended function calls. */
+#define mainRESET_ROUNDS				( 64 )
+#define mainRESETS_PER_ROUND			( configTIMER_QUEUE_LENGTH - 2 )
+
+/* While the resets are measured the periods of the timers are scattered over
+this range, so each reset moves a timer to no particular place among the
+others and none expire. */
+#define mainIDLE_MIN_PERIOD				( ( TickType_t ) 10000 )
+#define mainIDLE_PERIOD_RANGE			( ( TickType_t ) 40000 )
+
+/* While the expiries are measured the periods of the timers are multiples of
+mainEXPIRY_STEP, up to mainEXPIRY_MULTIPLES times it. */
+#define mainEXPIRY_STEP					( ( TickType_t ) 16 )
+#define mainEXPIRY_MULTIPLES			( 8U )
+#define mainEXPIRY_TICKS				( mainEXPIRY_STEP * mainEXPIRY_MULTIPLES * 8U )
+#define mainMAX_BATCHES					( 64 )
+
+/* The benchmark task has the shortest period, so the timer service task only
+runs once the benchmark task blocks. */
+#define mainBENCHMARK_PERIOD			( ( TickType_t ) 1 )
+#define mainBENCHMARK_PRIORITY			( tskIDLE_PRIORITY + 2 )
+
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_VIRTUAL_TIME == 1 ) && ( configUSE_TIMERS == 1 ) )
+
+	/*
+	 * The benchmark task, see the comments at the top of this file.
+	 */
+	static void prvBenchmarkTask( void *pvParameters );
+
+	/*
+	 * Give timer uxTimer the period used to measure the resets or the
+	 * expiries, which also starts it.
+	 */
+	static void prvSetIdlePeriod( UBaseType_t uxTimer );
+	static void prvSetExpiryPeriod( UBaseType_t uxTimer );
+
+	/*
+	 * Return the median time taken to process a reset, or an expiry, of
+	 * uxTimers timers in nanoseconds.
+	 */
+	static uint64_t prvMeasureResets( UBaseType_t uxTimers );
+	static uint64_t prvMeasureExpiries( UBaseType_t uxTimers );
+
+	/*
+	 * The callback of the timers, which records the batches of expiries.
+	 */
+	static void prvTimerCallback( TimerHandle_t xTimer );
+
+	/*
+	 * Pended to the timer service task to write the time to the uint64_t
+	 * pvTime points to.
+	 */
+	static void prvReadClock( void *pvTime, uint32_t ulUnused );
+
+	/*
+	 * Return the time of the monotonic clock in nanoseconds.
+	 */
+	static uint64_t prvNanoseconds( void );
+
+	/*
+	 * Return the median of the xCount values in pullValues, which are sorted
+	 * in place.
+	 */
+	static uint64_t prvMedian( uint64_t *pullValues, size_t xCount );
+	static int prvCompareValues( const void *pvA, const void *pvB );
+
+	/* The numbers of timers measured, and the timers. */
+	static const UBaseType_t uxTimerCounts[] = { 10, 100, 1000 };
+	static TimerHandle_t xTimers[ mainMAX_TIMERS ];
+
+	/* The batch of expiries being recorded by prvTimerCallback(), and the
+	time per expiry of the batches recorded so far. */
+	static TickType_t xBatchTick;
+	static UBaseType_t uxBatchExpiries = 0, uxBatches = 0;
+	static uint64_t ullBatchStart, ullBatchEnd;
+	static uint64_t ullExpiryTimes[ mainMAX_BATCHES ];
+
+#endif
+
+/* Set to non-zero if the benchmark could not be run. */
+static int iErrors = 0;
+
+/*-----------------------------------------------------------*/
+
+int main_timer_benchmark( void )
+{
+	#if( ( configUSE_VIRTUAL_TIME == 1 ) && ( configUSE_TIMERS == 1 ) )
+	{
+		xTaskPeriodicCreate( prvBenchmarkTask, "Benchmark", configMINIMAL_STACK_SIZE, NULL, mainBENCHMARK_PRIORITY, NULL, mainBENCHMARK_PERIOD );
+
+		/* Returns when the benchmark task ends the scheduler. */
+		vTaskStartScheduler();
+	}
+	#else
+	{
+		vConsolePrint( "The timer benchmark must be built with VIRTUAL_TIME=1 and configUSE_TIMERS=1\n" );
+		iErrors++;
+	}
+	#endif
+
+	return iErrors;
+}
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_VIRTUAL_TIME == 1 ) && ( configUSE_TIMERS == 1 ) )
+
+static void prvBenchmarkTask( void *pvParameters )
+{
+UBaseType_t uxTimers = 0, uxStep;
+uint64_t ullReset, ullExpiry;
+
+	( void ) pvParameters;
+
+	#if( configUSE_TIMER_WHEEL == 1 )
+		vConsolePrint( "Timing wheel, %u levels of %u slots\n", ( unsigned ) configTIMER_WHEEL_LEVELS, ( unsigned ) ( 1U << configTIMER_WHEEL_SLOT_BITS ) );
+	#else
+		vConsolePrint( "Sorted timer lists\n" );
+	#endif
+
+	vConsolePrint( "%8s%20s%20s\n", "Timers", "Reset (ns)", "Expiry (ns)" );
+
+	for( uxStep = 0; uxStep < mainTIMER_COUNTS; uxStep++ )
+	{
+		while( uxTimers < uxTimerCounts[ uxStep ] )
+		{
+			xTimers[ uxTimers ] = xTimerCreate( "Bench", mainIDLE_MIN_PERIOD, pdTRUE, NULL, prvTimerCallback );
+
+			if( xTimers[ uxTimers ] == NULL )
+			{
+				vConsolePrint( "Could not create timer %lu\n", ( unsigned long ) uxTimers );
+				iErrors++;
+				vTaskEndScheduler();
+			}
+
+			uxTimers++;
+		}
+
+		ullReset = prvMeasureResets( uxTimers );
+		ullExpiry = prvMeasureExpiries( uxTimers );
+
+		vConsolePrint( "%8lu%20llu%20llu\n", ( unsigned long ) uxTimers, ( unsigned long long ) ullReset, ( unsigned long long ) ullExpiry );
+	}
+
+	vTaskEndScheduler();
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetIdlePeriod( UBaseType_t uxTimer )
+{
+	( void ) xTimerChangePeriod( xTimers[ uxTimer ], mainIDLE_MIN_PERIOD + ( ( TickType_t ) uxTimer * 7919U ) % mainIDLE_PERIOD_RANGE, portMAX_DELAY );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetExpiryPeriod( UBaseType_t uxTimer )
+{
+	( void ) xTimerChangePeriod( xTimers[ uxTimer ], mainEXPIRY_STEP * ( ( TickType_t ) ( ( uxTimer * 5U ) % mainEXPIRY_MULTIPLES ) + 1U ), portMAX_DELAY );
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvMeasureResets( UBaseType_t uxTimers )
+{
+static uint64_t ullResetTimes[ mainRESET_ROUNDS ];
+uint64_t ullStart = 0, ullEnd = 0;
+UBaseType_t uxTimer, uxRound, uxReset;
+
+	/* The commands block the benchmark task when the queue is full, which
+	lets the timer service task run. */
+	for( uxTimer = 0; uxTimer < uxTimers; uxTimer++ )
+	{
+		prvSetIdlePeriod( uxTimer );
+	}
+
+	vTaskDelay( 1 );
+
+	for( uxRound = 0; uxRound < mainRESET_ROUNDS; uxRound++ )
+	{
+		( void ) xTimerPendFunctionCall( prvReadClock, &ullStart, 0, 0 );
+
+		for( uxReset = 0; uxReset < mainRESETS_PER_ROUND; uxReset++ )
+		{
+			uxTimer = ( ( uxRound * mainRESETS_PER_ROUND + uxReset ) * 331U ) % uxTimers;
+			( void ) xTimerReset( xTimers[ uxTimer ], 0 );
+		}
+
+		( void ) xTimerPendFunctionCall( prvReadClock, &ullEnd, 0, 0 );
+
+		/* Let the timer service task process the batch. */
+		vTaskDelay( 1 );
+
+		ullResetTimes[ uxRound ] = ( ullEnd - ullStart ) / mainRESETS_PER_ROUND;
+	}
+
+	return prvMedian( ullResetTimes, mainRESET_ROUNDS );
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvMeasureExpiries( UBaseType_t uxTimers )
+{
+UBaseType_t uxTimer;
+
+	for( uxTimer = 0; uxTimer < uxTimers; uxTimer++ )
+	{
+		prvSetExpiryPeriod( uxTimer );
+	}
+
+	uxBatchExpiries = 0;
+	uxBatches = 0;
+
+	vTaskDelay( mainEXPIRY_TICKS );
+
+	/* Stop the expiries before the next measurement. */
+	for( uxTimer = 0; uxTimer < uxTimers; uxTimer++ )
+	{
+		prvSetIdlePeriod( uxTimer );
+	}
+
+	vTaskDelay( 1 );
+
+	if( uxBatches == 0U )
+	{
+		vConsolePrint( "No batches of expiries were recorded\n" );
+		iErrors++;
+		return 0;
+	}
+
+	return prvMedian( ullExpiryTimes, uxBatches );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimerCallback( TimerHandle_t xTimer )
+{
+uint64_t ullNow = prvNanoseconds();
+
+	( void ) xTimer;
+
+	/* The tick count does not change while the timer service task runs in
+	virtual time, so the expiries processed in one tick are one batch. */
+	if( ( uxBatchExpiries == 0U ) || ( xTaskGetTickCount() != xBatchTick ) )
+	{
+		if( ( uxBatchExpiries > 1U ) && ( uxBatches < mainMAX_BATCHES ) )
+		{
+			ullExpiryTimes[ uxBatches ] = ( ullBatchEnd - ullBatchStart ) / ( uxBatchExpiries - 1U );
+			uxBatches++;
+		}
+
+		xBatchTick = xTaskGetTickCount();
+		uxBatchExpiries = 0;
+		ullBatchStart = ullNow;
+	}
+
+	ullBatchEnd = ullNow;
+	uxBatchExpiries++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvReadClock( void *pvTime, uint32_t ulUnused )
+{
+	( void ) ulUnused;
+
+	*( uint64_t * ) pvTime = prvNanoseconds();
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvNanoseconds( void )
+{
+struct timespec xNow;
+
+	( void ) clock_gettime( CLOCK_MONOTONIC, &xNow );
+
+	return ( uint64_t ) xNow.tv_sec * 1000000000ULL + ( uint64_t ) xNow.tv_nsec;
+}
+/*-----------------------------------------------------------*/
+
+static int prvCompareValues( const void *pvA, const void *pvB )
+{
+uint64_t ullA = *( const uint64_t * ) pvA, ullB = *( const uint64_t * ) pvB;
+
+	return ( ullA > ullB ) - ( ullA < ullB );
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvMedian( uint64_t *pullValues, size_t xCount )
+{
+	qsort( pullValues, xCount, sizeof( uint64_t ), prvCompareValues );
+
+	return pullValues[ xCount / 2 ];
+}
+
+#endif /* ( configUSE_VIRTUAL_TIME == 1 ) && ( configUSE_TIMERS == 1 ) */
+/*-----------------------------------------------------------*/
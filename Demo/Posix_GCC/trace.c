@@ -0,0 +1,111 @@
+/*
+ * FreeRTOS Kernel V10.3.0
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Demo includes. */
+#include "trace.h"
+
+/* The maximum number of context switches recorded.  Later switches are
+counted but not recorded. */
+#ifndef traceBUFFER_LENGTH
+	#define traceBUFFER_LENGTH		( 1UL << 18 )
+#endif
+
+/*-----------------------------------------------------------*/
+
+/* One context switch. */
+typedef struct TRACE_RECORD
+{
+	void *pvTask;					/*< The task switched in. */
+	unsigned long ulTickCount;		/*< The tick count at the switch. */
+	unsigned long ulDeadline;		/*< The absolute deadline of the task switched in. */
+} TraceRecord_t;
+
+/*-----------------------------------------------------------*/
+
+static TraceRecord_t xTraceBuffer[ traceBUFFER_LENGTH ];
+static unsigned long ulTraceRecords = 0;
+static unsigned long ulTraceDropped = 0;
+static void *pvLastTask = NULL;
+
+/*-----------------------------------------------------------*/
+
+void vTraceTaskSwitchedIn( void *pvTask, unsigned long ulTickCount, unsigned long ulDeadline )
+{
+	if( pvTask != pvLastTask )
+	{
+		pvLastTask = pvTask;
+
+		if( ulTraceRecords < traceBUFFER_LENGTH )
+		{
+			xTraceBuffer[ ulTraceRecords ].pvTask = pvTask;
+			xTraceBuffer[ ulTraceRecords ].ulTickCount = ulTickCount;
+			xTraceBuffer[ ulTraceRecords ].ulDeadline = ulDeadline;
+			ulTraceRecords++;
+		}
+		else
+		{
+			ulTraceDropped++;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+int iTraceWrite( const char *pcFileName )
+{
+FILE *pxFile;
+unsigned long ul;
+
+	pxFile = fopen( pcFileName, "w" );
+
+	if( pxFile == NULL )
+	{
+		perror( pcFileName );
+		return -1;
+	}
+
+	/* The scheduler has ended, so the tasks cannot be deleted while their
+	names are read. */
+	for( ul = 0; ul < ulTraceRecords; ul++ )
+	{
+		fprintf( pxFile, "%lu %s %lu\n", xTraceBuffer[ ul ].ulTickCount, pcTaskGetName( ( TaskHandle_t ) xTraceBuffer[ ul ].pvTask ), xTraceBuffer[ ul ].ulDeadline );
+	}
+
+	if( ulTraceDropped != 0 )
+	{
+		fprintf( pxFile, "# %lu switches not recorded\n", ulTraceDropped );
+	}
+
+	return ( fclose( pxFile ) == 0 ) ? 0 : -1;
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,45 @@
+/*
+ * FreeRTOS Kernel V10.3.0
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+/*
+ * A record of the scheduling decisions made by vTaskSwitchContext().  Called
+ * from traceTASK_SWITCHED_IN() with the task selected to run, the tick count
+ * and the absolute deadline of the task.  Only switches to a different task
+ * are recorded.  Safe to call from the simulated tick interrupt.
+ */
+void vTraceTaskSwitchedIn( void *pvTask, unsigned long ulTickCount, unsigned long ulDeadline );
+
+/*
+ * Write the recorded trace to the file pcFileName, one switch per line as
+ * "<tick> <task name> <deadline>".  Returns 0 on success.
+ */
+int iTraceWrite( const char *pcFileName );
+
+#endif /* TRACE_H */
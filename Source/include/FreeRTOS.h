@@ -278,6 +278,34 @@ hold explicit before calling the code. */
 
 #endif /* configUSE_TIMERS */
 
+#ifndef configUSE_TIMER_WHEEL
+	#define configUSE_TIMER_WHEEL 0
+#endif
+
+#if ( configUSE_TIMER_WHEEL == 1 )
+	#if ( configUSE_TIMERS == 0 )
+		#error configUSE_TIMERS must be set to 1 when configUSE_TIMER_WHEEL is set to 1.
+	#endif
+
+	#ifndef configTIMER_WHEEL_SLOT_BITS
+		/* Each level of the timing wheel has 2 ^ configTIMER_WHEEL_SLOT_BITS
+		slots. */
+		#define configTIMER_WHEEL_SLOT_BITS 6
+	#endif
+
+	#ifndef configTIMER_WHEEL_LEVELS
+		#define configTIMER_WHEEL_LEVELS 3
+	#endif
+
+	#if ( ( configTIMER_WHEEL_SLOT_BITS < 1 ) || ( configTIMER_WHEEL_LEVELS < 1 ) )
+		#error configTIMER_WHEEL_SLOT_BITS and configTIMER_WHEEL_LEVELS must both be at least 1.
+	#endif
+
+	#if ( ( configTIMER_WHEEL_SLOT_BITS * ( configTIMER_WHEEL_LEVELS - 1 ) ) >= ( ( configUSE_16_BIT_TICKS == 1 ) ? 16 : 32 ) )
+		#error The levels of the timing wheel above the first must start within the bits of TickType_t.
+	#endif
+#endif /* configUSE_TIMER_WHEEL */
+
 #ifndef portSET_INTERRUPT_MASK_FROM_ISR
 	#define portSET_INTERRUPT_MASK_FROM_ISR() 0
 #endif
@@ -290,6 +318,10 @@ hold explicit before calling the code. */
 	#define portCLEAN_UP_TCB( pxTCB ) ( void ) pxTCB
 #endif
 
+#ifndef portIDLE_TASK_PROCESSING
+	#define portIDLE_TASK_PROCESSING()
+#endif
+
 #ifndef portPRE_TASK_DELETE_HOOK
 	#define portPRE_TASK_DELETE_HOOK( pvTaskToDelete, pxYieldPending )
 #endif
@@ -312,6 +344,42 @@ hold explicit before calling the code. */
 	#define portPOINTER_SIZE_TYPE uint32_t
 #endif
 
+#ifndef configUSE_RECORDER
+	#define configUSE_RECORDER 0
+#endif
+
+#if ( configUSE_RECORDER == 1 )
+
+	/* The recorder defines the trace macros the application has not defined,
+	so must be included before they are removed below. */
+	#include "recorder.h"
+
+	#ifndef configRECORDER_TIMESTAMP_HZ
+		#error configRECORDER_TIMESTAMP_HZ must be defined to the frequency of the run time stats counter when configUSE_RECORDER is set to 1.
+	#endif
+
+	#ifndef configRECORDER_BUFFER_LENGTH
+		/* The number of records the ring buffer holds, which must be a power
+		of 2. */
+		#define configRECORDER_BUFFER_LENGTH 256
+	#endif
+
+	#ifndef configRECORDER_MAX_TASKS
+		/* The number of task names kept. */
+		#define configRECORDER_MAX_TASKS 16
+	#endif
+
+	#ifndef configRECORDER_SET_INTERRUPT_MASK
+		/* Masks the interrupts that can record events while a record is
+		written.  A port whose portSET_INTERRUPT_MASK_FROM_ISR() does nothing,
+		because its interrupts do not nest, must instead define both macros to
+		disable interrupts and then restore the state they were in. */
+		#define configRECORDER_SET_INTERRUPT_MASK() portSET_INTERRUPT_MASK_FROM_ISR()
+		#define configRECORDER_CLEAR_INTERRUPT_MASK( uxSavedInterruptStatus ) portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus )
+	#endif
+
+#endif /* configUSE_RECORDER */
+
 /* Remove any unused trace macros. */
 #ifndef traceSTART
 	/* Used to perform any necessary initialisation - for example, open a file
@@ -712,6 +780,34 @@ hold explicit before calling the code. */
 	#define traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xReceivedLength )
 #endif
 
+#ifndef traceTASK_JOB_RELEASE
+	/* Called when a job of a periodic task is released, after its deadline
+	has been calculated. */
+	#define traceTASK_JOB_RELEASE( pxTCB )
+#endif
+
+#ifndef traceTASK_JOB_COMPLETE
+	/* Called when the running task completes a job of a periodic task. */
+	#define traceTASK_JOB_COMPLETE( pxTCB )
+#endif
+
+#ifndef traceTASK_JOB_OVERRUN
+	/* Called when a job misses its deadline or exhausts its budget, before
+	vApplicationOverrunHook(). */
+	#define traceTASK_JOB_OVERRUN( pxTCB, eType )
+#endif
+
+#ifndef traceISR_ENTER
+	/* Called by ports that support it on entry to the tick interrupt. */
+	#define traceISR_ENTER()
+#endif
+
+#ifndef traceISR_EXIT
+	/* Called by ports that support it before the tick interrupt returns,
+	which is before the task selected to run is switched in. */
+	#define traceISR_EXIT()
+#endif
+
 #ifndef configGENERATE_RUN_TIME_STATS
 	#define configGENERATE_RUN_TIME_STATS 0
 #endif
@@ -766,6 +862,18 @@ hold explicit before calling the code. */
 	#define configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING( x )
 #endif
 
+#ifndef configUSE_EVENT_DRIVEN_TICK
+	#define configUSE_EVENT_DRIVEN_TICK 0
+#endif
+
+#if ( ( configUSE_EVENT_DRIVEN_TICK == 1 ) && ( configUSE_TICKLESS_IDLE != 0 ) )
+	#error configUSE_TICKLESS_IDLE must be 0 when configUSE_EVENT_DRIVEN_TICK is 1, as the tick interrupt is then only taken when an event is due.
+#endif
+
+#ifndef portSET_NEXT_TICK_EVENT
+	#define portSET_NEXT_TICK_EVENT()
+#endif
+
 #ifndef configPRE_SLEEP_PROCESSING
 	#define configPRE_SLEEP_PROCESSING( x )
 #endif
@@ -794,6 +902,154 @@ hold explicit before calling the code. */
 	#define configUSE_TIME_SLICING 0
 #endif
 
+#ifndef configUSE_EDF_SCHEDULER
+	#define configUSE_EDF_SCHEDULER 0
+#endif
+
+#ifndef configUSE_EDF_ADMISSION_CONTROL
+	#define configUSE_EDF_ADMISSION_CONTROL 0
+#endif
+
+#if ( ( configUSE_EDF_ADMISSION_CONTROL == 1 ) && ( configUSE_EDF_SCHEDULER == 0 ) )
+	#error configUSE_EDF_ADMISSION_CONTROL can only be set to 1 when configUSE_EDF_SCHEDULER is also set to 1.
+#endif
+
+#ifndef configUSE_EDF_OVERRUN_HANDLING
+	#define configUSE_EDF_OVERRUN_HANDLING 0
+#endif
+
+#ifndef configUSE_EDF_OVERRUN_HOOK
+	#define configUSE_EDF_OVERRUN_HOOK 0
+#endif
+
+#ifndef configEDF_DEFAULT_OVERRUN_POLICY
+	#define configEDF_DEFAULT_OVERRUN_POLICY eOverrunNotify
+#endif
+
+#if ( ( configUSE_EDF_OVERRUN_HANDLING == 1 ) && ( configUSE_EDF_SCHEDULER == 0 ) )
+	#error configUSE_EDF_OVERRUN_HANDLING can only be set to 1 when configUSE_EDF_SCHEDULER is also set to 1.
+#endif
+
+#if ( ( configUSE_EDF_OVERRUN_HOOK == 1 ) && ( configUSE_EDF_OVERRUN_HANDLING == 0 ) )
+	#error configUSE_EDF_OVERRUN_HOOK can only be set to 1 when configUSE_EDF_OVERRUN_HANDLING is also set to 1.
+#endif
+
+#ifndef configUSE_EDF_BANDWIDTH_SERVER
+	#define configUSE_EDF_BANDWIDTH_SERVER 0
+#endif
+
+#if ( ( configUSE_EDF_BANDWIDTH_SERVER == 1 ) && ( configUSE_EDF_SCHEDULER == 0 ) )
+	#error configUSE_EDF_BANDWIDTH_SERVER can only be set to 1 when configUSE_EDF_SCHEDULER is also set to 1.
+#endif
+
+#ifndef configUSE_EDF_SPORADIC_TASKS
+	#define configUSE_EDF_SPORADIC_TASKS 0
+#endif
+
+#if ( ( configUSE_EDF_SPORADIC_TASKS == 1 ) && ( ( configUSE_EDF_SCHEDULER == 0 ) || ( configUSE_TASK_NOTIFICATIONS == 0 ) ) )
+	#error configUSE_EDF_SPORADIC_TASKS can only be set to 1 when configUSE_EDF_SCHEDULER and configUSE_TASK_NOTIFICATIONS are also set to 1.
+#endif
+
+#ifndef configUSE_EDF_HYBRID_SCHEDULING
+	#define configUSE_EDF_HYBRID_SCHEDULING 0
+#endif
+
+#if ( ( configUSE_EDF_HYBRID_SCHEDULING == 1 ) && ( configUSE_EDF_SCHEDULER == 0 ) )
+	#error configUSE_EDF_HYBRID_SCHEDULING can only be set to 1 when configUSE_EDF_SCHEDULER is also set to 1.
+#endif
+
+#ifndef configUSE_EDF_MODE_CHANGE
+	#define configUSE_EDF_MODE_CHANGE 0
+#endif
+
+#if ( ( configUSE_EDF_MODE_CHANGE == 1 ) && ( configUSE_EDF_SCHEDULER == 0 ) )
+	#error configUSE_EDF_MODE_CHANGE can only be set to 1 when configUSE_EDF_SCHEDULER is also set to 1.
+#endif
+
+#ifndef configUSE_EDF_TASK_STATISTICS
+	#define configUSE_EDF_TASK_STATISTICS 0
+#endif
+
+#if ( ( configUSE_EDF_TASK_STATISTICS == 1 ) && ( configUSE_EDF_SCHEDULER == 0 ) )
+	#error configUSE_EDF_TASK_STATISTICS can only be set to 1 when configUSE_EDF_SCHEDULER is also set to 1.
+#endif
+
+#ifndef configEDF_RESPONSE_TIME_HISTOGRAM_BINS
+	/* The response time histogram is only kept if this is above 0. */
+	#define configEDF_RESPONSE_TIME_HISTOGRAM_BINS 0
+#endif
+
+#ifndef configEDF_RESPONSE_TIME_HISTOGRAM_WIDTH
+	#define configEDF_RESPONSE_TIME_HISTOGRAM_WIDTH 1
+#endif
+
+#if ( ( configEDF_RESPONSE_TIME_HISTOGRAM_BINS > 0 ) && ( configEDF_RESPONSE_TIME_HISTOGRAM_WIDTH < 1 ) )
+	#error configEDF_RESPONSE_TIME_HISTOGRAM_WIDTH must be at least 1 tick.
+#endif
+
+#ifndef configUSE_EDF_UTILISATION_MONITOR
+	#define configUSE_EDF_UTILISATION_MONITOR 0
+#endif
+
+#if ( ( configUSE_EDF_UTILISATION_MONITOR == 1 ) && ( ( configUSE_EDF_SCHEDULER == 0 ) || ( configGENERATE_RUN_TIME_STATS == 0 ) ) )
+	#error configUSE_EDF_UTILISATION_MONITOR can only be set to 1 when configUSE_EDF_SCHEDULER and configGENERATE_RUN_TIME_STATS are also set to 1.
+#endif
+
+#ifndef configEDF_UTILISATION_WINDOW_TICKS
+	/* The utilisation is measured over consecutive windows of this many
+	ticks. */
+	#define configEDF_UTILISATION_WINDOW_TICKS 100
+#endif
+
+#ifndef configEDF_UTILISATION_SHIFT
+	/* Each window is given a weight of 1 / ( 2 ^ configEDF_UTILISATION_SHIFT )
+	in the moving average of the utilisation. */
+	#define configEDF_UTILISATION_SHIFT 3
+#endif
+
+#if ( ( configUSE_EDF_UTILISATION_MONITOR == 1 ) && ( ( configEDF_UTILISATION_WINDOW_TICKS < 1 ) || ( configEDF_UTILISATION_SHIFT > 16 ) ) )
+	#error configEDF_UTILISATION_WINDOW_TICKS must be at least 1 tick and configEDF_UTILISATION_SHIFT no more than 16.
+#endif
+
+#if ( configUSE_EDF_HYBRID_SCHEDULING == 1 )
+	#ifndef configEDF_MAX_PRIORITY
+		#error configEDF_MAX_PRIORITY must be defined to the highest priority scheduled by EDF when configUSE_EDF_HYBRID_SCHEDULING is 1.
+	#endif
+
+	#if ( configEDF_MAX_PRIORITY >= ( configMAX_PRIORITIES - 1 ) )
+		#error configEDF_MAX_PRIORITY must be below configMAX_PRIORITIES - 1 so at least one priority is left above the EDF band.
+	#endif
+#endif
+
+/* Under EDF the timer service task is a constant bandwidth server if
+configTIMER_TASK_BUDGET is defined, otherwise a task of the fixed priority band
+of hybrid scheduling. */
+#if ( ( configUSE_TIMERS == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) )
+	#ifdef configTIMER_TASK_BUDGET
+		#if ( configUSE_EDF_BANDWIDTH_SERVER == 0 )
+			#error configUSE_EDF_BANDWIDTH_SERVER must be set to 1 when configTIMER_TASK_BUDGET is defined, as the timer service task is then a constant bandwidth server.
+		#endif
+
+		#ifndef configTIMER_TASK_PERIOD
+			#error configTIMER_TASK_PERIOD must be defined to the server period of the timer service task when configTIMER_TASK_BUDGET is defined.
+		#endif
+	#elif ( configUSE_EDF_HYBRID_SCHEDULING == 0 )
+		#error If configUSE_TIMERS and configUSE_EDF_SCHEDULER are both 1 then either configTIMER_TASK_BUDGET and configTIMER_TASK_PERIOD must be defined, or configUSE_EDF_HYBRID_SCHEDULING must be 1 and configTIMER_TASK_PRIORITY above configEDF_MAX_PRIORITY.
+	#endif
+#endif
+
+#if ( ( configUSE_EDF_OVERRUN_HANDLING == 1 ) && ( configGENERATE_RUN_TIME_STATS == 1 ) )
+	#ifndef configEDF_RUN_TIME_COUNTS_PER_TICK
+		#error configEDF_RUN_TIME_COUNTS_PER_TICK must be defined to the number of run time stats counts in a tick when configUSE_EDF_OVERRUN_HANDLING and configGENERATE_RUN_TIME_STATS are both 1.
+	#endif
+#endif
+
+#if ( configUSE_EDF_UTILISATION_MONITOR == 1 )
+	#ifndef configEDF_RUN_TIME_COUNTS_PER_TICK
+		#error configEDF_RUN_TIME_COUNTS_PER_TICK must be defined to the number of run time stats counts in a tick when configUSE_EDF_UTILISATION_MONITOR is 1.
+	#endif
+#endif
+
 #ifndef configINCLUDE_APPLICATION_DEFINED_PRIVILEGED_FUNCTIONS
 	#define configINCLUDE_APPLICATION_DEFINED_PRIVILEGED_FUNCTIONS 0
 #endif
@@ -810,6 +1066,10 @@ hold explicit before calling the code. */
 	#define configUSE_TRACE_FACILITY 0
 #endif
 
+#if ( ( configUSE_RECORDER == 1 ) && ( ( configUSE_TRACE_FACILITY == 0 ) || ( configGENERATE_RUN_TIME_STATS == 0 ) ) )
+	#error configUSE_RECORDER can only be set to 1 when configUSE_TRACE_FACILITY and configGENERATE_RUN_TIME_STATS are also set to 1.
+#endif
+
 #ifndef mtCOVERAGE_TEST_MARKER
 	#define mtCOVERAGE_TEST_MARKER()
 #endif
@@ -1119,6 +1379,48 @@ typedef struct xSTATIC_TCB
 	UBaseType_t			uxDummy5;
 	void				*pxDummy6;
 	uint8_t				ucDummy7[ configMAX_TASK_NAME_LEN ];
+	#if ( configUSE_EDF_SCHEDULER == 1 )
+		TickType_t		xDummy23[ 5 ];
+		void			*pvDummy24[ 3 ];
+		uint32_t		ulDummy46;
+		TickType_t		xDummy25;
+		uint32_t		ulDummy26;
+		TickType_t		xDummy27[ 2 ];
+		uint32_t		ulDummy28;
+		uint8_t			ucDummy29[ 3 ];
+		#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+			void		*pvDummy30;
+		#endif
+		#if ( configUSE_EDF_OVERRUN_HANDLING == 1 )
+			uint32_t	ulDummy31[ 3 ];
+			uint8_t		ucDummy32[ 2 ];
+		#endif
+		#if ( configUSE_EDF_BANDWIDTH_SERVER == 1 )
+			TickType_t	xDummy33[ 2 ];
+			uint8_t		ucDummy34;
+		#endif
+		#if ( configUSE_EDF_SPORADIC_TASKS == 1 )
+			uint8_t		ucDummy35;
+		#endif
+		#if ( configUSE_EDF_MODE_CHANGE == 1 )
+			TickType_t	xDummy38[ 5 ];
+			uint8_t		ucDummy39;
+		#endif
+		#if ( configUSE_MUTEXES == 1 )
+			TickType_t	xDummy36;
+			uint8_t		ucDummy37;
+		#endif
+		#if ( configUSE_EDF_TASK_STATISTICS == 1 )
+			uint32_t	ulDummy40[ 4 ];
+			TickType_t	xDummy41[ 2 ];
+			uint32_t	ulDummy42;
+			int32_t		lDummy43[ 3 ];
+			uint32_t	ulDummy44[ 4 + configEDF_RESPONSE_TIME_HISTOGRAM_BINS ];
+		#endif
+		#if ( configUSE_EDF_UTILISATION_MONITOR == 1 )
+			uint32_t	ulDummy45[ 5 ];
+		#endif
+	#endif
 	#if ( ( portSTACK_GROWTH > 0 ) || ( configRECORD_STACK_HIGH_ADDRESS == 1 ) )
 		void			*pxDummy8;
 	#endif
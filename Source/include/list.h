@@ -282,7 +282,7 @@ List_t * const pxConstList = ( pxList );													\
 	( pxConstList )->pxIndex = ( pxConstList )->pxIndex->pxNext;							\
 	if( ( void * ) ( pxConstList )->pxIndex == ( void * ) &( ( pxConstList )->xListEnd ) )	\
 	{																						\
-		( pxConstList )->pxIndex = ( pxConstList )->pxIndex->pxNext;						\
+		( pxConstList )->pxIndex = ( pxConstList )->xListEnd.pxNext;						\
 	}																						\
 	( pxTCB ) = ( pxConstList )->pxIndex->pvOwner;											\
 }
@@ -389,6 +389,23 @@ void vListInsert( List_t * const pxList, ListItem_t * const pxNewListItem ) PRIV
  */
 void vListInsertEnd( List_t * const pxList, ListItem_t * const pxNewListItem ) PRIVILEGED_FUNCTION;
 
+/*
+ * Insert a list item into a list immediately after pxPosition, which must be
+ * an item in the list or the list end marker, in which case the item is
+ * placed at the head of the list.  The item value is not used, which allows
+ * the caller to keep the list in an order other than that of vListInsert().
+ *
+ * @param pxList The list into which the item is to be inserted.
+ *
+ * @param pxPosition The item after which the new item is placed.
+ *
+ * @param pxNewListItem The item that is to be placed in the list.
+ *
+ * \page vListInsertAfter vListInsertAfter
+ * \ingroup LinkedList
+ */
+void vListInsertAfter( List_t * const pxList, ListItem_t * const pxPosition, ListItem_t * const pxNewListItem ) PRIVILEGED_FUNCTION;
+
 /*
  * Remove an item from a list.  The list item has a pointer to the list that
  * it is in, so only the list item need be passed into the function.
@@ -46,9 +46,19 @@ only for ports that are using the MPU. */
 		 */
 
 		/* Map standard tasks.h API functions to the MPU equivalents. */
-		#define xTaskCreate								MPU_xTaskCreate
 		#define xTaskCreateStatic						MPU_xTaskCreateStatic
 		#define xTaskCreateRestricted					MPU_xTaskCreateRestricted
+		#if( configUSE_EDF_SCHEDULER == 1 )
+			/* xTaskCreate() is replaced by the EDF creation functions. */
+			#define xTaskPeriodicCreate					MPU_xTaskPeriodicCreate
+			#define xTaskPeriodicCreateConstrained		MPU_xTaskPeriodicCreateConstrained
+			#define xTaskBackgroundCreate				MPU_xTaskBackgroundCreate
+			#define xTaskPeriodicCreateStatic			MPU_xTaskPeriodicCreateStatic
+			#define xTaskPeriodicCreateRestricted		MPU_xTaskPeriodicCreateRestricted
+			#define xTaskPeriodicCreateRestrictedStatic	MPU_xTaskPeriodicCreateRestrictedStatic
+		#else
+			#define xTaskCreate							MPU_xTaskCreate
+		#endif
 		#define vTaskAllocateMPURegions					MPU_vTaskAllocateMPURegions
 		#define vTaskDelete								MPU_vTaskDelete
 		#define vTaskDelay								MPU_vTaskDelay
@@ -114,9 +124,9 @@ only for ports that are using the MPU. */
 		#define xQueueGenericReset						MPU_xQueueGenericReset
 
 		#if( configQUEUE_REGISTRY_SIZE > 0 )
-			#define vQueueAddToRegistry						MPU_vQueueAddToRegistry
-			#define vQueueUnregisterQueue					MPU_vQueueUnregisterQueue
-			#define pcQueueGetName							MPU_pcQueueGetName
+			#define vQueueAddToRegistry					MPU_vQueueAddToRegistry
+			#define vQueueUnregisterQueue				MPU_vQueueUnregisterQueue
+			#define pcQueueGetName						MPU_pcQueueGetName
 		#endif
 
 		/* Map standard timer.h API functions to the MPU equivalents. */
@@ -0,0 +1,299 @@
+/*
+ * FreeRTOS Kernel V10.3.0
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef RECORDER_H
+#define RECORDER_H
+
+/*
+ * A binary recorder of scheduling events, built into the kernel when
+ * configUSE_RECORDER is set to 1 in FreeRTOSConfig.h and recorder.c is
+ * compiled with the other kernel files.  The recorder defines the trace macros
+ * the application has not defined itself, so each scheduling event is written
+ * as one twelve byte record into a ring buffer, and the most recent events are
+ * kept when more are recorded than the buffer holds.  An application that
+ * defines a trace macro for its own use can call the recorder macro of the
+ * same name, for example recorderTASK_SWITCHED_IN(), from it.
+ *
+ * A record is written with interrupts masked by
+ * configRECORDER_SET_INTERRUPT_MASK(), so records can be written from tasks and
+ * interrupts alike and stay in time order.  The mask is only held while the
+ * record is claimed and written.
+ *
+ * The timestamp of each record is the time since the previous record, taken
+ * from the run time stats counter, which configRECORDER_TIMESTAMP_HZ gives the
+ * frequency of.  A record more than 65535 counts after the previous one is
+ * preceded by an eRecorderTimeExtension record holding the whole difference.
+ *
+ * The recording is kept in memory in the layout of a recording file: a
+ * RecorderHeader_t, then usTaskSlots RecorderTask_t, then ulRecordSlots
+ * RecorderRecord_t, all in the byte order of the target.  It can be saved
+ * from the debugger, or written out by the application once it has been
+ * stopped with vRecorderStop(), using pvRecorderGetRecording().  The decoder
+ * in Demo/Posix_GCC/decoder.c turns a recording file into a report, a Gantt
+ * chart, a VCD file or a Chrome trace.
+ *
+ * The first part of this header is also included by the decoder, so only uses
+ * standard types.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define recorderMAGIC				( 0x54464445UL )	/* "EDFT" when stored little endian. */
+#define recorderVERSION				( 2U )
+#define recorderNAME_LENGTH			( 24U )
+
+/* The events recorded.  ulTask is the task number of the task the event is
+about, or of the task that was running when the event occurred if the event is
+not about a task.  The meaning of ulParam is given for each event. */
+typedef enum
+{
+	eRecorderTimeExtension = 0,		/* ulParam: the time since the previous record, which the next record gives as 0. */
+	eRecorderTaskCreate,			/* ulParam: the priority of the task. */
+	eRecorderTaskSwitchedOut,		/* ulParam: unused. */
+	eRecorderTaskSwitchedIn,		/* ulParam: the deadline of the task. */
+	eRecorderTaskReady,				/* ulParam: the deadline of the task. */
+	eRecorderTaskDelay,				/* ulParam: unused. */
+	eRecorderTaskDelayUntil,		/* ulParam: the tick count the task is delayed until. */
+	eRecorderTaskSuspend,			/* ulParam: unused. */
+	eRecorderTaskNotifyBlock,		/* ulParam: unused. */
+	eRecorderJobRelease,			/* ulParam: the tick count the job was due to be released at. */
+	eRecorderJobDeadline,			/* ulParam: the tick count of the deadline of the job just released. */
+	eRecorderJobComplete,			/* ulParam: the tick count the job completed at. */
+	eRecorderJobOverrun,			/* ulParam: the eOverrunType of the overrun. */
+	eRecorderISREnter,				/* ulParam: unused. */
+	eRecorderISRExit,				/* ulParam: unused. */
+	eRecorderQueueSend,				/* ulParam: the queue.  The following queue events also give the queue. */
+	eRecorderQueueSendFailed,
+	eRecorderQueueReceive,
+	eRecorderQueueReceiveFailed,
+	eRecorderQueueBlockOnSend,
+	eRecorderQueueBlockOnReceive,
+	eRecorderEvents					/* The number of events, not an event. */
+} eRecorderEvent;
+
+/* One event.  The task number is held in full, as the task numbers of tasks
+created after others have been deleted keep counting up. */
+typedef struct RECORDER_RECORD
+{
+	uint8_t ucEvent;				/*< The eRecorderEvent. */
+	uint8_t ucReserved;
+	uint16_t usDelta;				/*< The time since the previous record. */
+	uint32_t ulTask;				/*< The task number, see above. */
+	uint32_t ulParam;				/*< Depends on the event, see above. */
+} RecorderRecord_t;
+
+/* The name of a task.  The names of the first usTaskSlots tasks created are
+kept, in the order the tasks were created.  An unused slot has a task number of
+0. */
+typedef struct RECORDER_TASK
+{
+	uint32_t ulTask;				/*< The task number. */
+	char cName[ recorderNAME_LENGTH ];	/*< The name of the task, terminated. */
+} RecorderTask_t;
+
+/* The start of a recording. */
+typedef struct RECORDER_HEADER
+{
+	uint32_t ulMagic;				/*< recorderMAGIC. */
+	uint16_t usVersion;				/*< recorderVERSION. */
+	uint16_t usRecordSize;			/*< sizeof( RecorderRecord_t ). */
+	uint32_t ulTimestampHz;			/*< The frequency of the run time counter. */
+	uint32_t ulTickHz;				/*< configTICK_RATE_HZ. */
+	uint8_t ucTickBits;				/*< The number of bits in the tick count. */
+	uint8_t ucReserved;
+	uint16_t usTaskSlots;			/*< The number of RecorderTask_t that follow. */
+	uint32_t ulRecordSlots;			/*< The number of RecorderRecord_t that follow, which is the length of the ring buffer. */
+	uint32_t ulWritten;				/*< The number of records written.  Once it is more than ulRecordSlots the buffer has wrapped and the oldest record is at the index ulWritten modulo ulRecordSlots. */
+	uint32_t ulLastTimestamp;		/*< The run time counter at the last record. */
+} RecorderHeader_t;
+
+/*
+ * Record an event, see eRecorderEvent, about the task with the task number
+ * ulTask.
+ */
+void vRecorderTaskEvent( uint8_t ucEvent, uint32_t ulTask, uint32_t ulParam );
+
+/*
+ * Record an event that is not about a task.  It is recorded with the task that
+ * was running.
+ */
+void vRecorderEvent( uint8_t ucEvent, uint32_t ulParam );
+
+/*
+ * Called from traceTASK_SWITCHED_IN().  If a different task has been selected
+ * to run then records eRecorderTaskSwitchedOut for the task that was running
+ * and eRecorderTaskSwitchedIn for the task selected, so only switches are
+ * recorded.
+ */
+void vRecorderTaskSwitchedIn( uint32_t ulTask, uint32_t ulDeadline );
+
+/*
+ * Called from traceTASK_CREATE() to record the name of the task and
+ * eRecorderTaskCreate.
+ */
+void vRecorderTaskCreate( uint32_t ulTask, const char *pcName, uint32_t ulPriority );
+
+/*
+ * Stop recording, so the recording no longer changes while it is written out.
+ * Events are not recorded after this has been called.
+ */
+void vRecorderStop( void );
+
+/*
+ * Returns the recording, which is *pxLength bytes long and is laid out as a
+ * recording file, see above.
+ */
+const void *pvRecorderGetRecording( size_t *pxLength );
+
+/* The trace macros, which are only defined when the header is included by
+FreeRTOS.h.  The tasks are identified by their task numbers, which
+configUSE_TRACE_FACILITY adds to the TCB. */
+#ifdef INC_FREERTOS_H
+
+	#define recorderTASK_SWITCHED_IN() vRecorderTaskSwitchedIn( ( uint32_t ) pxCurrentTCB->uxTCBNumber, ( uint32_t ) listGET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ) ) )
+	#define recorderTASK_CREATE( pxNewTCB ) vRecorderTaskCreate( ( uint32_t ) ( pxNewTCB )->uxTCBNumber, ( pxNewTCB )->pcTaskName, ( uint32_t ) ( pxNewTCB )->uxPriority )
+	#define recorderMOVED_TASK_TO_READY_STATE( pxTCB ) vRecorderTaskEvent( eRecorderTaskReady, ( uint32_t ) ( pxTCB )->uxTCBNumber, ( uint32_t ) listGET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ) ) )
+	#define recorderTASK_DELAY() vRecorderEvent( eRecorderTaskDelay, 0 )
+	#define recorderTASK_DELAY_UNTIL( xTimeToWake ) vRecorderEvent( eRecorderTaskDelayUntil, ( uint32_t ) ( xTimeToWake ) )
+	#define recorderTASK_SUSPEND( pxTaskToSuspend ) vRecorderTaskEvent( eRecorderTaskSuspend, ( uint32_t ) ( pxTaskToSuspend )->uxTCBNumber, 0 )
+	#define recorderTASK_NOTIFY_TAKE_BLOCK() vRecorderEvent( eRecorderTaskNotifyBlock, 0 )
+	#define recorderTASK_NOTIFY_WAIT_BLOCK() vRecorderEvent( eRecorderTaskNotifyBlock, 0 )
+
+	#define recorderTASK_JOB_RELEASE( pxTCB )																							\
+		do																																\
+		{																																\
+			vRecorderTaskEvent( eRecorderJobRelease, ( uint32_t ) ( pxTCB )->uxTCBNumber, ( uint32_t ) ( pxTCB )->xTaskReleaseTime );	\
+			vRecorderTaskEvent( eRecorderJobDeadline, ( uint32_t ) ( pxTCB )->uxTCBNumber, ( uint32_t ) ( ( pxTCB )->xTaskReleaseTime + ( pxTCB )->xTaskRelativeDeadline ) );	\
+		} while( 0 )
+	#define recorderTASK_JOB_COMPLETE( pxTCB ) vRecorderTaskEvent( eRecorderJobComplete, ( uint32_t ) ( pxTCB )->uxTCBNumber, ( uint32_t ) xTickCount )
+	#define recorderTASK_JOB_OVERRUN( pxTCB, eType ) vRecorderTaskEvent( eRecorderJobOverrun, ( uint32_t ) ( pxTCB )->uxTCBNumber, ( uint32_t ) ( eType ) )
+
+	#define recorderISR_ENTER() vRecorderEvent( eRecorderISREnter, 0 )
+	#define recorderISR_EXIT() vRecorderEvent( eRecorderISRExit, 0 )
+
+	#define recorderQUEUE_EVENT( eEvent, pxQueue ) vRecorderEvent( ( eEvent ), ( uint32_t ) ( uintptr_t ) ( pxQueue ) )
+
+	#ifndef traceTASK_SWITCHED_IN
+		#define traceTASK_SWITCHED_IN() recorderTASK_SWITCHED_IN()
+	#endif
+
+	#ifndef traceTASK_CREATE
+		#define traceTASK_CREATE( pxNewTCB ) recorderTASK_CREATE( pxNewTCB )
+	#endif
+
+	#ifndef traceMOVED_TASK_TO_READY_STATE
+		#define traceMOVED_TASK_TO_READY_STATE( pxTCB ) recorderMOVED_TASK_TO_READY_STATE( pxTCB )
+	#endif
+
+	#ifndef traceTASK_DELAY
+		#define traceTASK_DELAY() recorderTASK_DELAY()
+	#endif
+
+	#ifndef traceTASK_DELAY_UNTIL
+		#define traceTASK_DELAY_UNTIL( xTimeToWake ) recorderTASK_DELAY_UNTIL( xTimeToWake )
+	#endif
+
+	#ifndef traceTASK_SUSPEND
+		#define traceTASK_SUSPEND( pxTaskToSuspend ) recorderTASK_SUSPEND( pxTaskToSuspend )
+	#endif
+
+	#ifndef traceTASK_NOTIFY_TAKE_BLOCK
+		#define traceTASK_NOTIFY_TAKE_BLOCK() recorderTASK_NOTIFY_TAKE_BLOCK()
+	#endif
+
+	#ifndef traceTASK_NOTIFY_WAIT_BLOCK
+		#define traceTASK_NOTIFY_WAIT_BLOCK() recorderTASK_NOTIFY_WAIT_BLOCK()
+	#endif
+
+	#ifndef traceTASK_JOB_RELEASE
+		#define traceTASK_JOB_RELEASE( pxTCB ) recorderTASK_JOB_RELEASE( pxTCB )
+	#endif
+
+	#ifndef traceTASK_JOB_COMPLETE
+		#define traceTASK_JOB_COMPLETE( pxTCB ) recorderTASK_JOB_COMPLETE( pxTCB )
+	#endif
+
+	#ifndef traceTASK_JOB_OVERRUN
+		#define traceTASK_JOB_OVERRUN( pxTCB, eType ) recorderTASK_JOB_OVERRUN( pxTCB, eType )
+	#endif
+
+	#ifndef traceISR_ENTER
+		#define traceISR_ENTER() recorderISR_ENTER()
+	#endif
+
+	#ifndef traceISR_EXIT
+		#define traceISR_EXIT() recorderISR_EXIT()
+	#endif
+
+	#ifndef traceQUEUE_SEND
+		#define traceQUEUE_SEND( pxQueue ) recorderQUEUE_EVENT( eRecorderQueueSend, pxQueue )
+	#endif
+
+	#ifndef traceQUEUE_SEND_FROM_ISR
+		#define traceQUEUE_SEND_FROM_ISR( pxQueue ) recorderQUEUE_EVENT( eRecorderQueueSend, pxQueue )
+	#endif
+
+	#ifndef traceQUEUE_SEND_FAILED
+		#define traceQUEUE_SEND_FAILED( pxQueue ) recorderQUEUE_EVENT( eRecorderQueueSendFailed, pxQueue )
+	#endif
+
+	#ifndef traceQUEUE_SEND_FROM_ISR_FAILED
+		#define traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue ) recorderQUEUE_EVENT( eRecorderQueueSendFailed, pxQueue )
+	#endif
+
+	#ifndef traceQUEUE_RECEIVE
+		#define traceQUEUE_RECEIVE( pxQueue ) recorderQUEUE_EVENT( eRecorderQueueReceive, pxQueue )
+	#endif
+
+	#ifndef traceQUEUE_RECEIVE_FROM_ISR
+		#define traceQUEUE_RECEIVE_FROM_ISR( pxQueue ) recorderQUEUE_EVENT( eRecorderQueueReceive, pxQueue )
+	#endif
+
+	#ifndef traceQUEUE_RECEIVE_FAILED
+		#define traceQUEUE_RECEIVE_FAILED( pxQueue ) recorderQUEUE_EVENT( eRecorderQueueReceiveFailed, pxQueue )
+	#endif
+
+	#ifndef traceQUEUE_RECEIVE_FROM_ISR_FAILED
+		#define traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue ) recorderQUEUE_EVENT( eRecorderQueueReceiveFailed, pxQueue )
+	#endif
+
+	#ifndef traceBLOCKING_ON_QUEUE_SEND
+		#define traceBLOCKING_ON_QUEUE_SEND( pxQueue ) recorderQUEUE_EVENT( eRecorderQueueBlockOnSend, pxQueue )
+	#endif
+
+	#ifndef traceBLOCKING_ON_QUEUE_RECEIVE
+		#define traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue ) recorderQUEUE_EVENT( eRecorderQueueBlockOnReceive, pxQueue )
+	#endif
+
+	#ifndef traceBLOCKING_ON_QUEUE_PEEK
+		#define traceBLOCKING_ON_QUEUE_PEEK( pxQueue ) recorderQUEUE_EVENT( eRecorderQueueBlockOnReceive, pxQueue )
+	#endif
+
+#endif /* INC_FREERTOS_H */
+
+#endif /* RECORDER_H */
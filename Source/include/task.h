@@ -132,6 +132,98 @@ typedef struct xTASK_PARAMETERS
 	#endif
 } TaskParameters_t;
 
+/*
+ * The timing parameters of a periodic task scheduled by deadline, as used by
+ * xTaskPeriodicCreateConstrained() and xTaskPeriodicCreateStatic().  All the
+ * values are in ticks.
+ */
+typedef struct xTASK_PERIODIC_PARAMETERS
+{
+	TickType_t xPeriod;					/* The time between the releases of consecutive jobs.  Must not be 0. */
+	TickType_t xRelativeDeadline;		/* The time by which each job must complete after its release, or 0 if it is equal to the period.  Must not exceed the period. */
+	TickType_t xPhase;					/* The time between the task being created and the release of its first job. */
+	TickType_t xWorstCaseExecutionTime;	/* The execution time budget of each job, or 0 if it is not known. */
+	TickType_t xBlockingTime;			/* The longest time a job can be blocked by tasks with later deadlines holding mutexes it needs, or 0 if it shares no mutexes. */
+} TaskPeriodicParameters_t;
+
+/* Used with vTaskGetReleaseJitter() to return how late the jobs of a periodic
+task were released, in ticks, relative to their nominal release times. */
+typedef struct xTASK_RELEASE_JITTER
+{
+	uint32_t ulReleases;		/* The number of jobs released from the Blocked state since the task was created. */
+	TickType_t xLastJitter;		/* The jitter of the most recent release. */
+	TickType_t xMaxJitter;		/* The largest jitter of any release. */
+	uint32_t ulTotalJitter;		/* The sum of the jitter of every release, from which the mean can be calculated. */
+} TaskReleaseJitter_t;
+
+/* Actions the kernel can take when a job of a periodic task overruns, either
+by missing its deadline or by exhausting its execution time budget.  Set with
+vTaskSetOverrunPolicy(). */
+typedef enum
+{
+	eOverrunNotify = 0,		/* Count the overrun and call the overrun hook, if configured, but take no other action. */
+	eOverrunAbortJob,		/* Abandon the job, holding the task in the Blocked state until its next job is released.  See vTaskSetOverrunPolicy(). */
+	eOverrunDemote,			/* Run the rest of the job in the background, behind every task that has a deadline. */
+	eOverrunSkipNextRelease	/* Let the job run on, but release the next job one period later than normal. */
+} eOverrunPolicy;
+
+/* The ways in which a job can overrun, as passed to the overrun hook. */
+typedef enum
+{
+	eDeadlineMissed = 0,	/* The job had not completed by its deadline. */
+	eBudgetExhausted		/* The job executed for longer than the worst case execution time of its task. */
+} eOverrunType;
+
+/* Used with vTaskGetOverrunStatus() to return the number of jobs of a periodic
+task that have overrun.  A job that both exhausts its budget and misses its
+deadline is counted in both. */
+typedef struct xTASK_OVERRUN_STATUS
+{
+	uint32_t ulDeadlineMisses;	/* The number of jobs that had not completed by their deadline. */
+	uint32_t ulBudgetOverruns;	/* The number of jobs that executed for longer than the worst case execution time of the task. */
+} TaskOverrunStatus_t;
+
+/* Used with vTaskGetJobStatistics(), and in the TaskStatus_t structure, to
+return the statistics of the jobs of a periodic task, when
+configUSE_EDF_TASK_STATISTICS is 1.  Times are in ticks except the execution
+times, which are in the units of the run time stats counter and are only
+measured when configGENERATE_RUN_TIME_STATS is 1.  The minimum and maximum of
+each time are only valid once a job has completed.  The means can be calculated
+by dividing the totals by ulJobsCompleted. */
+typedef struct xTASK_JOB_STATISTICS
+{
+	uint32_t ulJobsReleased;		/* The number of jobs released since the task was created. */
+	uint32_t ulJobsCompleted;		/* The number of jobs the task has completed. */
+	uint32_t ulJobsAborted;			/* The number of jobs ended by the eOverrunAbortJob overrun policy, which are not counted as completed. */
+	uint32_t ulDeadlinesMissed;		/* The number of jobs that completed after their deadline, or that were aborted after their deadline. */
+	TickType_t xMinResponseTime;	/* The shortest time from the nominal release of a job to its completion. */
+	TickType_t xMaxResponseTime;	/* The longest time from the nominal release of a job to its completion.  The difference from the shortest is the response jitter. */
+	uint32_t ulTotalResponseTime;	/* The sum of the response times of every completed job. */
+	int32_t lMinLateness;			/* The least time by which a job completed after its deadline.  Negative if every job completed before its deadline. */
+	int32_t lMaxLateness;			/* The most time by which a job completed after its deadline.  Positive if any job missed its deadline. */
+	int32_t lTotalLateness;			/* The sum of the lateness of every completed job. */
+	uint32_t ulMinExecutionTime;	/* The least processor time used by a completed job. */
+	uint32_t ulMaxExecutionTime;	/* The most processor time used by a completed job. */
+	uint32_t ulTotalExecutionTime;	/* The sum of the processor time used by every completed job. */
+	#if ( configEDF_RESPONSE_TIME_HISTOGRAM_BINS > 0 )
+		uint32_t ulResponseTimeHistogram[ configEDF_RESPONSE_TIME_HISTOGRAM_BINS ];	/* The number of completed jobs with each response time.  Bin n counts response times from n to ( n + 1 ) times configEDF_RESPONSE_TIME_HISTOGRAM_WIDTH, less one tick, and the last bin also counts every longer response time. */
+	#endif
+} TaskJobStatistics_t;
+
+/* Used with vTaskGetUtilisation() and vTaskGetSystemUtilisation() to return the
+processor utilisation measured by the kernel when
+configUSE_EDF_UTILISATION_MONITOR is 1.  The utilisation is measured over
+consecutive windows of configEDF_UTILISATION_WINDOW_TICKS ticks, and each
+value is a fraction of a window where tskEDF_FULL_UTILISATION is a utilisation
+of 1.  The window in progress is not included until it ends. */
+typedef struct xTASK_UTILISATION
+{
+	uint32_t ulUtilisation;			/* The moving average of the utilisation, in which each window that ends is given a weight of 1 / ( 2 ^ configEDF_UTILISATION_SHIFT ). */
+	uint32_t ulLastWindow;			/* The utilisation in the window that ended last. */
+	uint32_t ulPeakUtilisation;		/* The largest value the moving average has had. */
+	uint32_t ulDeclaredUtilisation;	/* The utilisation declared by the timing of the task, worst case execution time divided by period, or 0 if the task has no worst case execution time. */
+} TaskUtilisation_t;
+
 /* Used with the uxTaskGetSystemState() function to return the state of each task
 in the system. */
 typedef struct xTASK_STATUS
@@ -145,6 +237,9 @@ typedef struct xTASK_STATUS
 	uint32_t ulRunTimeCounter;		/* The total run time allocated to the task so far, as defined by the run time stats clock.  See http://www.freertos.org/rtos-run-time-stats.html.  Only valid when configGENERATE_RUN_TIME_STATS is defined as 1 in FreeRTOSConfig.h. */
 	StackType_t *pxStackBase;		/* Points to the lowest address of the task's stack area. */
 	configSTACK_DEPTH_TYPE usStackHighWaterMark;	/* The minimum amount of stack space that has remained for the task since the task was created.  The closer this value is to zero the closer the task has come to overflowing its stack. */
+	#if ( configUSE_EDF_TASK_STATISTICS == 1 )
+		TaskJobStatistics_t xJobStatistics;	/* The statistics of the jobs of the task, see vTaskGetJobStatistics().  Only present if configUSE_EDF_TASK_STATISTICS is defined as 1 in FreeRTOSConfig.h. */
+	#endif
 } TaskStatus_t;
 
 /* Possible return values for eTaskConfirmSleepModeStatus(). */
@@ -162,6 +257,15 @@ typedef enum
  */
 #define tskIDLE_PRIORITY			( ( UBaseType_t ) 0U )
 
+/**
+ * Defines the value that represents a processor utilisation of 1 (100%) in the
+ * values returned by ulTaskGetEDFUtilisation() and
+ * ulTaskGetEDFSpareUtilisation(), and in the TaskUtilisation_t structure.
+ *
+ * \ingroup TaskUtils
+ */
+#define tskEDF_FULL_UTILISATION		( ( uint32_t ) 0x10000UL )
+
 /**
  * task. h
  *
@@ -335,6 +439,395 @@ is used in assert() statements. */
 							TaskHandle_t * const pxCreatedTask ) PRIVILEGED_FUNCTION;
 #endif
 
+/**
+ * task. h
+ *<pre>
+ BaseType_t xTaskPeriodicCreate(
+							  TaskFunction_t pvTaskCode,
+							  const char * const pcName,
+							  configSTACK_DEPTH_TYPE usStackDepth,
+							  void *pvParameters,
+							  UBaseType_t uxPriority,
+							  TaskHandle_t *pvCreatedTask,
+							  TickType_t period
+						  );</pre>
+ *
+ * Used in place of xTaskCreate() when configUSE_EDF_SCHEDULER is set to 1.
+ * Creates a periodic task that is scheduled by its absolute deadline, the
+ * first deadline being period ticks after the task is created.  The other
+ * parameters and the return value are as per xTaskCreate().
+ *
+ * @param period The period of the task in ticks.  The relative deadline of
+ * each job is equal to the period, and the first job is released when the task
+ * is created, as when xTaskPeriodicCreateConstrained() is called with only the
+ * xPeriod member of the parameters set.
+ *
+ * \defgroup xTaskPeriodicCreate xTaskPeriodicCreate
+ * \ingroup Tasks
+ */
+#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) )
+	BaseType_t xTaskPeriodicCreate(	TaskFunction_t pxTaskCode,
+									const char * const pcName,	/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+									const configSTACK_DEPTH_TYPE usStackDepth,
+									void * const pvParameters,
+									UBaseType_t uxPriority,
+									TaskHandle_t * const pxCreatedTask,
+									TickType_t period ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ *<pre>
+ BaseType_t xTaskPeriodicCreateConstrained(
+							  TaskFunction_t pvTaskCode,
+							  const char * const pcName,
+							  configSTACK_DEPTH_TYPE usStackDepth,
+							  void *pvParameters,
+							  UBaseType_t uxPriority,
+							  TaskHandle_t *pvCreatedTask,
+							  const TaskPeriodicParameters_t * const pxPeriodicParameters
+						  );</pre>
+ *
+ * As xTaskPeriodicCreate(), but the relative deadline of each job can be
+ * shorter than the period, the release of the first job can be offset from the
+ * time the task is created, and the worst case execution time of a job can be
+ * recorded.
+ *
+ * Each job of the task is scheduled by the deadline xRelativeDeadline ticks
+ * after its release.  A task created with a non zero xPhase remains in the
+ * Blocked state until its first job is released xPhase ticks after the task is
+ * created, or after the scheduler is started if the task is created before the
+ * scheduler, which allows the first jobs of a task set to be spread out rather
+ * than all released at once.
+ *
+ * @param pxPeriodicParameters Pointer to the timing parameters of the task.
+ * The structure is copied, so it need not persist after the call.  If NULL
+ * then the task is created in the background, as by xTaskBackgroundCreate().
+ *
+ * If configUSE_EDF_ADMISSION_CONTROL is set to 1 then the task is only created
+ * if every job of every periodic task, including the new one, would still meet
+ * its deadline, based on the worst case execution times of the tasks.  A task
+ * created without a worst case execution time is assumed to need none.  When
+ * every task has a deadline equal to its period the test is that the
+ * utilisation of the tasks is no more than 1, otherwise it is a processor
+ * demand analysis.
+ *
+ * If configUSE_MUTEXES is also set to 1 then a task that holds a mutex needed
+ * by a task with an earlier deadline inherits that deadline until it gives back
+ * the mutex, which bounds the time a job can be blocked to the time the tasks
+ * with later deadlines hold the mutexes it needs.  The sum of those times is
+ * given as xBlockingTime and is added to the demand of the job in the
+ * admission test.
+ *
+ * @return pdPASS if the task was created, pdFAIL if the timing parameters are
+ * not valid, errTASK_SET_NOT_SCHEDULABLE if the task was refused by the
+ * admission test, otherwise as per xTaskCreate().
+ *
+ * Example usage:
+   <pre>
+ // Sample the control input every 10 ticks, completing each job within 4 ticks
+ // of its release.  The first job is released 2 ticks after the other tasks.
+ static const TaskPeriodicParameters_t xControlTiming = { 10, 4, 2, 0, 0 };
+
+ void vCreateControlTask( void )
+ {
+	xTaskPeriodicCreateConstrained( vControlTask, "Control", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY, NULL, &xControlTiming );
+ }
+   </pre>
+ * \defgroup xTaskPeriodicCreateConstrained xTaskPeriodicCreateConstrained
+ * \ingroup Tasks
+ */
+#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) )
+	BaseType_t xTaskPeriodicCreateConstrained(	TaskFunction_t pxTaskCode,
+												const char * const pcName,	/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+												const configSTACK_DEPTH_TYPE usStackDepth,
+												void * const pvParameters,
+												UBaseType_t uxPriority,
+												TaskHandle_t * const pxCreatedTask,
+												const TaskPeriodicParameters_t * const pxPeriodicParameters ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ *<pre>
+ BaseType_t xTaskBackgroundCreate(
+							  TaskFunction_t pvTaskCode,
+							  const char * const pcName,
+							  configSTACK_DEPTH_TYPE usStackDepth,
+							  void *pvParameters,
+							  UBaseType_t uxPriority,
+							  TaskHandle_t *pvCreatedTask
+						  );</pre>
+ *
+ * Creates a best effort task that has no period or deadline.  The task runs
+ * in the background, with the idle task, so only while no task with a deadline
+ * is ready.  Background tasks share the processor in turn, as tasks of equal
+ * priority do when configUSE_TIME_SLICING is set to 1, and are not included in
+ * the admission test.  The parameters and the return value are as per
+ * xTaskCreate().  Tasks created by xTaskCreateStatic(), xTaskCreateRestricted()
+ * or xTaskCreateRestrictedStatic() while configUSE_EDF_SCHEDULER is set to 1
+ * have no timing parameters either, so also run in the background.
+ *
+ * When configUSE_EDF_HYBRID_SCHEDULING is set to 1 a task created with a
+ * priority above configEDF_MAX_PRIORITY is instead scheduled by its priority,
+ * ahead of every task with a deadline, as it would be without EDF.  Such tasks
+ * suit work that must not wait for the earliest deadline, such as deferred
+ * interrupt processing.
+ *
+ * \defgroup xTaskBackgroundCreate xTaskBackgroundCreate
+ * \ingroup Tasks
+ */
+#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) )
+	BaseType_t xTaskBackgroundCreate(	TaskFunction_t pxTaskCode,
+										const char * const pcName,	/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+										const configSTACK_DEPTH_TYPE usStackDepth,
+										void * const pvParameters,
+										UBaseType_t uxPriority,
+										TaskHandle_t * const pxCreatedTask ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ *<pre>
+ BaseType_t xTaskServerCreate(
+							  TaskFunction_t pvTaskCode,
+							  const char * const pcName,
+							  configSTACK_DEPTH_TYPE usStackDepth,
+							  void *pvParameters,
+							  UBaseType_t uxPriority,
+							  TaskHandle_t *pvCreatedTask,
+							  TickType_t xBudget,
+							  TickType_t xPeriod
+						  );</pre>
+ *
+ * configUSE_EDF_BANDWIDTH_SERVER must be set to 1 for this function to be
+ * available.
+ *
+ * Creates a task that is run by a constant bandwidth server, for aperiodic or
+ * soft real-time work that is done whenever the task has it, such as handling
+ * the messages received on a queue, rather than in periodic jobs.  The task
+ * blocks on queues, semaphores, stream buffers, task notifications or delays as
+ * any other task would, and does not call xTaskJobComplete().
+ *
+ * Whenever the task is ready it is scheduled by a deadline assigned by the
+ * server.  Every tick the task runs for is charged to its budget, and each time
+ * the budget is used up it is recharged and the deadline is moved one period
+ * later, so the task can keep running while no task with an earlier deadline is
+ * ready.  When the task becomes ready it keeps its deadline and what is left of
+ * its budget if that would not take more than its bandwidth of xBudget /
+ * xPeriod, otherwise it is given a full budget and a deadline xPeriod ticks
+ * away.  The task therefore never takes more than its bandwidth from the
+ * periodic tasks, however much work it has, so it cannot make them miss their
+ * deadlines.
+ *
+ * @param xBudget The number of ticks the task can run for in each server
+ * period.  Must be greater than zero.
+ *
+ * @param xPeriod The server period in ticks.  The server is admitted by
+ * configUSE_EDF_ADMISSION_CONTROL as a periodic task with a deadline equal to
+ * xPeriod and a worst case execution time of xBudget.
+ *
+ * The other parameters and the return value are as per
+ * xTaskPeriodicCreateConstrained().
+ *
+ * Example usage:
+   <pre>
+ // Handle commands as they arrive, using at most 2 ticks in every 20.
+ void vCommandTask( void *pvParameters )
+ {
+ Command_t xCommand;
+
+	for( ;; )
+	{
+		xQueueReceive( xCommandQueue, &xCommand, portMAX_DELAY );
+		vHandleCommand( &xCommand );
+	}
+ }
+
+ void vCreateCommandTask( void )
+ {
+	xTaskServerCreate( vCommandTask, "Commands", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY, NULL, 2, 20 );
+ }
+   </pre>
+ * \defgroup xTaskServerCreate xTaskServerCreate
+ * \ingroup Tasks
+ */
+#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_EDF_BANDWIDTH_SERVER == 1 ) )
+	BaseType_t xTaskServerCreate(	TaskFunction_t pxTaskCode,
+									const char * const pcName,	/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+									const configSTACK_DEPTH_TYPE usStackDepth,
+									void * const pvParameters,
+									UBaseType_t uxPriority,
+									TaskHandle_t * const pxCreatedTask,
+									TickType_t xBudget,
+									TickType_t xPeriod ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ *<pre>
+ BaseType_t xTaskSporadicCreate(
+							  TaskFunction_t pvTaskCode,
+							  const char * const pcName,
+							  configSTACK_DEPTH_TYPE usStackDepth,
+							  void *pvParameters,
+							  UBaseType_t uxPriority,
+							  TaskHandle_t *pvCreatedTask,
+							  const TaskPeriodicParameters_t * const pxSporadicParameters
+						  );</pre>
+ *
+ * configUSE_EDF_SPORADIC_TASKS must be set to 1 for this function to be
+ * available.
+ *
+ * Creates a sporadic task, the jobs of which are released by events rather
+ * than at a fixed period.  Each job arrives when the task is given a
+ * notification with xTaskNotifyGive() or vTaskNotifyGiveFromISR(), for example
+ * from the interrupt that detects the event, or from the task that sends the
+ * item the job is to process to a queue.  The task ends each job with
+ * xTaskJobComplete(), which waits for the next arrival if the notification
+ * value of the task is zero, otherwise takes one arrival from it.  The
+ * notification value of a sporadic task must not be used for anything else.
+ *
+ * The xPeriod member of the parameters is the minimum inter-arrival time of
+ * the jobs.  The kernel enforces it by releasing each job no earlier than
+ * xPeriod ticks after the release of the job before it: a job that arrives
+ * earlier is deferred, and given the deadline of a job released at the earliest
+ * time allowed.  The deadline of every job is xRelativeDeadline ticks after its
+ * release, so it is xRelativeDeadline ticks after its arrival unless it arrived
+ * early.  Arrivals are counted in the notification value, so none are lost
+ * while the task is running a job.
+ *
+ * As the task never releases jobs more often than a periodic task with a
+ * period of xPeriod would, it is admitted by configUSE_EDF_ADMISSION_CONTROL as
+ * such a task.
+ *
+ * The first job is released when the task is created, or at xPhase, as for a
+ * periodic task, so the task can initialise itself before it first calls
+ * xTaskJobComplete() to wait for an arrival.  A job aborted by the
+ * eOverrunAbortJob overrun policy is replaced by a job released without an
+ * arrival.
+ *
+ * The other parameters and the return value are as per
+ * xTaskPeriodicCreateConstrained().
+ *
+ * Example usage:
+   <pre>
+ static TaskHandle_t xButtonTask;
+
+ // Handle each press of the button within 5 ticks.  The button is debounced
+ // by only accepting one press every 50 ticks.
+ static const TaskPeriodicParameters_t xButtonTiming = { 50, 5, 0, 1, 0 };
+
+ void vButtonTask( void *pvParameters )
+ {
+	for( ;; )
+	{
+		xTaskJobComplete();
+
+		// Handle the button press here.
+	}
+ }
+
+ void vButtonInterruptHandler( void )
+ {
+ BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	vTaskNotifyGiveFromISR( xButtonTask, &xHigherPriorityTaskWoken );
+	portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+ }
+
+ void vCreateButtonTask( void )
+ {
+	xTaskSporadicCreate( vButtonTask, "Button", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY, &xButtonTask, &xButtonTiming );
+ }
+   </pre>
+ * \defgroup xTaskSporadicCreate xTaskSporadicCreate
+ * \ingroup Tasks
+ */
+#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_EDF_SPORADIC_TASKS == 1 ) )
+	BaseType_t xTaskSporadicCreate(	TaskFunction_t pxTaskCode,
+									const char * const pcName,	/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+									const configSTACK_DEPTH_TYPE usStackDepth,
+									void * const pvParameters,
+									UBaseType_t uxPriority,
+									TaskHandle_t * const pxCreatedTask,
+									const TaskPeriodicParameters_t * const pxSporadicParameters ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ *<pre>
+ TaskHandle_t xTaskPeriodicCreateStatic(
+							  TaskFunction_t pvTaskCode,
+							  const char * const pcName,
+							  uint32_t ulStackDepth,
+							  void *pvParameters,
+							  UBaseType_t uxPriority,
+							  StackType_t *pxStackBuffer,
+							  StaticTask_t *pxTaskBuffer,
+							  const TaskPeriodicParameters_t * const pxPeriodicParameters
+						  );</pre>
+ *
+ * As xTaskPeriodicCreateConstrained(), but the memory used by the task is
+ * provided by the application writer, as per xTaskCreateStatic().  If
+ * pxPeriodicParameters is NULL the task is created in the background, as per
+ * xTaskBackgroundCreate().
+ *
+ * @return A handle to the created task, or NULL if pxStackBuffer or
+ * pxTaskBuffer are NULL, the timing parameters are not valid, or the task was
+ * refused by the admission test.
+ *
+ * \defgroup xTaskPeriodicCreateStatic xTaskPeriodicCreateStatic
+ * \ingroup Tasks
+ */
+#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) )
+	TaskHandle_t xTaskPeriodicCreateStatic(	TaskFunction_t pxTaskCode,
+											const char * const pcName,	/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+											const uint32_t ulStackDepth,
+											void * const pvParameters,
+											UBaseType_t uxPriority,
+											StackType_t * const puxStackBuffer,
+											StaticTask_t * const pxTaskBuffer,
+											const TaskPeriodicParameters_t * const pxPeriodicParameters ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ *<pre>
+ TaskHandle_t xTaskServerCreateStatic(
+							  TaskFunction_t pvTaskCode,
+							  const char * const pcName,
+							  uint32_t ulStackDepth,
+							  void *pvParameters,
+							  UBaseType_t uxPriority,
+							  StackType_t *pxStackBuffer,
+							  StaticTask_t *pxTaskBuffer,
+							  TickType_t xBudget,
+							  TickType_t xPeriod
+						  );</pre>
+ *
+ * As xTaskServerCreate(), but the memory used by the task is provided by the
+ * application writer, as per xTaskCreateStatic().
+ *
+ * @return A handle to the created task, or NULL if pxStackBuffer or
+ * pxTaskBuffer are NULL, the server period is not valid, or the server was
+ * refused by the admission test.
+ *
+ * \defgroup xTaskServerCreateStatic xTaskServerCreateStatic
+ * \ingroup Tasks
+ */
+#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_EDF_BANDWIDTH_SERVER == 1 ) )
+	TaskHandle_t xTaskServerCreateStatic(	TaskFunction_t pxTaskCode,
+											const char * const pcName,	/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+											const uint32_t ulStackDepth,
+											void * const pvParameters,
+											UBaseType_t uxPriority,
+											StackType_t * const puxStackBuffer,
+											StaticTask_t * const pxTaskBuffer,
+											TickType_t xBudget,
+											TickType_t xPeriod ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  *<pre>
@@ -528,6 +1021,31 @@ TaskHandle_t xHandle;
 	BaseType_t xTaskCreateRestricted( const TaskParameters_t * const pxTaskDefinition, TaskHandle_t *pxCreatedTask ) PRIVILEGED_FUNCTION;
 #endif
 
+/**
+ * task. h
+ *<pre>
+ BaseType_t xTaskPeriodicCreateRestricted( TaskParameters_t *pxTaskDefinition, TaskHandle_t *pxCreatedTask, const TaskPeriodicParameters_t * const pxPeriodicParameters );</pre>
+ *
+ * Only available when configUSE_EDF_SCHEDULER and
+ * configSUPPORT_DYNAMIC_ALLOCATION are set to 1.
+ *
+ * As xTaskCreateRestricted(), but the task is scheduled by the timing
+ * parameters pointed to by pxPeriodicParameters, as per
+ * xTaskPeriodicCreateConstrained().  If pxPeriodicParameters is NULL the task
+ * is created in the background.
+ *
+ * @return pdPASS if the task was successfully created and added to a ready
+ * list, pdFAIL if the timing parameters are not valid,
+ * errTASK_SET_NOT_SCHEDULABLE if the task was refused by the admission test,
+ * otherwise an error code defined in the file projdefs.h
+ *
+ * \defgroup xTaskPeriodicCreateRestricted xTaskPeriodicCreateRestricted
+ * \ingroup Tasks
+ */
+#if( ( portUSING_MPU_WRAPPERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) )
+	BaseType_t xTaskPeriodicCreateRestricted( const TaskParameters_t * const pxTaskDefinition, TaskHandle_t *pxCreatedTask, const TaskPeriodicParameters_t * const pxPeriodicParameters ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  *<pre>
@@ -616,6 +1134,31 @@ TaskHandle_t xHandle;
 	BaseType_t xTaskCreateRestrictedStatic( const TaskParameters_t * const pxTaskDefinition, TaskHandle_t *pxCreatedTask ) PRIVILEGED_FUNCTION;
 #endif
 
+/**
+ * task. h
+ *<pre>
+ BaseType_t xTaskPeriodicCreateRestrictedStatic( TaskParameters_t *pxTaskDefinition, TaskHandle_t *pxCreatedTask, const TaskPeriodicParameters_t * const pxPeriodicParameters );</pre>
+ *
+ * Only available when configUSE_EDF_SCHEDULER and
+ * configSUPPORT_STATIC_ALLOCATION are set to 1.
+ *
+ * As xTaskCreateRestrictedStatic(), but the task is scheduled by the timing
+ * parameters pointed to by pxPeriodicParameters, as per
+ * xTaskPeriodicCreateConstrained().  If pxPeriodicParameters is NULL the task
+ * is created in the background.
+ *
+ * @return pdPASS if the task was successfully created and added to a ready
+ * list, pdFAIL if the timing parameters are not valid,
+ * errTASK_SET_NOT_SCHEDULABLE if the task was refused by the admission test,
+ * otherwise an error code defined in the file projdefs.h
+ *
+ * \defgroup xTaskPeriodicCreateRestrictedStatic xTaskPeriodicCreateRestrictedStatic
+ * \ingroup Tasks
+ */
+#if( ( portUSING_MPU_WRAPPERS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) )
+	BaseType_t xTaskPeriodicCreateRestrictedStatic( const TaskParameters_t * const pxTaskDefinition, TaskHandle_t *pxCreatedTask, const TaskPeriodicParameters_t * const pxPeriodicParameters ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  *<pre>
@@ -816,6 +1359,150 @@ void vTaskDelay( const TickType_t xTicksToDelay ) PRIVILEGED_FUNCTION;
  */
 void vTaskDelayUntil( TickType_t * const pxPreviousWakeTime, const TickType_t xTimeIncrement ) PRIVILEGED_FUNCTION;
 
+/**
+ * task. h
+ * <pre>BaseType_t xTaskJobComplete( void );</pre>
+ *
+ * configUSE_EDF_SCHEDULER must be defined as 1 for this function to be
+ * available, and it can only be called by a periodic task.
+ *
+ * Called by a periodic task when it has completed its current job.  The task
+ * is placed in the Blocked state until its next job is released, one period
+ * after the release of the job that has completed, and the kernel gives the
+ * next job the deadline set by the relative deadline of the task.  The period
+ * and deadline are those given when the task was created, so, unlike
+ * vTaskDelayUntil(), the task does not need to keep track of its own wake time.
+ *
+ * If the next job should already have been released, because the job that has
+ * completed overran its period, then the next job is released immediately and
+ * the task does not block.
+ *
+ * When configUSE_EDF_OVERRUN_HANDLING is 1 the overrun policy of the task can
+ * change when the next job is released, see vTaskSetOverrunPolicy().
+ *
+ * A sporadic task, created with xTaskSporadicCreate(), instead waits for the
+ * arrival of its next job if no job has arrived since the last one was
+ * released.
+ *
+ * @return pdPASS if the job that has completed did so by its deadline,
+ * otherwise pdFAIL.
+ *
+ * Example usage:
+   <pre>
+ // Perform an action every 10 ticks.
+ void vTaskFunction( void * pvParameters )
+ {
+	for( ;; )
+	{
+		// Perform action here.
+
+		if( xTaskJobComplete() != pdPASS )
+		{
+			// The action completed after its deadline.
+		}
+	}
+ }
+
+ // The task is created with a period of 10 ticks.
+ xTaskPeriodicCreate( vTaskFunction, "Periodic", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY, NULL, 10 );
+   </pre>
+ * \defgroup xTaskJobComplete xTaskJobComplete
+ * \ingroup TaskCtrl
+ */
+#if( configUSE_EDF_SCHEDULER == 1 )
+	BaseType_t xTaskJobComplete( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * <pre>BaseType_t xTaskSetTiming( TaskHandle_t xTask, const TaskPeriodicParameters_t * const pxPeriodicParameters );</pre>
+ *
+ * configUSE_EDF_MODE_CHANGE must be defined as 1 for this function to be
+ * available.
+ *
+ * Changes the period, relative deadline, worst case execution time and
+ * blocking time of a periodic or sporadic task, for example to run a control
+ * loop faster while the system is in a different operating mode.  The phase
+ * is ignored.  The change is the same as calling xTaskSetTimingGroup() with
+ * a group of one task.
+ *
+ * @param xTask The handle of the task.  Passing NULL changes the timing of
+ * the calling task.
+ *
+ * @param pxPeriodicParameters The new timing of the task.
+ *
+ * @return As xTaskSetTimingGroup().
+ *
+ * \defgroup xTaskSetTiming xTaskSetTiming
+ * \ingroup TaskCtrl
+ */
+BaseType_t xTaskSetTiming( TaskHandle_t xTask, const TaskPeriodicParameters_t * const pxPeriodicParameters ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <pre>BaseType_t xTaskSetTimingGroup( const TaskHandle_t * const pxTasks, const TaskPeriodicParameters_t * const pxPeriodicParameters, UBaseType_t uxNumberOfTasks );</pre>
+ *
+ * configUSE_EDF_MODE_CHANGE must be defined as 1 for this function to be
+ * available.
+ *
+ * Changes the timing of a group of periodic or sporadic tasks together, as
+ * when the system moves to a new operating mode.  Either every change is
+ * accepted or none is.  If configUSE_EDF_ADMISSION_CONTROL is 1 the changes
+ * are only accepted if the task set they lead to passes the admission test.
+ *
+ * A task keeps its current job, and that job keeps its deadline.  The new
+ * timing takes effect between jobs, so the first job with the new timing is
+ * released one old period after the current job.  A change that can raise the
+ * processor demand of its task, by raising its utilisation (execution time
+ * over period) or density (execution time over deadline) or lengthening its
+ * blocking time, takes effect when the next job of the task is released, and
+ * only once every pending change that cannot has taken effect.  A change that
+ * cannot raise demand takes effect as soon as the task has no job in
+ * progress, which is at once for a task waiting for its next release.  If a
+ * job never completes, for example because its task has been suspended, the
+ * changes waiting for it stop waiting once its deadline has passed.  The
+ * processor time the other tasks give up is then given up before it is taken,
+ * and the processor is not overloaded while the modes overlap.  While changes
+ * are pending, the admission test only accepts a new task if the task set
+ * fits both with and without them.
+ *
+ * @param pxTasks An array of the handles of the tasks to change.  An entry of
+ * NULL changes the timing of the calling task.
+ *
+ * @param pxPeriodicParameters An array of the new timing of each task, in the
+ * same order as pxTasks.
+ *
+ * @param uxNumberOfTasks The number of tasks in the group.
+ *
+ * @return pdPASS if the changes were accepted, errTASK_SET_NOT_SCHEDULABLE if
+ * they were refused by the admission test, or pdFAIL if a task of the group
+ * is not periodic or sporadic, is a server, appears twice or already has a
+ * change pending, or if any of the new timing is not valid, as for
+ * xTaskPeriodicCreateConstrained().
+ *
+ * Example usage:
+   <pre>
+ // Run the control loop twice as often, giving up the time the logger needs.
+ void vEnterTransientMode( void )
+ {
+ TaskHandle_t xTasks[ 2 ] = { xControlTask, xLoggerTask };
+ const TaskPeriodicParameters_t xTiming[ 2 ] =
+ {
+	{ 5, 5, 0, 2, 0 },		// Control loop: period 5, execution time 2.
+	{ 200, 200, 0, 10, 0 }	// Logger: period 200, execution time 10.
+ };
+
+	if( xTaskSetTimingGroup( xTasks, xTiming, 2 ) != pdPASS )
+	{
+		// The tasks keep their timing.
+	}
+ }
+   </pre>
+ * \defgroup xTaskSetTimingGroup xTaskSetTimingGroup
+ * \ingroup TaskCtrl
+ */
+BaseType_t xTaskSetTimingGroup( const TaskHandle_t * const pxTasks, const TaskPeriodicParameters_t * const pxPeriodicParameters, UBaseType_t uxNumberOfTasks ) PRIVILEGED_FUNCTION;
+
 /**
  * task. h
  * <pre>BaseType_t xTaskAbortDelay( TaskHandle_t xTask );</pre>
@@ -1771,6 +2458,228 @@ void vTaskGetRunTimeStats( char *pcWriteBuffer ) PRIVILEGED_FUNCTION; /*lint !e9
 */
 uint32_t ulTaskGetIdleRunTimeCounter( void ) PRIVILEGED_FUNCTION;
 
+/**
+ * task. h
+ * <PRE>void vTaskGetReleaseJitter( TaskHandle_t xTask, TaskReleaseJitter_t *pxReleaseJitter );</PRE>
+ *
+ * configUSE_EDF_SCHEDULER must be defined as 1 for this function to be
+ * available.
+ *
+ * The jobs of a periodic task are released at nominal release times, the
+ * times to which vTaskDelayUntil() delays the task, and the deadline of each
+ * job is calculated from its nominal release time.  A job can be released
+ * later than its nominal release time, for example if the task is still
+ * completing the previous job at that time.  vTaskGetReleaseJitter() returns
+ * how late the jobs of a task have been released.
+ *
+ * @param xTask The handle of the task being queried.  Passing NULL queries
+ * the calling task.
+ *
+ * @param pxReleaseJitter Pointer to the structure into which the release
+ * jitter of the task, in ticks, is written.
+ *
+ * \defgroup vTaskGetReleaseJitter vTaskGetReleaseJitter
+ * \ingroup TaskUtils
+ */
+#if( configUSE_EDF_SCHEDULER == 1 )
+	void vTaskGetReleaseJitter( TaskHandle_t xTask, TaskReleaseJitter_t *pxReleaseJitter ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * <PRE>void vTaskGetJobStatistics( TaskHandle_t xTask, TaskJobStatistics_t *pxJobStatistics );</PRE>
+ *
+ * configUSE_EDF_TASK_STATISTICS must be defined as 1 for this function to be
+ * available.
+ *
+ * The kernel records each job of a periodic task as it is released, and as it
+ * completes, which is when the task calls xTaskJobComplete(), or delays until
+ * its next release with vTaskDelayUntil() or vTaskDelay().  The work done is
+ * the same however many tasks there are, and nothing is added to the context
+ * switch.  The jobs of tasks that are not periodic, including constant
+ * bandwidth servers, are not recorded.
+ *
+ * The same statistics are returned for every task by uxTaskGetSystemState(),
+ * in the xJobStatistics member of each TaskStatus_t structure.  Setting
+ * configEDF_RESPONSE_TIME_HISTOGRAM_BINS above 0 adds a histogram of the
+ * response times to the statistics, with bins
+ * configEDF_RESPONSE_TIME_HISTOGRAM_WIDTH ticks wide.
+ *
+ * @param xTask The handle of the task being queried.  Passing NULL queries
+ * the calling task.
+ *
+ * @param pxJobStatistics Pointer to the structure into which the statistics
+ * of the jobs of the task are written.  See the definition of
+ * TaskJobStatistics_t for the meaning of each member.
+ *
+ * \defgroup vTaskGetJobStatistics vTaskGetJobStatistics
+ * \ingroup TaskUtils
+ */
+void vTaskGetJobStatistics( TaskHandle_t xTask, TaskJobStatistics_t *pxJobStatistics ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>void vTaskGetUtilisation( TaskHandle_t xTask, TaskUtilisation_t *pxUtilisation );</PRE>
+ *
+ * configUSE_EDF_UTILISATION_MONITOR must be defined as 1 for this function to
+ * be available.
+ *
+ * The kernel measures the fraction of each window of
+ * configEDF_UTILISATION_WINDOW_TICKS ticks that every task spends running,
+ * using the run time stats counter, and keeps an exponentially weighted
+ * moving average of it.  The time a task has run is added when it is switched
+ * out, and its average is only brought up to date when it next runs or is
+ * queried, so the monitor adds a few additions and shifts to the context
+ * switch however many tasks there are, and no divisions.
+ *
+ * The measured utilisation of a task can be compared with the utilisation
+ * declared by its timing, which is returned alongside it.  A periodic task
+ * whose measured utilisation approaches its declared utilisation is close to
+ * exhausting its budget.
+ *
+ * @param xTask The handle of the task being queried.  Passing NULL queries
+ * the calling task.
+ *
+ * @param pxUtilisation Pointer to the structure into which the utilisation of
+ * the task is written.  See the definition of TaskUtilisation_t for the
+ * meaning of each member.
+ *
+ * \defgroup vTaskGetUtilisation vTaskGetUtilisation
+ * \ingroup TaskUtils
+ */
+void vTaskGetUtilisation( TaskHandle_t xTask, TaskUtilisation_t *pxUtilisation ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>void vTaskGetSystemUtilisation( TaskUtilisation_t *pxUtilisation );</PRE>
+ *
+ * configUSE_EDF_UTILISATION_MONITOR must be defined as 1 for this function to
+ * be available.
+ *
+ * Returns the utilisation of the processor, which is the time spent running
+ * any task other than the idle task, measured as by vTaskGetUtilisation().  A
+ * rising moving average shows the system heading towards overload before any
+ * deadline is missed.
+ *
+ * @param pxUtilisation Pointer to the structure into which the utilisation of
+ * the processor is written.  ulDeclaredUtilisation is the value returned by
+ * ulTaskGetEDFUtilisation() if configUSE_EDF_ADMISSION_CONTROL is 1, otherwise
+ * 0.
+ *
+ * \defgroup vTaskGetSystemUtilisation vTaskGetSystemUtilisation
+ * \ingroup TaskUtils
+ */
+void vTaskGetSystemUtilisation( TaskUtilisation_t *pxUtilisation ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>uint32_t ulTaskGetEDFUtilisation( void );</PRE>
+ *
+ * configUSE_EDF_ADMISSION_CONTROL must be defined as 1 for this function to be
+ * available.
+ *
+ * @return The sum of the utilisations, worst case execution time divided by
+ * period, of the periodic tasks accepted by the admission test, where
+ * tskEDF_FULL_UTILISATION represents a utilisation of 1.  Each utilisation is
+ * rounded up.
+ *
+ * \defgroup ulTaskGetEDFUtilisation ulTaskGetEDFUtilisation
+ * \ingroup TaskUtils
+ */
+uint32_t ulTaskGetEDFUtilisation( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>uint32_t ulTaskGetEDFSpareUtilisation( void );</PRE>
+ *
+ * configUSE_EDF_ADMISSION_CONTROL must be defined as 1 for this function to be
+ * available.
+ *
+ * @return The utilisation left over by the admitted periodic tasks, which is
+ * tskEDF_FULL_UTILISATION less the value returned by ulTaskGetEDFUtilisation(),
+ * or 0 if the utilisation is 1 or more.  When every deadline is equal to its
+ * period a new task fits if its utilisation is no more than this, otherwise it
+ * is an upper bound.
+ *
+ * \defgroup ulTaskGetEDFSpareUtilisation ulTaskGetEDFSpareUtilisation
+ * \ingroup TaskUtils
+ */
+uint32_t ulTaskGetEDFSpareUtilisation( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>void vTaskSetOverrunPolicy( TaskHandle_t xTask, eOverrunPolicy ePolicy );</PRE>
+ *
+ * configUSE_EDF_OVERRUN_HANDLING must be defined as 1 for this function to be
+ * available.
+ *
+ * The kernel checks the job of the running periodic task on each tick.  The
+ * job overruns if it has not completed by its deadline, or, when
+ * configGENERATE_RUN_TIME_STATS is 1 and the task has a worst case execution
+ * time, if it has executed for longer than that time.  The execution time is
+ * measured with the run time stats counter, converted from ticks by
+ * configEDF_RUN_TIME_COUNTS_PER_TICK.  An overrun the tick does not see, for
+ * example of a job that is blocked at its deadline, is found when the job
+ * calls xTaskJobComplete().  Each overrun is counted, see
+ * vTaskGetOverrunStatus(), and passed to vApplicationOverrunHook( TaskHandle_t
+ * xTask, eOverrunType eType ) if configUSE_EDF_OVERRUN_HOOK is 1.  The hook is
+ * called from the tick interrupt, so it must not block.
+ *
+ * Overruns seen by the tick are then handled as set by the policy of the task:
+ *
+ * eOverrunNotify:  No further action.
+ *
+ * eOverrunAbortJob:  The job is abandoned and the task is not selected to run
+ * again until its next job is released.  The kernel cannot unwind the task, so
+ * when it runs again it is told the job was aborted instead: until it next
+ * calls xTaskJobComplete() any queue, semaphore, mutex, stream buffer or task
+ * notification call that would block it returns at once as if its block time
+ * had expired, so the code of the aborted job ends as soon as it next waits
+ * for one of those.  That call to xTaskJobComplete() then returns pdFAIL
+ * immediately, without blocking, as the next job has already been released.
+ * Event group waits and delays requested with vTaskDelay() or
+ * vTaskDelayUntil() are not shortened.
+ *
+ * eOverrunDemote:  The rest of the job runs in the background, behind every
+ * task that has a deadline.  The task returns to deadline order when its next
+ * job is released.
+ *
+ * eOverrunSkipNextRelease:  The job keeps its deadline, but the next job is
+ * released two periods after the overrunning job rather than one, giving back
+ * the processor time the overrun used.  Only applies to tasks that use
+ * xTaskJobComplete().
+ *
+ * Each task starts with the policy configEDF_DEFAULT_OVERRUN_POLICY, which is
+ * eOverrunNotify if it is not defined.
+ *
+ * @param xTask The handle of the task.  Passing NULL sets the policy of the
+ * calling task.
+ *
+ * @param ePolicy The policy to apply to later overruns.
+ *
+ * \defgroup vTaskSetOverrunPolicy vTaskSetOverrunPolicy
+ * \ingroup TaskCtrl
+ */
+void vTaskSetOverrunPolicy( TaskHandle_t xTask, eOverrunPolicy ePolicy ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>void vTaskGetOverrunStatus( TaskHandle_t xTask, TaskOverrunStatus_t *pxOverrunStatus );</PRE>
+ *
+ * configUSE_EDF_OVERRUN_HANDLING must be defined as 1 for this function to be
+ * available.  See vTaskSetOverrunPolicy() for when jobs overrun.
+ *
+ * @param xTask The handle of the task being queried.  Passing NULL queries
+ * the calling task.
+ *
+ * @param pxOverrunStatus Pointer to the structure into which the number of
+ * deadline misses and budget overruns of the task is written.
+ *
+ * \defgroup vTaskGetOverrunStatus vTaskGetOverrunStatus
+ * \ingroup TaskUtils
+ */
+void vTaskGetOverrunStatus( TaskHandle_t xTask, TaskOverrunStatus_t *pxOverrunStatus ) PRIVILEGED_FUNCTION;
+
 /**
  * task. h
  * <PRE>BaseType_t xTaskNotify( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction );</PRE>
@@ -2451,13 +3360,17 @@ BaseType_t xTaskGetSchedulerState( void ) PRIVILEGED_FUNCTION;
 
 /*
  * Raises the priority of the mutex holder to that of the calling task should
- * the mutex holder have a priority less than the calling task.
+ * the mutex holder have a priority less than the calling task.  If
+ * configUSE_EDF_SCHEDULER is 1 the mutex holder instead inherits the deadline
+ * of the calling task should it have a later deadline.
  */
 BaseType_t xTaskPriorityInherit( TaskHandle_t const pxMutexHolder ) PRIVILEGED_FUNCTION;
 
 /*
  * Set the priority of a task back to its proper priority in the case that it
- * inherited a higher priority while it was holding a semaphore.
+ * inherited a higher priority while it was holding a semaphore.  If
+ * configUSE_EDF_SCHEDULER is 1 the deadline is set back instead, once the task
+ * holds no mutexes.
  */
 BaseType_t xTaskPriorityDisinherit( TaskHandle_t const pxMutexHolder ) PRIVILEGED_FUNCTION;
 
@@ -2469,7 +3382,21 @@ BaseType_t xTaskPriorityDisinherit( TaskHandle_t const pxMutexHolder ) PRIVILEGE
  * the highest priority task that is still waiting for the mutex (if there were
  * more than one task waiting for the mutex).
  */
-void vTaskPriorityDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder, UBaseType_t uxHighestPriorityWaitingTask ) PRIVILEGED_FUNCTION;
+#if ( configUSE_EDF_SCHEDULER == 0 )
+	void vTaskPriorityDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder, UBaseType_t uxHighestPriorityWaitingTask ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * Used in place of vTaskPriorityDisinheritAfterTimeout() when
+ * configUSE_EDF_SCHEDULER is 1.  If a task waiting for a mutex caused the
+ * holder to inherit its deadline but then timed out, the holder keeps only the
+ * earliest deadline of the tasks still waiting in pxTasksWaitingForMutex, or
+ * returns to its own deadline if that is earlier.  Under hybrid scheduling a
+ * priority inherited from the fixed priority band is lowered in the same way.
+ */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+	void vTaskDeadlineDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder, const List_t * const pxTasksWaitingForMutex ) PRIVILEGED_FUNCTION;
+#endif
 
 /*
  * Get the uxTCBNumber assigned to the task referenced by the xTask parameter.
@@ -2488,9 +3415,46 @@ void vTaskSetTaskNumber( TaskHandle_t xTask, const UBaseType_t uxHandle ) PRIVIL
  * the tick interrupt will not execute during idle periods.  When this is the
  * case, the tick count value maintained by the scheduler needs to be kept up
  * to date with the actual execution time by being skipped forward by a time
- * equal to the idle period.
- */
-void vTaskStepTick( const TickType_t xTicksToJump ) PRIVILEGED_FUNCTION;
+ * equal to the idle period.  If the jump reaches the time at which the next
+ * task is due to leave the Blocked state then the last tick is processed as a
+ * pended tick when the scheduler is resumed, so the task is unblocked on time.
+ *
+ * Note for port writers:  this holds for every port, not only those that use
+ * the EDF scheduler.  vTaskStepTick() must be called from
+ * portSUPPRESS_TICKS_AND_SLEEP(), with the scheduler suspended, as the idle
+ * task does.  Until the scheduler is resumed the tick count can be one less
+ * than the number of ticks slept, and the pended tick is counted when it is
+ * processed.  The port must therefore not process that tick itself, for
+ * example by calling xTaskIncrementTick() after vTaskStepTick(), nor add it to
+ * the count it passes to vTaskStepTick().  Ports written for earlier versions,
+ * which step the tick count by the ticks that elapsed while the tick was
+ * suppressed, need no change.
+ */
+void vTaskStepTick( TickType_t xTicksToJump ) PRIVILEGED_FUNCTION;
+
+/*
+ * Only available when configUSE_EVENT_DRIVEN_TICK is set to 1.
+ * The port then programs its timer to interrupt only when the next event the
+ * kernel has to act on is due, rather than on every tick.  The tick count is
+ * kept, so all the tick based API functions are unchanged, and
+ * configTICK_RATE_HZ can be raised to the resolution of the timer so releases
+ * and deadlines are no longer rounded to a slow tick.
+ *
+ * xTaskGetTicksToNextEvent() returns the number of ticks, at least 1, from the
+ * current tick count to the next tick at which a task is due to unblock, the
+ * running task is to be time sliced or, under EDF, the running job misses its
+ * deadline or exhausts its budget.  It must be called with interrupts masked,
+ * and is called by the port from portSET_NEXT_TICK_EVENT(), which the kernel
+ * calls whenever a context switch may have changed the next event.
+ *
+ * xTaskAdvanceTicks() is called by the port from the timer interrupt with the
+ * number of ticks that have elapsed since it was last called.  The ticks at
+ * which nothing is due are stepped over, and the others processed as by
+ * xTaskIncrementTick(), the return value of which it returns.  Note the tick
+ * hook is only called for the ticks that are processed.
+ */
+TickType_t xTaskGetTicksToNextEvent( void ) PRIVILEGED_FUNCTION;
+BaseType_t xTaskAdvanceTicks( TickType_t xTicks ) PRIVILEGED_FUNCTION;
 
 /* Correct the tick count value after the application code has held
 interrupts disabled for an extended period.  xTicksToCatchUp is the number
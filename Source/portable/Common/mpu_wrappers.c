@@ -112,7 +112,33 @@ void vPortResetPrivilege( BaseType_t xRunningPrivileged )
 #endif /* conifgSUPPORT_DYNAMIC_ALLOCATION */
 /*-----------------------------------------------------------*/
 
-#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) )
+	BaseType_t MPU_xTaskPeriodicCreateRestricted( const TaskParameters_t * const pxTaskDefinition, TaskHandle_t *pxCreatedTask, const TaskPeriodicParameters_t * const pxPeriodicParameters ) /* FREERTOS_SYSTEM_CALL */
+	{
+	BaseType_t xReturn;
+	BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+
+		xReturn = xTaskPeriodicCreateRestricted( pxTaskDefinition, pxCreatedTask, pxPeriodicParameters );
+		vPortResetPrivilege( xRunningPrivileged );
+		return xReturn;
+	}
+#endif /* ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) )
+	BaseType_t MPU_xTaskPeriodicCreateRestrictedStatic( const TaskParameters_t * const pxTaskDefinition, TaskHandle_t *pxCreatedTask, const TaskPeriodicParameters_t * const pxPeriodicParameters ) /* FREERTOS_SYSTEM_CALL */
+	{
+	BaseType_t xReturn;
+	BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+
+		xReturn = xTaskPeriodicCreateRestrictedStatic( pxTaskDefinition, pxCreatedTask, pxPeriodicParameters );
+		vPortResetPrivilege( xRunningPrivileged );
+		return xReturn;
+	}
+#endif /* ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULER == 0 ) )
 	BaseType_t MPU_xTaskCreate( TaskFunction_t pvTaskCode, const char * const pcName, uint16_t usStackDepth, void *pvParameters, UBaseType_t uxPriority, TaskHandle_t *pxCreatedTask ) /* FREERTOS_SYSTEM_CALL */
 	{
 	BaseType_t xReturn;
@@ -122,7 +148,42 @@ void vPortResetPrivilege( BaseType_t xRunningPrivileged )
 		vPortResetPrivilege( xRunningPrivileged );
 		return xReturn;
 	}
-#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+#endif /* ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULER == 0 ) */
+/*-----------------------------------------------------------*/
+
+#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) )
+	BaseType_t MPU_xTaskPeriodicCreate( TaskFunction_t pxTaskCode, const char * const pcName, const configSTACK_DEPTH_TYPE usStackDepth, void * const pvParameters, UBaseType_t uxPriority, TaskHandle_t * const pxCreatedTask, TickType_t period ) /* FREERTOS_SYSTEM_CALL */
+	{
+	BaseType_t xReturn;
+	BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+
+		xReturn = xTaskPeriodicCreate( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pxCreatedTask, period );
+		vPortResetPrivilege( xRunningPrivileged );
+		return xReturn;
+	}
+/*-----------------------------------------------------------*/
+
+	BaseType_t MPU_xTaskPeriodicCreateConstrained( TaskFunction_t pxTaskCode, const char * const pcName, const configSTACK_DEPTH_TYPE usStackDepth, void * const pvParameters, UBaseType_t uxPriority, TaskHandle_t * const pxCreatedTask, const TaskPeriodicParameters_t * const pxPeriodicParameters ) /* FREERTOS_SYSTEM_CALL */
+	{
+	BaseType_t xReturn;
+	BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+
+		xReturn = xTaskPeriodicCreateConstrained( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pxCreatedTask, pxPeriodicParameters );
+		vPortResetPrivilege( xRunningPrivileged );
+		return xReturn;
+	}
+/*-----------------------------------------------------------*/
+
+	BaseType_t MPU_xTaskBackgroundCreate( TaskFunction_t pxTaskCode, const char * const pcName, const configSTACK_DEPTH_TYPE usStackDepth, void * const pvParameters, UBaseType_t uxPriority, TaskHandle_t * const pxCreatedTask ) /* FREERTOS_SYSTEM_CALL */
+	{
+	BaseType_t xReturn;
+	BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+
+		xReturn = xTaskBackgroundCreate( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pxCreatedTask );
+		vPortResetPrivilege( xRunningPrivileged );
+		return xReturn;
+	}
+#endif /* ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) */
 /*-----------------------------------------------------------*/
 
 #if( configSUPPORT_STATIC_ALLOCATION == 1 )
@@ -138,6 +199,19 @@ void vPortResetPrivilege( BaseType_t xRunningPrivileged )
 #endif /* configSUPPORT_STATIC_ALLOCATION */
 /*-----------------------------------------------------------*/
 
+#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) )
+	TaskHandle_t MPU_xTaskPeriodicCreateStatic( TaskFunction_t pxTaskCode, const char * const pcName, const uint32_t ulStackDepth, void * const pvParameters, UBaseType_t uxPriority, StackType_t * const puxStackBuffer, StaticTask_t * const pxTaskBuffer, const TaskPeriodicParameters_t * const pxPeriodicParameters ) /* FREERTOS_SYSTEM_CALL */
+	{
+	TaskHandle_t xReturn;
+	BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+
+		xReturn = xTaskPeriodicCreateStatic( pxTaskCode, pcName, ulStackDepth, pvParameters, uxPriority, puxStackBuffer, pxTaskBuffer, pxPeriodicParameters );
+		vPortResetPrivilege( xRunningPrivileged );
+		return xReturn;
+	}
+#endif /* ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) */
+/*-----------------------------------------------------------*/
+
 void MPU_vTaskAllocateMPURegions( TaskHandle_t xTask, const MemoryRegion_t * const xRegions ) /* FREERTOS_SYSTEM_CALL */
 {
 BaseType_t xRunningPrivileged = xPortRaisePrivilege();
@@ -58,6 +58,7 @@
 #define portNVIC_SYSTICK_COUNT_FLAG_BIT		( 1UL << 16UL )
 #define portNVIC_PENDSVCLEAR_BIT 			( 1UL << 27UL )
 #define portNVIC_PEND_SYSTICK_CLEAR_BIT		( 1UL << 25UL )
+#define portNVIC_PEND_SYSTICK_SET_BIT		( 1UL << 26UL )
 
 /* Constants used to detect a Cortex-M7 r0p1 core, which should use the ARM_CM7
 r0p1 port. */
@@ -148,25 +149,35 @@ static UBaseType_t uxCriticalNesting = 0xaaaaaaaa;
 /*
  * The number of SysTick increments that make up one tick period.
  */
-#if( configUSE_TICKLESS_IDLE == 1 )
+#if( ( configUSE_TICKLESS_IDLE == 1 ) || ( configUSE_EVENT_DRIVEN_TICK == 1 ) )
 	static uint32_t ulTimerCountsForOneTick = 0;
-#endif /* configUSE_TICKLESS_IDLE */
+#endif /* ( configUSE_TICKLESS_IDLE == 1 ) || ( configUSE_EVENT_DRIVEN_TICK == 1 ) */
 
 /*
  * The maximum number of tick periods that can be suppressed is limited by the
  * 24 bit resolution of the SysTick timer.
  */
-#if( configUSE_TICKLESS_IDLE == 1 )
+#if( ( configUSE_TICKLESS_IDLE == 1 ) || ( configUSE_EVENT_DRIVEN_TICK == 1 ) )
 	static uint32_t xMaximumPossibleSuppressedTicks = 0;
-#endif /* configUSE_TICKLESS_IDLE */
+#endif /* ( configUSE_TICKLESS_IDLE == 1 ) || ( configUSE_EVENT_DRIVEN_TICK == 1 ) */
 
 /*
  * Compensate for the CPU cycles that pass while the SysTick is stopped (low
- * power functionality only.
+ * power and event driven tick functionality only).
  */
-#if( configUSE_TICKLESS_IDLE == 1 )
+#if( ( configUSE_TICKLESS_IDLE == 1 ) || ( configUSE_EVENT_DRIVEN_TICK == 1 ) )
 	static uint32_t ulStoppedTimerCompensation = 0;
-#endif /* configUSE_TICKLESS_IDLE */
+#endif /* ( configUSE_TICKLESS_IDLE == 1 ) || ( configUSE_EVENT_DRIVEN_TICK == 1 ) */
+
+/*
+ * When the tick is event driven, the number of ticks from the last tick passed
+ * to the kernel to the end of the current SysTick period, and the number of
+ * SysTick increments from that tick to the start of the period.
+ */
+#if( configUSE_EVENT_DRIVEN_TICK == 1 )
+	static uint32_t ulTicksToEndOfPeriod = 1;
+	static uint32_t ulCountsBeforePeriod = 0;
+#endif /* configUSE_EVENT_DRIVEN_TICK */
 
 /*
  * Used by the portASSERT_IF_INTERRUPT_PRIORITY_INVALID() macro to ensure
@@ -493,18 +504,94 @@ void xPortSysTickHandler( void )
 	known. */
 	portDISABLE_INTERRUPTS();
 	{
-		/* Increment the RTOS tick. */
-		if( xTaskIncrementTick() != pdFALSE )
+		#if( configUSE_EVENT_DRIVEN_TICK == 1 )
 		{
-			/* A context switch is required.  Context switching is performed in
-			the PendSV interrupt.  Pend the PendSV interrupt. */
-			portNVIC_INT_CTRL_REG = portNVIC_PENDSVSET_BIT;
+			/* The SysTick period that has just ended was set to end at the
+			tick of the next event, so pass all its ticks to the kernel.  The
+			SysTick has reloaded, so the next period starts on a tick. */
+			if( xTaskAdvanceTicks( ( TickType_t ) ulTicksToEndOfPeriod ) != pdFALSE )
+			{
+				portNVIC_INT_CTRL_REG = portNVIC_PENDSVSET_BIT;
+			}
+
+			ulCountsBeforePeriod = 0UL;
+			vPortSetNextTickEvent();
 		}
+		#else
+		{
+			/* Increment the RTOS tick. */
+			if( xTaskIncrementTick() != pdFALSE )
+			{
+				/* A context switch is required.  Context switching is performed in
+				the PendSV interrupt.  Pend the PendSV interrupt. */
+				portNVIC_INT_CTRL_REG = portNVIC_PENDSVSET_BIT;
+			}
+		}
+		#endif /* configUSE_EVENT_DRIVEN_TICK */
 	}
 	portENABLE_INTERRUPTS();
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_EVENT_DRIVEN_TICK == 1 )
+
+	__attribute__((weak)) void vPortSetNextTickEvent( void )
+	{
+	uint32_t ulCountsSinceTick, ulMinimumCounts, ulTicksToEvent, ulReloadValue;
+
+		/* Called with interrupts masked, from the SysTick handler or from
+		vTaskSwitchContext() in the PendSV handler.  Stop the SysTick while it
+		is reprogrammed, without reading portNVIC_SYSTICK_CTRL_REG so the
+		portNVIC_SYSTICK_COUNT_FLAG_BIT is not cleared.  As with tickless idle,
+		the time it is stopped for is accounted for as best it can be. */
+		portNVIC_SYSTICK_CTRL_REG = ( portNVIC_SYSTICK_CLK_BIT | portNVIC_SYSTICK_INT_BIT );
+
+		if( ( portNVIC_INT_CTRL_REG & portNVIC_PEND_SYSTICK_SET_BIT ) != 0 )
+		{
+			/* The period has already ended.  The SysTick handler passes its
+			ticks to the kernel then sets the next event itself. */
+			portNVIC_SYSTICK_CTRL_REG |= portNVIC_SYSTICK_ENABLE_BIT;
+		}
+		else
+		{
+			/* The SysTick counts down from portNVIC_SYSTICK_LOAD_REG, so the
+			time since the last tick passed to the kernel is the time before
+			the current period plus the time spent in it. */
+			ulCountsSinceTick = ulCountsBeforePeriod + ( ( portNVIC_SYSTICK_LOAD_REG + 1UL ) - portNVIC_SYSTICK_CURRENT_VALUE_REG );
+
+			/* Make sure the SysTick reload value does not overflow the
+			counter. */
+			ulTicksToEvent = ( uint32_t ) xTaskGetTicksToNextEvent();
+			if( ulTicksToEvent > xMaximumPossibleSuppressedTicks )
+			{
+				ulTicksToEvent = xMaximumPossibleSuppressedTicks;
+			}
+
+			/* If the tick of the event has already passed, because the
+			interrupts were masked for longer than expected, end the period at
+			the next tick.  A reload value below 2 would stop the SysTick. */
+			ulMinimumCounts = ulCountsSinceTick + ulStoppedTimerCompensation + 1UL;
+			if( ( ulTicksToEvent * ulTimerCountsForOneTick ) <= ulMinimumCounts )
+			{
+				ulTicksToEvent = ( ulMinimumCounts / ulTimerCountsForOneTick ) + 1UL;
+			}
+
+			ulReloadValue = ( ulTicksToEvent * ulTimerCountsForOneTick ) - ulCountsSinceTick - ulStoppedTimerCompensation;
+
+			ulTicksToEndOfPeriod = ulTicksToEvent;
+			ulCountsBeforePeriod = ulCountsSinceTick + ulStoppedTimerCompensation;
+
+			/* Restart the SysTick from the new reload value.  Writing to the
+			current value register also clears the count flag. */
+			portNVIC_SYSTICK_LOAD_REG = ulReloadValue - 1UL;
+			portNVIC_SYSTICK_CURRENT_VALUE_REG = 0UL;
+			portNVIC_SYSTICK_CTRL_REG |= portNVIC_SYSTICK_ENABLE_BIT;
+		}
+	}
+
+#endif /* configUSE_EVENT_DRIVEN_TICK */
+/*-----------------------------------------------------------*/
+
 #if( configUSE_TICKLESS_IDLE == 1 )
 
 	__attribute__((weak)) void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
@@ -678,14 +765,16 @@ void xPortSysTickHandler( void )
  */
 __attribute__(( weak )) void vPortSetupTimerInterrupt( void )
 {
-	/* Calculate the constants required to configure the tick interrupt. */
-	#if( configUSE_TICKLESS_IDLE == 1 )
+	/* Calculate the constants required to configure the tick interrupt.  With
+	an event driven tick the first tick is a normal tick, after which the
+	SysTick is set for the next event. */
+	#if( ( configUSE_TICKLESS_IDLE == 1 ) || ( configUSE_EVENT_DRIVEN_TICK == 1 ) )
 	{
 		ulTimerCountsForOneTick = ( configSYSTICK_CLOCK_HZ / configTICK_RATE_HZ );
 		xMaximumPossibleSuppressedTicks = portMAX_24_BIT_NUMBER / ulTimerCountsForOneTick;
 		ulStoppedTimerCompensation = portMISSED_COUNTS_FACTOR / ( configCPU_CLOCK_HZ / configSYSTICK_CLOCK_HZ );
 	}
-	#endif /* configUSE_TICKLESS_IDLE */
+	#endif /* ( configUSE_TICKLESS_IDLE == 1 ) || ( configUSE_EVENT_DRIVEN_TICK == 1 ) */
 
 	/* Stop and clear the SysTick. */
 	portNVIC_SYSTICK_CTRL_REG = 0UL;
@@ -119,6 +119,14 @@ not necessary for to use this port.  They are defined so the common demo files
 #endif
 /*-----------------------------------------------------------*/
 
+/* Event driven tick functionality, used when configUSE_EVENT_DRIVEN_TICK is 1.
+The SysTick is set to interrupt at the tick of the next event. */
+#ifndef portSET_NEXT_TICK_EVENT
+	extern void vPortSetNextTickEvent( void );
+	#define portSET_NEXT_TICK_EVENT() vPortSetNextTickEvent()
+#endif
+/*-----------------------------------------------------------*/
+
 /* Architecture specific optimisations. */
 #ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
 	#define configUSE_PORT_OPTIMISED_TASK_SELECTION 1
@@ -0,0 +1,912 @@
+/*
+ * FreeRTOS Kernel V10.3.0
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*-----------------------------------------------------------
+ * Implementation of functions defined in portable.h for the Posix port.
+ *
+ * Each task is run in its own pthread.  Only the thread of the task selected by
+ * the scheduler is ever allowed to run, all the other threads wait on a
+ * condition variable held in their Thread_t structure.  A context switch
+ * therefore consists of signalling the thread being switched in then waiting
+ * on the thread being switched out.
+ *
+ * The tick interrupt is simulated by a periodic SIGALRM that is only ever
+ * unblocked in the thread of the running task, and the critical section model
+ * is implemented by blocking signals in that thread.
+ *
+ * When configUSE_VIRTUAL_TIME is 1 there is no SIGALRM.  The tick interrupt is
+ * instead processed synchronously, in the thread of the running task, each
+ * time a task consumes a tick of simulated execution time and each time the
+ * idle task runs.  Only one thread ever runs at a time, so the simulation is
+ * deterministic.
+ *
+ * When configUSE_TICKLESS_IDLE is 1 the idle task suppresses the ticks until
+ * the next task is due to unblock, as a port with a low power mode would.  In
+ * real time the thread sleeps with the tick timer stopped, in virtual time the
+ * time is stepped over.  The suppressed ticks are counted so the saving can be
+ * measured.
+ *
+ * When configUSE_EVENT_DRIVEN_TICK is 1 the SIGALRM is a one-shot timer set for
+ * the next tick at which the kernel has an event to process, and each signal
+ * processes all the ticks that have elapsed since the last.  In virtual time
+ * the ticks up to the next event are processed together.  The ticks at which
+ * no interrupt is taken are counted as suppressed ticks.
+ *----------------------------------------------------------*/
+
+/* Standard includes. */
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* The signal used to wake the thread that called xPortStartScheduler() when
+vTaskEndScheduler() is called. */
+#define portSIG_RESUME			SIGUSR1
+
+/* The signal used to simulate the tick interrupt. */
+#define portSIG_TICK			SIGALRM
+
+/* The number of microseconds in a second, used when converting times. */
+#define portUSECS_PER_SEC		( 1000000ULL )
+#define portNSECS_PER_USEC		( 1000ULL )
+#define portNSECS_PER_SEC		( 1000000000ULL )
+
+/*-----------------------------------------------------------*/
+
+/* The Posix simulator runs each task in a thread.  The context switching is
+managed by the threads, so the task stack does not have to be managed directly,
+although the top of the task stack is used to hold a Thread_t structure and the
+rest of it is used as the stack of the thread.  The structure maps the task
+handle to the thread that executes the task. */
+typedef struct THREAD_STATE
+{
+	pthread_t xThread;				/*< The thread that executes the task. */
+	TaskFunction_t pxCode;			/*< The function that implements the task. */
+	void *pvParams;					/*< The parameter passed into the task function. */
+	BaseType_t xDying;				/*< Set to pdTRUE when a task deletes itself. */
+	BaseType_t xResumed;			/*< Set when the thread is allowed to run. */
+	pthread_mutex_t xResumeMutex;	/*< Guards xResumed. */
+	pthread_cond_t xResumeCondition;/*< Signalled when xResumed is set. */
+} Thread_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Block all signals in the thread that creates the first task so every thread
+ * inherits a blocked signal mask, and install the tick signal handler.
+ */
+static void prvSetupSignalsAndSchedulerPolicy( void );
+
+/*
+ * The entry point of every task thread.  The thread waits until it is first
+ * switched in before calling the task function.
+ */
+static void *prvWaitForStart( void *pvParams );
+
+/*
+ * Switch execution from the thread of one task to the thread of another.
+ */
+static void prvSwitchThread( Thread_t *pxThreadToResume, Thread_t *pxThreadToSuspend );
+
+/*
+ * Wait until this thread is switched in again.
+ */
+static void prvSuspendSelf( Thread_t *pxThread );
+
+/*
+ * Allow the thread of a task to run.
+ */
+static void prvResumeThread( Thread_t *pxThread );
+
+#if( configUSE_VIRTUAL_TIME == 0 )
+
+	#if( configUSE_EVENT_DRIVEN_TICK == 0 )
+
+		/*
+		 * Start the periodic timer that generates the simulated tick
+		 * interrupt.
+		 */
+		static void prvSetupTimerInterrupt( void );
+
+	#endif
+
+	/*
+	 * The number of microseconds since the scheduler was started.
+	 */
+	static uint64_t prvGetMicrosecondsSinceStart( void );
+
+#endif
+
+/*
+ * The signal handler of the simulated tick interrupt.
+ */
+static void prvSystemTickHandler( int iSignal );
+
+/*
+ * Process a tick interrupt, switching to another task if the tick unblocked a
+ * task that should run.  xTicks is the number of ticks that have elapsed since
+ * the last tick interrupt, which is always 1 unless configUSE_EVENT_DRIVEN_TICK
+ * is 1.  Must be called with interrupts disabled.
+ */
+static void prvProcessTicks( TickType_t xTicks );
+
+/*
+ * Print the reason the simulation cannot continue then terminate the process.
+ */
+static void prvFatalError( const char *pcCall, int iErrno ) __attribute__ ( ( __noreturn__ ) );
+
+/*-----------------------------------------------------------*/
+
+/* Pointer to the TCB of the currently executing task.  The first member of a
+TCB holds the task's top of stack, which this port never changes after the
+stack is initialised, so it can be used to locate the task's Thread_t. */
+extern void * volatile pxCurrentTCB;
+
+/* The critical nesting count of the running task.  Each thread saves this on
+its own stack when it is switched out and restores it when it is switched back
+in. */
+static volatile UBaseType_t uxCriticalNesting = 0;
+
+/* Used to make sure the signal set up is only performed once. */
+static pthread_once_t xSignalSetupOnce = PTHREAD_ONCE_INIT;
+
+/* All the signals that are blocked to simulate disabling interrupts. */
+static sigset_t xAllSignals;
+
+/* The signal mask of the thread that started the scheduler, restored when the
+scheduler ends. */
+static sigset_t xSchedulerOriginalSignalMask;
+
+/* The thread that called xPortStartScheduler(). */
+static pthread_t xSchedulerThread;
+
+/* Set by vPortEndScheduler() to make xPortStartScheduler() return. */
+static volatile BaseType_t xSchedulerEnd = pdFALSE;
+
+/* The time at which the scheduler was started, used by the run time counter. */
+static struct timespec xSchedulerStartTime;
+
+#if( configUSE_VIRTUAL_TIME == 1 )
+
+	/* The simulated time in microseconds, used by the run time counter.  Like
+	ullTicksProcessed it does not overflow, whatever the tick type, so the run
+	time counter wraps at 32 bits as it does in real time. */
+	static uint64_t ullVirtualTimeUsecs = 0;
+
+#endif
+
+#if( ( configUSE_TICKLESS_IDLE == 1 ) || ( configUSE_EVENT_DRIVEN_TICK == 1 ) )
+
+	/* The number of tick interrupts that did not occur because the idle task
+	suppressed them, or because no event was due at the tick. */
+	static uint32_t ulSuppressedTicks = 0;
+
+#endif
+
+#if( ( configUSE_EVENT_DRIVEN_TICK == 1 ) && ( configUSE_VIRTUAL_TIME == 0 ) )
+
+	/* The number of ticks passed to the kernel since the scheduler was
+	started, which does not overflow like the tick count does. */
+	static uint64_t ullTicksProcessed = 0;
+
+#endif
+
+/*-----------------------------------------------------------*/
+
+static Thread_t *prvGetThreadFromTask( void *pvTask )
+{
+StackType_t *pxTopOfStack = *( StackType_t ** ) pvTask;
+
+	return ( Thread_t * ) ( pxTopOfStack + 1 );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, StackType_t *pxEndOfStack, TaskFunction_t pxCode, void *pvParameters )
+{
+Thread_t *pxThread;
+pthread_attr_t xThreadAttributes;
+size_t xStackSize;
+int iRet;
+
+	( void ) pthread_once( &xSignalSetupOnce, prvSetupSignalsAndSchedulerPolicy );
+
+	/* Store the thread state at the top of the stack, then give the rest of
+	the stack to the thread. */
+	pxThread = ( Thread_t * ) ( pxTopOfStack + 1 ) - 1;
+	pxTopOfStack = ( StackType_t * ) pxThread - 1;
+	xStackSize = ( size_t ) ( pxTopOfStack + 1 - pxEndOfStack ) * sizeof( StackType_t );
+
+	pxThread->pxCode = pxCode;
+	pxThread->pvParams = pvParameters;
+	pxThread->xDying = pdFALSE;
+	pxThread->xResumed = pdFALSE;
+	( void ) pthread_mutex_init( &( pxThread->xResumeMutex ), NULL );
+	( void ) pthread_cond_init( &( pxThread->xResumeCondition ), NULL );
+
+	( void ) pthread_attr_init( &xThreadAttributes );
+	iRet = pthread_attr_setstack( &xThreadAttributes, pxEndOfStack, xStackSize );
+	if( iRet != 0 )
+	{
+		/* The most likely cause is a stack smaller than PTHREAD_STACK_MIN. */
+		prvFatalError( "pthread_attr_setstack", iRet );
+	}
+
+	vPortEnterCritical();
+	{
+		iRet = pthread_create( &( pxThread->xThread ), &xThreadAttributes, prvWaitForStart, pxThread );
+	}
+	vPortExitCritical();
+
+	( void ) pthread_attr_destroy( &xThreadAttributes );
+
+	if( iRet != 0 )
+	{
+		prvFatalError( "pthread_create", iRet );
+	}
+
+	return pxTopOfStack;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortStartScheduler( void )
+{
+sigset_t xSignals;
+int iSignal;
+
+	xSchedulerThread = pthread_self();
+	( void ) clock_gettime( CLOCK_MONOTONIC, &xSchedulerStartTime );
+
+	/* Start the timer that generates the tick interrupt.  Interrupts are
+	already disabled in this thread.  In virtual time the tasks generate the
+	ticks themselves. */
+	#if( ( configUSE_VIRTUAL_TIME == 0 ) && ( configUSE_EVENT_DRIVEN_TICK == 0 ) )
+	{
+		prvSetupTimerInterrupt();
+	}
+	#elif( configUSE_VIRTUAL_TIME == 0 )
+	{
+		vPortSetNextTickEvent();
+	}
+	#endif
+
+	/* Start the first task. */
+	prvResumeThread( prvGetThreadFromTask( pxCurrentTCB ) );
+
+	/* Wait until vTaskEndScheduler() is called. */
+	( void ) sigemptyset( &xSignals );
+	( void ) sigaddset( &xSignals, portSIG_RESUME );
+
+	while( xSchedulerEnd == pdFALSE )
+	{
+		( void ) sigwait( &xSignals, &iSignal );
+	}
+
+	/* Restore the original signal mask. */
+	( void ) pthread_sigmask( SIG_SETMASK, &xSchedulerOriginalSignalMask, NULL );
+
+	return pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+struct itimerval xTimer;
+struct sigaction xAction;
+
+	/* Stop the timer and ignore any tick that is already pending so it does
+	not get delivered to the thread that started the scheduler. */
+	memset( &xTimer, 0, sizeof( xTimer ) );
+	( void ) setitimer( ITIMER_REAL, &xTimer, NULL );
+
+	memset( &xAction, 0, sizeof( xAction ) );
+	xAction.sa_handler = SIG_IGN;
+	( void ) sigemptyset( &xAction.sa_mask );
+	( void ) sigaction( portSIG_TICK, &xAction, NULL );
+
+	/* Wake the thread that started the scheduler, then never run the calling
+	task again. */
+	xSchedulerEnd = pdTRUE;
+	( void ) pthread_kill( xSchedulerThread, portSIG_RESUME );
+
+	prvSuspendSelf( prvGetThreadFromTask( pxCurrentTCB ) );
+}
+/*-----------------------------------------------------------*/
+
+/* In virtual time no signals are used to simulate interrupts, so there is
+nothing to block and the system calls are avoided. */
+
+void vPortDisableInterrupts( void )
+{
+	#if( configUSE_VIRTUAL_TIME == 0 )
+	{
+		( void ) pthread_sigmask( SIG_BLOCK, &xAllSignals, NULL );
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnableInterrupts( void )
+{
+	#if( configUSE_VIRTUAL_TIME == 0 )
+	{
+		( void ) pthread_sigmask( SIG_UNBLOCK, &xAllSignals, NULL );
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortSetInterruptMask( void )
+{
+	#if( configUSE_VIRTUAL_TIME == 0 )
+	{
+	sigset_t xPreviousMask;
+
+		( void ) pthread_sigmask( SIG_BLOCK, &xAllSignals, &xPreviousMask );
+
+		/* Return pdTRUE if interrupts were enabled before the call. */
+		return ( sigismember( &xPreviousMask, portSIG_TICK ) == 0 ) ? pdTRUE : pdFALSE;
+	}
+	#else
+	{
+		return pdFALSE;
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+void vPortClearInterruptMask( BaseType_t xMask )
+{
+	if( xMask != pdFALSE )
+	{
+		vPortEnableInterrupts();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+	if( uxCriticalNesting == 0 )
+	{
+		vPortDisableInterrupts();
+	}
+
+	uxCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+	configASSERT( uxCriticalNesting );
+	uxCriticalNesting--;
+
+	/* If the nesting level has reached zero then interrupts can be enabled
+	again. */
+	if( uxCriticalNesting == 0 )
+	{
+		vPortEnableInterrupts();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortYieldFromISR( void )
+{
+Thread_t *pxThreadToSuspend, *pxThreadToResume;
+
+	pxThreadToSuspend = prvGetThreadFromTask( pxCurrentTCB );
+
+	vTaskSwitchContext();
+
+	pxThreadToResume = prvGetThreadFromTask( pxCurrentTCB );
+
+	prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+	vPortEnterCritical();
+	{
+		vPortYieldFromISR();
+	}
+	vPortExitCritical();
+}
+/*-----------------------------------------------------------*/
+
+void vPortThreadDying( void *pvTaskToDelete, volatile BaseType_t *pxPendYield )
+{
+Thread_t *pxThread = prvGetThreadFromTask( pvTaskToDelete );
+
+	( void ) pxPendYield;
+
+	/* The thread exits at the context switch that follows, its resources are
+	released when the idle task cleans up the TCB. */
+	pxThread->xDying = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortCancelThread( void *pvTaskToDelete )
+{
+Thread_t *pxThread = prvGetThreadFromTask( pvTaskToDelete );
+
+	/* The thread is either waiting to be resumed or has already exited, so it
+	can be cancelled safely.  It must be joined before its stack is freed. */
+	( void ) pthread_cancel( pxThread->xThread );
+	( void ) pthread_join( pxThread->xThread, NULL );
+	( void ) pthread_mutex_destroy( &( pxThread->xResumeMutex ) );
+	( void ) pthread_cond_destroy( &( pxThread->xResumeCondition ) );
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulPortGetRunTimeCounterValue( void )
+{
+	#if( configUSE_VIRTUAL_TIME == 0 )
+	{
+		return ( uint32_t ) prvGetMicrosecondsSinceStart();
+	}
+	#else
+	{
+		/* Wall clock time is not related to the simulated time, and would make
+		the run time statistics differ from run to run. */
+		return ( uint32_t ) ullVirtualTimeUsecs;
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+void vPortSimulateExecution( TickType_t xTicks )
+{
+	#if( configUSE_VIRTUAL_TIME == 0 )
+	{
+	struct timespec xNow;
+	uint64_t ullStart, ullNow, ullDuration;
+
+		/* The CPU time of a thread only advances while its task is running, so
+		the task consumes the same execution time however often it is
+		preempted. */
+		ullDuration = ( uint64_t ) xTicks * ( uint64_t ) portTICK_USECS * portNSECS_PER_USEC;
+		( void ) clock_gettime( CLOCK_THREAD_CPUTIME_ID, &xNow );
+		ullStart = ( uint64_t ) xNow.tv_sec * portNSECS_PER_SEC + ( uint64_t ) xNow.tv_nsec;
+
+		do
+		{
+			( void ) clock_gettime( CLOCK_THREAD_CPUTIME_ID, &xNow );
+			ullNow = ( uint64_t ) xNow.tv_sec * portNSECS_PER_SEC + ( uint64_t ) xNow.tv_nsec;
+		} while( ( ullNow - ullStart ) < ullDuration );
+	}
+	#else
+	{
+	TickType_t xTicksToProcess = ( TickType_t ) 1;
+
+		/* Time cannot pass inside a critical section. */
+		configASSERT( uxCriticalNesting == 0 );
+
+		/* Each tick is processed as the tick interrupt would be, so the task
+		is switched out at the tick that unblocks a task that should preempt
+		it, and continues consuming its remaining ticks when switched back
+		in.  With an event driven tick the ticks up to the next event are
+		processed as one interrupt. */
+		while( xTicks > ( TickType_t ) 0 )
+		{
+			#if( configUSE_EVENT_DRIVEN_TICK == 1 )
+			{
+				xTicksToProcess = xTaskGetTicksToNextEvent();
+
+				if( xTicksToProcess > xTicks )
+				{
+					xTicksToProcess = xTicks;
+				}
+			}
+			#endif
+
+			prvProcessTicks( xTicksToProcess );
+			xTicks -= xTicksToProcess;
+		}
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_VIRTUAL_TIME == 1 )
+
+	void vPortIdleTaskProcessing( void )
+	{
+		/* The idle task only runs when no other task is able to, so let one
+		tick of time pass, or all the time up to the next event. */
+		#if( configUSE_EVENT_DRIVEN_TICK == 1 )
+		{
+			prvProcessTicks( xTaskGetTicksToNextEvent() );
+		}
+		#else
+		{
+			prvProcessTicks( ( TickType_t ) 1 );
+		}
+		#endif
+	}
+
+#endif /* configUSE_VIRTUAL_TIME */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TICKLESS_IDLE == 1 )
+
+	void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
+	{
+	/* The tick at the end of the idle period is processed as normal, as it
+	would be the interrupt that wakes the processor. */
+	const TickType_t xTicksToSuppress = xExpectedIdleTime - ( TickType_t ) 1;
+
+		/* Called by the idle task with the scheduler suspended.  Stop the
+		tick from being processed before checking that nothing has been made
+		ready since the expected idle time was calculated. */
+		vPortEnterCritical();
+		{
+			if( eTaskConfirmSleepModeStatus() != eAbortSleep )
+			{
+				#if( configUSE_VIRTUAL_TIME == 0 )
+				{
+				struct itimerval xTimer;
+				struct timespec xSleep;
+
+					/* Stop the tick timer and sleep.  A tick that occurred
+					before the timer was stopped remains pending, so is still
+					processed. */
+					memset( &xTimer, 0, sizeof( xTimer ) );
+					( void ) setitimer( ITIMER_REAL, &xTimer, NULL );
+
+					xSleep.tv_sec = ( time_t ) ( ( ( uint64_t ) xTicksToSuppress * ( uint64_t ) portTICK_USECS ) / portUSECS_PER_SEC );
+					xSleep.tv_nsec = ( long ) ( ( ( ( uint64_t ) xTicksToSuppress * ( uint64_t ) portTICK_USECS ) % portUSECS_PER_SEC ) * portNSECS_PER_USEC );
+
+					while( nanosleep( &xSleep, &xSleep ) != 0 )
+					{
+						/* Interrupted, sleep for the remaining time. */
+					}
+
+					prvSetupTimerInterrupt();
+				}
+				#else
+				{
+					/* Nothing other than the tick can happen in virtual time,
+					so the idle period passes at once. */
+					ullVirtualTimeUsecs += ( uint64_t ) xTicksToSuppress * ( uint64_t ) portTICK_USECS;
+				}
+				#endif
+
+				vTaskStepTick( xTicksToSuppress );
+				ulSuppressedTicks += ( uint32_t ) xTicksToSuppress;
+			}
+		}
+		vPortExitCritical();
+	}
+
+#endif /* configUSE_TICKLESS_IDLE */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_EVENT_DRIVEN_TICK == 1 ) && ( configUSE_VIRTUAL_TIME == 0 ) )
+
+	void vPortSetNextTickEvent( void )
+	{
+	struct itimerval xTimer;
+	uint64_t ullEvent, ullNow, ullDelay;
+	int iRet;
+
+		/* Called with interrupts disabled.  The tick count only includes the
+		ticks already processed, so an event that has already been passed is
+		taken as soon as possible. */
+		ullEvent = ( ullTicksProcessed + ( uint64_t ) xTaskGetTicksToNextEvent() ) * ( uint64_t ) portTICK_USECS;
+		ullNow = prvGetMicrosecondsSinceStart();
+		ullDelay = ( ullEvent > ullNow ) ? ( ullEvent - ullNow ) : 1ULL;
+
+		memset( &xTimer, 0, sizeof( xTimer ) );
+		xTimer.it_value.tv_sec = ( time_t ) ( ullDelay / portUSECS_PER_SEC );
+		xTimer.it_value.tv_usec = ( suseconds_t ) ( ullDelay % portUSECS_PER_SEC );
+
+		iRet = setitimer( ITIMER_REAL, &xTimer, NULL );
+		if( iRet != 0 )
+		{
+			prvFatalError( "setitimer", errno );
+		}
+	}
+
+#elif( configUSE_EVENT_DRIVEN_TICK == 1 )
+
+	void vPortSetNextTickEvent( void )
+	{
+		/* The ticks up to the next event are processed synchronously. */
+	}
+
+#endif /* configUSE_EVENT_DRIVEN_TICK */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_TICKLESS_IDLE == 1 ) || ( configUSE_EVENT_DRIVEN_TICK == 1 ) )
+
+	uint32_t ulPortGetSuppressedTickCount( void )
+	{
+		return ulSuppressedTicks;
+	}
+
+#endif /* ( configUSE_TICKLESS_IDLE == 1 ) || ( configUSE_EVENT_DRIVEN_TICK == 1 ) */
+/*-----------------------------------------------------------*/
+
+static void prvSetupSignalsAndSchedulerPolicy( void )
+{
+struct sigaction xAction;
+int iRet;
+
+	/* Don't block SIGINT so the simulation can always be interrupted from the
+	terminal or a debugger. */
+	( void ) sigfillset( &xAllSignals );
+	( void ) sigdelset( &xAllSignals, SIGINT );
+
+	/* Block all signals in this thread so all new threads inherit a blocked
+	mask.  A thread unblocks signals when it is switched in for the first
+	time. */
+	( void ) pthread_sigmask( SIG_SETMASK, &xAllSignals, &xSchedulerOriginalSignalMask );
+
+	memset( &xAction, 0, sizeof( xAction ) );
+	xAction.sa_handler = prvSystemTickHandler;
+	( void ) sigfillset( &xAction.sa_mask );
+
+	iRet = sigaction( portSIG_TICK, &xAction, NULL );
+	if( iRet != 0 )
+	{
+		prvFatalError( "sigaction", errno );
+	}
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_VIRTUAL_TIME == 0 )
+
+	#if( configUSE_EVENT_DRIVEN_TICK == 0 )
+
+		static void prvSetupTimerInterrupt( void )
+		{
+		struct itimerval xTimer;
+		int iRet;
+
+			xTimer.it_value.tv_sec = 0;
+			xTimer.it_value.tv_usec = portTICK_USECS;
+			xTimer.it_interval = xTimer.it_value;
+
+			iRet = setitimer( ITIMER_REAL, &xTimer, NULL );
+			if( iRet != 0 )
+			{
+				prvFatalError( "setitimer", errno );
+			}
+		}
+		/*-----------------------------------------------------------*/
+
+	#endif /* configUSE_EVENT_DRIVEN_TICK */
+
+	static uint64_t prvGetMicrosecondsSinceStart( void )
+	{
+	struct timespec xNow;
+	int64_t llMicroseconds;
+
+		( void ) clock_gettime( CLOCK_MONOTONIC, &xNow );
+
+		llMicroseconds = ( int64_t ) ( xNow.tv_sec - xSchedulerStartTime.tv_sec ) * ( int64_t ) portUSECS_PER_SEC;
+		llMicroseconds += ( int64_t ) ( xNow.tv_nsec - xSchedulerStartTime.tv_nsec ) / ( int64_t ) portNSECS_PER_USEC;
+
+		return ( uint64_t ) llMicroseconds;
+	}
+
+#endif /* configUSE_VIRTUAL_TIME */
+/*-----------------------------------------------------------*/
+
+static void prvSystemTickHandler( int iSignal )
+{
+	( void ) iSignal;
+
+	/* Signals are blocked while the handler runs. */
+	#if( ( configUSE_EVENT_DRIVEN_TICK == 1 ) && ( configUSE_VIRTUAL_TIME == 0 ) )
+	{
+	uint64_t ullTicks;
+
+		ullTicks = ( prvGetMicrosecondsSinceStart() / ( uint64_t ) portTICK_USECS ) - ullTicksProcessed;
+
+		if( ullTicks > ( uint64_t ) 0 )
+		{
+			ullTicksProcessed += ullTicks;
+			prvProcessTicks( ( TickType_t ) ullTicks );
+		}
+		else
+		{
+			/* The timer expired just before the tick it was set for. */
+			vPortSetNextTickEvent();
+		}
+	}
+	#else
+	{
+		prvProcessTicks( ( TickType_t ) 1 );
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+static void prvProcessTicks( TickType_t xTicks )
+{
+Thread_t *pxThreadToSuspend, *pxThreadToResume;
+BaseType_t xSwitchRequired;
+
+	/* Interrupts are disabled while the tick is processed, which is restored
+	along with the nesting count if this task is switched out. */
+	uxCriticalNesting++;
+
+	pxThreadToSuspend = prvGetThreadFromTask( pxCurrentTCB );
+
+	#if( configUSE_VIRTUAL_TIME == 1 )
+	{
+		ullVirtualTimeUsecs += ( uint64_t ) xTicks * ( uint64_t ) portTICK_USECS;
+	}
+	#endif
+
+	/* In virtual time the interrupt is taken at the end of the ticks it
+	processes. */
+	traceISR_ENTER();
+
+	#if( configUSE_EVENT_DRIVEN_TICK == 1 )
+	{
+		/* Only one interrupt is taken for all the ticks. */
+		ulSuppressedTicks += ( uint32_t ) ( xTicks - ( TickType_t ) 1 );
+		xSwitchRequired = xTaskAdvanceTicks( xTicks );
+	}
+	#else
+	{
+		( void ) xTicks;
+		xSwitchRequired = xTaskIncrementTick();
+	}
+	#endif
+
+	if( xSwitchRequired != pdFALSE )
+	{
+		/* Select the next task to run, which also sets the next tick event
+		if the tick is event driven. */
+		vTaskSwitchContext();
+
+		/* The interrupt returns to the selected task, so has ended before
+		this thread is suspended. */
+		traceISR_EXIT();
+
+		pxThreadToResume = prvGetThreadFromTask( pxCurrentTCB );
+		prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
+	}
+	else
+	{
+		#if( configUSE_EVENT_DRIVEN_TICK == 1 )
+		{
+			vPortSetNextTickEvent();
+		}
+		#endif
+
+		traceISR_EXIT();
+	}
+
+	uxCriticalNesting--;
+}
+/*-----------------------------------------------------------*/
+
+static void *prvWaitForStart( void *pvParams )
+{
+Thread_t *pxThread = ( Thread_t * ) pvParams;
+
+	prvSuspendSelf( pxThread );
+
+	/* Switched in for the first time - the task starts with interrupts
+	enabled. */
+	uxCriticalNesting = 0;
+	vPortEnableInterrupts();
+
+	pxThread->pxCode( pxThread->pvParams );
+
+	/* A function that implements a task must not exit or attempt to return to
+	its caller as there is nothing to return to.  If a task wants to exit it
+	should instead call vTaskDelete( NULL ).  Artificially force an assert() to
+	be triggered if configASSERT() is defined, so application writers can catch
+	the error. */
+	configASSERT( pdFALSE );
+
+	return NULL;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitchThread( Thread_t *pxThreadToResume, Thread_t *pxThreadToSuspend )
+{
+UBaseType_t uxSavedCriticalNesting;
+
+	if( pxThreadToSuspend != pxThreadToResume )
+	{
+		/* The critical nesting count belongs to the task being switched out,
+		so save it on that task's stack and restore it when the task runs
+		again. */
+		uxSavedCriticalNesting = uxCriticalNesting;
+
+		prvResumeThread( pxThreadToResume );
+
+		if( pxThreadToSuspend->xDying != pdFALSE )
+		{
+			/* The task deleted itself. */
+			pthread_exit( NULL );
+		}
+
+		prvSuspendSelf( pxThreadToSuspend );
+
+		uxCriticalNesting = uxSavedCriticalNesting;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvUnlockResumeMutex( void *pvMutex )
+{
+	( void ) pthread_mutex_unlock( ( pthread_mutex_t * ) pvMutex );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSuspendSelf( Thread_t *pxThread )
+{
+	( void ) pthread_mutex_lock( &( pxThread->xResumeMutex ) );
+
+	/* pthread_cond_wait() is a cancellation point, so make sure the mutex is
+	not left locked if the task is deleted while it waits. */
+	pthread_cleanup_push( prvUnlockResumeMutex, &( pxThread->xResumeMutex ) );
+	{
+		while( pxThread->xResumed == pdFALSE )
+		{
+			( void ) pthread_cond_wait( &( pxThread->xResumeCondition ), &( pxThread->xResumeMutex ) );
+		}
+
+		pxThread->xResumed = pdFALSE;
+	}
+	pthread_cleanup_pop( 1 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvResumeThread( Thread_t *pxThread )
+{
+	( void ) pthread_mutex_lock( &( pxThread->xResumeMutex ) );
+	{
+		pxThread->xResumed = pdTRUE;
+		( void ) pthread_cond_signal( &( pxThread->xResumeCondition ) );
+	}
+	( void ) pthread_mutex_unlock( &( pxThread->xResumeMutex ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvFatalError( const char *pcCall, int iErrno )
+{
+	fprintf( stderr, "%s: %s\n", pcCall, strerror( iErrno ) );
+	abort();
+}
@@ -0,0 +1,179 @@
+/*
+ * FreeRTOS Kernel V10.3.0
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef PORTMACRO_H
+#define PORTMACRO_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*-----------------------------------------------------------
+ * Port specific definitions.
+ *
+ * The settings in this file configure FreeRTOS correctly for the
+ * given hardware and compiler.
+ *
+ * These settings should not be altered.
+ *-----------------------------------------------------------
+ */
+
+/* Type definitions. */
+#define portCHAR		char
+#define portFLOAT		float
+#define portDOUBLE		double
+#define portLONG		long
+#define portSHORT		short
+#define portSTACK_TYPE	unsigned long
+#define portBASE_TYPE	long
+#define portPOINTER_SIZE_TYPE size_t
+
+typedef portSTACK_TYPE StackType_t;
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+
+/* The tick type is kept at the width used by the embedded targets so tick
+count overflow behaves on the host exactly as it does on the hardware. */
+#if( configUSE_16_BIT_TICKS == 1 )
+	typedef uint16_t TickType_t;
+	#define portMAX_DELAY ( TickType_t ) 0xffff
+#else
+	typedef uint32_t TickType_t;
+	#define portMAX_DELAY ( TickType_t ) 0xffffffffUL
+#endif
+
+/* Reads and writes of the tick count are atomic on the host, so do not need to
+be guarded with a critical section. */
+#define portTICK_TYPE_IS_ATOMIC 1
+
+/*-----------------------------------------------------------*/
+
+/* Architecture specifics. */
+#define portSTACK_GROWTH			( -1 )
+#define portHAS_STACK_OVERFLOW_CHECKING	( 1 )
+#define portTICK_PERIOD_MS			( ( TickType_t ) 1000 / configTICK_RATE_HZ )
+#define portTICK_USECS				( 1000000UL / ( unsigned long ) configTICK_RATE_HZ )
+#define portBYTE_ALIGNMENT			8
+#define portINLINE					__inline
+/*-----------------------------------------------------------*/
+
+/* Scheduler utilities. */
+extern void vPortYield( void );
+
+#define portYIELD()					vPortYield()
+
+#define portEND_SWITCHING_ISR( xSwitchRequired ) if( ( xSwitchRequired ) != pdFALSE ) vPortYieldFromISR()
+#define portYIELD_FROM_ISR( x )		portEND_SWITCHING_ISR( ( x ) )
+/*-----------------------------------------------------------*/
+
+/* Critical section management.  Each task runs in its own thread and an
+interrupt is simulated by a signal delivered to the thread of the running task,
+so interrupts are disabled by blocking signals in that thread. */
+extern void vPortDisableInterrupts( void );
+extern void vPortEnableInterrupts( void );
+extern BaseType_t xPortSetInterruptMask( void );
+extern void vPortClearInterruptMask( BaseType_t xMask );
+extern void vPortEnterCritical( void );
+extern void vPortExitCritical( void );
+
+#define portSET_INTERRUPT_MASK_FROM_ISR()		xPortSetInterruptMask()
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR( x )	vPortClearInterruptMask( ( x ) )
+#define portDISABLE_INTERRUPTS()				vPortDisableInterrupts()
+#define portENABLE_INTERRUPTS()					vPortEnableInterrupts()
+#define portENTER_CRITICAL()					vPortEnterCritical()
+#define portEXIT_CRITICAL()						vPortExitCritical()
+/*-----------------------------------------------------------*/
+
+/* Task function macros as described on the FreeRTOS.org WEB site. */
+#define portTASK_FUNCTION_PROTO( vFunction, pvParameters ) void vFunction( void *pvParameters )
+#define portTASK_FUNCTION( vFunction, pvParameters ) void vFunction( void *pvParameters )
+/*-----------------------------------------------------------*/
+
+/* Thread management.  The thread that runs a task is cancelled when the task
+is deleted, and flagged as dying when the task deletes itself so it exits at the
+next context switch. */
+extern void vPortYieldFromISR( void );
+extern void vPortThreadDying( void *pvTaskToDelete, volatile BaseType_t *pxPendYield );
+extern void vPortCancelThread( void *pvTaskToDelete );
+
+#define portPRE_TASK_DELETE_HOOK( pvTaskToDelete, pxPendYield ) vPortThreadDying( ( pvTaskToDelete ), ( pxPendYield ) )
+#define portCLEAN_UP_TCB( pxTCB )	vPortCancelThread( pxTCB )
+/*-----------------------------------------------------------*/
+
+/* Run time stats.  The counter is a free running microsecond count measured
+from the start of the scheduler.  In virtual time it is derived from the tick
+count. */
+extern uint32_t ulPortGetRunTimeCounterValue( void );
+/*-----------------------------------------------------------*/
+
+/* Virtual time.  Set configUSE_VIRTUAL_TIME to 1 in FreeRTOSConfig.h to run
+the simulation as a discrete event simulation.  There is then no tick signal,
+instead the tick count only advances when a task calls
+vPortSimulateExecution() or when the idle task runs, so the simulation runs as
+fast as the host allows and the sequence of context switches is the same on
+every run.  A task that loops without calling vPortSimulateExecution() or
+blocking stops time from advancing. */
+#ifndef configUSE_VIRTUAL_TIME
+	#define configUSE_VIRTUAL_TIME 0
+#endif
+
+/* Consume xTicks ticks of execution time in the calling task.  The task can be
+preempted during the call, in which case the remaining time is consumed when
+it runs again. */
+extern void vPortSimulateExecution( TickType_t xTicks );
+
+#if( configUSE_VIRTUAL_TIME == 1 )
+	/* Time passes in the idle task one tick, or with an event driven tick one
+	event, at a time. */
+	extern void vPortIdleTaskProcessing( void );
+	#define portIDLE_TASK_PROCESSING() vPortIdleTaskProcessing()
+#endif
+/*-----------------------------------------------------------*/
+
+/* Tickless idle, used when configUSE_TICKLESS_IDLE is 1.  The ticks the idle
+task suppresses are counted by ulPortGetSuppressedTickCount(). */
+extern void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime );
+#define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime ) vPortSuppressTicksAndSleep( xExpectedIdleTime )
+extern uint32_t ulPortGetSuppressedTickCount( void );
+/*-----------------------------------------------------------*/
+
+/* Event driven tick, used when configUSE_EVENT_DRIVEN_TICK is 1.  The tick
+timer is a one-shot timer programmed for the next tick at which the kernel has
+an event to process, and the ticks stepped over are also counted by
+ulPortGetSuppressedTickCount().  In virtual time the ticks are stepped over as
+time is simulated, so there is no timer to program. */
+extern void vPortSetNextTickEvent( void );
+#define portSET_NEXT_TICK_EVENT() vPortSetNextTickEvent()
+/*-----------------------------------------------------------*/
+
+#define portNOP()
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PORTMACRO_H */
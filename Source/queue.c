@@ -221,7 +221,7 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 	static void prvInitialiseMutex( Queue_t *pxNewQueue ) PRIVILEGED_FUNCTION;
 #endif
 
-#if( configUSE_MUTEXES == 1 )
+#if( ( configUSE_MUTEXES == 1 ) && ( configUSE_EDF_SCHEDULER == 0 ) )
 	/*
 	 * If a task waiting for a mutex causes the mutex holder to inherit a
 	 * priority, but the waiting task times out, then the holder should
@@ -1606,15 +1606,27 @@ Queue_t * const pxQueue = xQueue;
 					{
 						taskENTER_CRITICAL();
 						{
+							#if ( configUSE_EDF_SCHEDULER == 1 )
+							{
+								/* The holder inherited this task's deadline, so
+								keeps only the earliest deadline of the tasks
+								still waiting for the mutex. */
+								vTaskDeadlineDisinheritAfterTimeout( pxQueue->u.xSemaphore.xMutexHolder, &( pxQueue->xTasksWaitingToReceive ) );
+							}
+							#else
+							{
 							UBaseType_t uxHighestWaitingPriority;
 
-							/* This task blocking on the mutex caused another
-							task to inherit this task's priority.  Now this task
-							has timed out the priority should be disinherited
-							again, but only as low as the next highest priority
-							task that is waiting for the same mutex. */
-							uxHighestWaitingPriority = prvGetDisinheritPriorityAfterTimeout( pxQueue );
-							vTaskPriorityDisinheritAfterTimeout( pxQueue->u.xSemaphore.xMutexHolder, uxHighestWaitingPriority );
+								/* This task blocking on the mutex caused
+								another task to inherit this task's priority.
+								Now this task has timed out the priority should
+								be disinherited again, but only as low as the
+								next highest priority task that is waiting for
+								the same mutex. */
+								uxHighestWaitingPriority = prvGetDisinheritPriorityAfterTimeout( pxQueue );
+								vTaskPriorityDisinheritAfterTimeout( pxQueue->u.xSemaphore.xMutexHolder, uxHighestWaitingPriority );
+							}
+							#endif /* configUSE_EDF_SCHEDULER */
 						}
 						taskEXIT_CRITICAL();
 					}
@@ -2044,7 +2056,7 @@ Queue_t * const pxQueue = xQueue;
 #endif /* configUSE_TRACE_FACILITY */
 /*-----------------------------------------------------------*/
 
-#if( configUSE_MUTEXES == 1 )
+#if( ( configUSE_MUTEXES == 1 ) && ( configUSE_EDF_SCHEDULER == 0 ) )
 
 	static UBaseType_t prvGetDisinheritPriorityAfterTimeout( const Queue_t * const pxQueue )
 	{
@@ -2068,7 +2080,7 @@ Queue_t * const pxQueue = xQueue;
 		return uxHighestPriorityOfWaitingTasks;
 	}
 
-#endif /* configUSE_MUTEXES */
+#endif /* ( configUSE_MUTEXES == 1 ) && ( configUSE_EDF_SCHEDULER == 0 ) */
 /*-----------------------------------------------------------*/
 
 static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue, const void *pvItemToQueue, const BaseType_t xPosition )
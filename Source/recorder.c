@@ -0,0 +1,225 @@
+/*
+ * FreeRTOS Kernel V10.3.0
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* This entire source file will be skipped if the application is not configured
+to include the recorder.  This #if is closed at the very bottom of this file.
+If you want to include the recorder then ensure configUSE_RECORDER is set to 1
+in FreeRTOSConfig.h. */
+#if ( configUSE_RECORDER == 1 )
+
+#if( ( configRECORDER_BUFFER_LENGTH & ( configRECORDER_BUFFER_LENGTH - 1UL ) ) != 0 )
+	#error configRECORDER_BUFFER_LENGTH must be a power of 2.
+#endif
+
+/* The largest time since the previous record usDelta can hold. */
+#define recorderMAX_DELTA			( 0xffffUL )
+
+/* The recording, laid out as a recording file.  The header, task and record
+structures are all multiples of four bytes long and hold nothing larger than
+four bytes, so there is no padding between them. */
+typedef struct RECORDER_RECORDING
+{
+	RecorderHeader_t xHeader;
+	RecorderTask_t xTasks[ configRECORDER_MAX_TASKS ];
+	RecorderRecord_t xRecords[ configRECORDER_BUFFER_LENGTH ];
+} Recording_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Write the event to the next record, preceded by an eRecorderTimeExtension
+ * record if one is needed.
+ */
+static void prvRecord( uint8_t ucEvent, uint32_t ulTask, uint32_t ulParam );
+
+/*-----------------------------------------------------------*/
+
+PRIVILEGED_DATA static Recording_t xRecording =
+{
+	{
+		recorderMAGIC,
+		( uint16_t ) recorderVERSION,
+		( uint16_t ) sizeof( RecorderRecord_t ),
+		( uint32_t ) configRECORDER_TIMESTAMP_HZ,
+		( uint32_t ) configTICK_RATE_HZ,
+		( uint8_t ) ( sizeof( TickType_t ) * 8U ),
+		0U,
+		( uint16_t ) configRECORDER_MAX_TASKS,
+		( uint32_t ) configRECORDER_BUFFER_LENGTH,
+		0UL,
+		0UL
+	},
+	{ { 0 } },
+	{ { 0 } }
+};
+
+/* The task last switched in, which is the task recorded with the events that
+are not about a task. */
+PRIVILEGED_DATA static uint32_t ulRunningTask = 0UL;
+
+PRIVILEGED_DATA static UBaseType_t uxTasks = ( UBaseType_t ) 0U;
+PRIVILEGED_DATA static volatile BaseType_t xRecorderStopped = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+static void prvRecord( uint8_t ucEvent, uint32_t ulTask, uint32_t ulParam )
+{
+UBaseType_t uxSavedInterruptStatus;
+uint32_t ulNow, ulDelta, ulIndex;
+RecorderRecord_t *pxRecord;
+
+	/* The timestamp is taken with the interrupts that record events masked,
+	so the records stay in time order. */
+	uxSavedInterruptStatus = ( UBaseType_t ) configRECORDER_SET_INTERRUPT_MASK();
+	{
+		if( xRecorderStopped == pdFALSE )
+		{
+			#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+				portALT_GET_RUN_TIME_COUNTER_VALUE( ulNow );
+			#else
+				ulNow = portGET_RUN_TIME_COUNTER_VALUE();
+			#endif
+
+			ulDelta = ulNow - xRecording.xHeader.ulLastTimestamp;
+			ulIndex = xRecording.xHeader.ulWritten;
+
+			if( ulDelta > recorderMAX_DELTA )
+			{
+				pxRecord = &( xRecording.xRecords[ ulIndex & ( configRECORDER_BUFFER_LENGTH - 1UL ) ] );
+				pxRecord->ucEvent = ( uint8_t ) eRecorderTimeExtension;
+				pxRecord->ucReserved = 0U;
+				pxRecord->usDelta = 0U;
+				pxRecord->ulTask = 0UL;
+				pxRecord->ulParam = ulDelta;
+
+				ulIndex++;
+				ulDelta = 0UL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxRecord = &( xRecording.xRecords[ ulIndex & ( configRECORDER_BUFFER_LENGTH - 1UL ) ] );
+			pxRecord->ucEvent = ucEvent;
+			pxRecord->ucReserved = 0U;
+			pxRecord->usDelta = ( uint16_t ) ulDelta;
+			pxRecord->ulTask = ulTask;
+			pxRecord->ulParam = ulParam;
+
+			xRecording.xHeader.ulWritten = ulIndex + 1UL;
+			xRecording.xHeader.ulLastTimestamp = ulNow;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	configRECORDER_CLEAR_INTERRUPT_MASK( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+void vRecorderTaskEvent( uint8_t ucEvent, uint32_t ulTask, uint32_t ulParam )
+{
+	prvRecord( ucEvent, ulTask, ulParam );
+}
+/*-----------------------------------------------------------*/
+
+void vRecorderEvent( uint8_t ucEvent, uint32_t ulParam )
+{
+	prvRecord( ucEvent, ulRunningTask, ulParam );
+}
+/*-----------------------------------------------------------*/
+
+void vRecorderTaskSwitchedIn( uint32_t ulTask, uint32_t ulDeadline )
+{
+	/* Called with interrupts disabled, so the running task cannot change
+	while it is compared. */
+	if( ulTask != ulRunningTask )
+	{
+		if( ulRunningTask != 0UL )
+		{
+			prvRecord( ( uint8_t ) eRecorderTaskSwitchedOut, ulRunningTask, 0UL );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		ulRunningTask = ulTask;
+		prvRecord( ( uint8_t ) eRecorderTaskSwitchedIn, ulRunningTask, ulDeadline );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vRecorderTaskCreate( uint32_t ulTask, const char *pcName, uint32_t ulPriority )
+{
+	/* Tasks are created inside a critical section. */
+	if( uxTasks < ( UBaseType_t ) configRECORDER_MAX_TASKS )
+	{
+		xRecording.xTasks[ uxTasks ].ulTask = ulTask;
+		strncpy( xRecording.xTasks[ uxTasks ].cName, pcName, recorderNAME_LENGTH - 1U );
+		xRecording.xTasks[ uxTasks ].cName[ recorderNAME_LENGTH - 1U ] = '\0';
+		uxTasks++;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	prvRecord( ( uint8_t ) eRecorderTaskCreate, ulTask, ulPriority );
+}
+/*-----------------------------------------------------------*/
+
+void vRecorderStop( void )
+{
+	xRecorderStopped = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+const void *pvRecorderGetRecording( size_t *pxLength )
+{
+	*pxLength = sizeof( xRecording );
+	return &xRecording;
+}
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+to include the recorder.  If you want to include the recorder then ensure
+configUSE_RECORDER is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_RECORDER == 1 */
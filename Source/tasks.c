@@ -80,6 +80,75 @@ functions but without including stdio.h here. */
 #define tskSTATICALLY_ALLOCATED_STACK_ONLY 			( ( uint8_t ) 1 )
 #define tskSTATICALLY_ALLOCATED_STACK_AND_TCB		( ( uint8_t ) 2 )
 
+/* Bits used to record how the current job of a periodic task has overrun, and
+the action taken, when configUSE_EDF_OVERRUN_HANDLING is 1.  All but
+tskEDF_JOB_ABORTED are cleared when the next job is released. */
+#define tskEDF_JOB_DEADLINE_MISSED		( ( uint8_t ) 0x01U )
+#define tskEDF_JOB_BUDGET_EXHAUSTED		( ( uint8_t ) 0x02U )
+#define tskEDF_JOB_ABORTED				( ( uint8_t ) 0x04U )
+#define tskEDF_JOB_DEMOTED				( ( uint8_t ) 0x08U )
+#define tskEDF_JOB_SKIP_NEXT_RELEASE	( ( uint8_t ) 0x10U )
+
+/* Servers are given their deadlines by the bandwidth server rather than by
+the release of jobs, so they have no jobs to overrun. */
+#if ( configUSE_EDF_BANDWIDTH_SERVER == 1 )
+	#define prvEDFIsServer( pxTCB )	( ( pxTCB )->ucServer != pdFALSE )
+#else
+	#define prvEDFIsServer( pxTCB )	pdFALSE
+#endif
+
+#if ( configUSE_EDF_SPORADIC_TASKS == 1 )
+	#define prvEDFIsSporadic( pxTCB )	( ( pxTCB )->ucSporadic != pdFALSE )
+#else
+	#define prvEDFIsSporadic( pxTCB )	pdFALSE
+#endif
+
+/* A task running the rest of a job aborted by the eOverrunAbortJob policy
+does not block in the kernel until it has called xTaskJobComplete(), so the
+code of the aborted job is ended as quickly as the task allows. */
+#if ( configUSE_EDF_OVERRUN_HANDLING == 1 )
+	#define prvEDFJobIsAborted( pxTCB )	( ( ( pxTCB )->ucJobOverruns & tskEDF_JOB_ABORTED ) != 0U )
+#else
+	#define prvEDFJobIsAborted( pxTCB )	pdFALSE
+#endif
+
+/* Bits used to record that a task is running with a deadline inherited from a
+task blocked on a mutex it holds, and that the task was in the background
+before it inherited the deadline. */
+#define tskEDF_INHERITED_DEADLINE		( ( uint8_t ) 0x01U )
+#define tskEDF_INHERITED_BACKGROUND		( ( uint8_t ) 0x02U )
+
+/* Bits used to record that a task has a change of timing pending, when
+configUSE_EDF_MODE_CHANGE is 1, that the change can raise the processor demand
+of the task, and that the admission test is analysing the change before it is
+accepted. */
+#define tskEDF_TIMING_PENDING			( ( uint8_t ) 0x01U )
+#define tskEDF_TIMING_RAISES_DEMAND		( ( uint8_t ) 0x02U )
+#define tskEDF_TIMING_TESTING			( ( uint8_t ) 0x04U )
+
+/* The demand of a task cannot rise if neither its utilisation, the share of
+the processor its jobs need over each period, nor its density, the share they
+need by each deadline, rises, and its jobs cannot be blocked for longer.  The
+shares are compared by cross multiplying, so a shorter period with a
+proportionally shorter execution time is not a rise. */
+#define prvEDFTimingRaisesDemand( pxTCB, pxNewTiming )																											\
+	( ( ( ( ( uint64_t ) ( pxNewTiming )->xWorstCaseExecutionTime * ( uint64_t ) ( pxTCB )->xTaskPeriod ) > ( ( uint64_t ) ( pxTCB )->xTaskWCET * ( uint64_t ) ( pxNewTiming )->xPeriod ) ) ||				\
+		( ( ( uint64_t ) ( pxNewTiming )->xWorstCaseExecutionTime * ( uint64_t ) ( pxTCB )->xTaskRelativeDeadline ) > ( ( uint64_t ) ( pxTCB )->xTaskWCET * ( uint64_t ) ( pxNewTiming )->xRelativeDeadline ) ) ||	\
+		( ( pxNewTiming )->xBlockingTime > ( pxTCB )->xTaskBlockingTime ) ) ? pdTRUE : pdFALSE )
+
+/* The length of a utilisation window in run time stats counts, when
+configUSE_EDF_UTILISATION_MONITOR is 1. */
+#define tskEDF_UTILISATION_WINDOW		( ( uint32_t ) configEDF_UTILISATION_WINDOW_TICKS * ( uint32_t ) configEDF_RUN_TIME_COUNTS_PER_TICK )
+
+/* Move the moving average ulAverage towards ulSample by
+1 / ( 2 ^ configEDF_UTILISATION_SHIFT ) of the difference.  The step is rounded
+away from ulAverage so the average reaches a constant sample, including 0. */
+#define tskEDF_UTILISATION_ROUNDING		( ( ( uint32_t ) 1UL << configEDF_UTILISATION_SHIFT ) - 1UL )
+#define prvEDFMovingAverage( ulAverage, ulSample )																			\
+	( ( ( ulSample ) >= ( ulAverage ) ) ?																					\
+		( ( ulAverage ) + ( ( ( ulSample ) - ( ulAverage ) + tskEDF_UTILISATION_ROUNDING ) >> configEDF_UTILISATION_SHIFT ) ) :	\
+		( ( ulAverage ) - ( ( ( ulAverage ) - ( ulSample ) + tskEDF_UTILISATION_ROUNDING ) >> configEDF_UTILISATION_SHIFT ) ) )
+
 /* If any of the following are set then task stacks are filled with a known
 value so the high water mark can be determined.  If none of the following are
 set then don't fill the stack so there is no unnecessary dependency on memset. */
@@ -211,6 +280,19 @@ count overflows. */
 
 /*-----------------------------------------------------------*/
 
+/*
+ * Under hybrid scheduling the tasks of priority above configEDF_MAX_PRIORITY
+ * form a fixed priority band that is scheduled as without EDF, from
+ * pxReadyTasksLists, ahead of every task with a deadline.  The tasks of the
+ * priorities up to configEDF_MAX_PRIORITY are scheduled by EDF.
+ */
+#if ( configUSE_EDF_HYBRID_SCHEDULING == 1 )
+	#define prvEDFIsFixedPriority( pxTCB )	( ( ( pxTCB )->uxPriority > ( UBaseType_t ) configEDF_MAX_PRIORITY ) ? pdTRUE : pdFALSE )
+#else
+	#define prvEDFIsFixedPriority( pxTCB )	pdFALSE
+#endif
+/*-----------------------------------------------------------*/
+
 /*
  * Place the task represented by pxTCB into the appropriate ready list for
  * the task.  It is inserted at the end of the list.
@@ -221,9 +303,191 @@ count overflows. */
 	taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );												\
 	vListInsertEnd( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
 	tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
+#elif ( configUSE_EDF_HYBRID_SCHEDULING == 0 )
+#define prvAddTaskToReadyList( pxTCB ) /*xStateListItem must contain the deadline value */ \
+	traceMOVED_TASK_TO_READY_STATE( pxTCB );														\
+	if( ( pxTCB )->ucBackground == pdFALSE )														\
+	{																								\
+		prvEDFReadyHeapInsert( pxTCB );																\
+	}																								\
+	else																							\
+	{																								\
+		vListInsertEnd( &xBackgroundTasksListEDF, &( ( pxTCB )->xStateListItem ) );					\
+	}																								\
+	tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
 #else
 #define prvAddTaskToReadyList( pxTCB ) /*xStateListItem must contain the deadline value */ \
-vListInsert( &(xReadyTasksListEDF), &(( pxTCB )->xStateListItem ))
+	traceMOVED_TASK_TO_READY_STATE( pxTCB );														\
+	if( prvEDFIsFixedPriority( pxTCB ) != pdFALSE )													\
+	{																								\
+		taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );											\
+		vListInsertEnd( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
+	}																								\
+	else if( ( pxTCB )->ucBackground == pdFALSE )													\
+	{																								\
+		prvEDFReadyHeapInsert( pxTCB );																\
+	}																								\
+	else																							\
+	{																								\
+		vListInsertEnd( &xBackgroundTasksListEDF, &( ( pxTCB )->xStateListItem ) );					\
+	}																								\
+	tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
+#endif
+/*-----------------------------------------------------------*/
+
+/*
+ * Remove the task represented by pxTCB from the list, or when the EDF
+ * scheduler is used the ready heap, referenced by its state list item.
+ * Returns the number of tasks remaining in that list or heap.
+ */
+#if (configUSE_EDF_SCHEDULER == 0)
+	#define prvRemoveTaskFromStateList( pxTCB ) uxListRemove( &( ( pxTCB )->xStateListItem ) )
+#elif ( configUSE_EDF_HYBRID_SCHEDULING == 0 )
+	#define prvRemoveTaskFromStateList( pxTCB )															\
+		( ( listIS_CONTAINED_WITHIN( &xReadyTasksListEDF, &( ( pxTCB )->xStateListItem ) ) != pdFALSE ) ?	\
+		prvEDFReadyHeapRemove( pxTCB ) : uxListRemove( &( ( pxTCB )->xStateListItem ) ) )
+#endif
+
+#if ( configUSE_EDF_SCHEDULER == 1 )
+	/* Returns pdTRUE if the task represented by pxTCB is in the Ready state,
+	either in the ready heap or in the background, or under hybrid scheduling
+	in the ready list of its fixed priority. */
+	#if ( configUSE_EDF_HYBRID_SCHEDULING == 0 )
+		#define prvEDFTaskIsReady( pxTCB )																				\
+			( ( ( listIS_CONTAINED_WITHIN( &xReadyTasksListEDF, &( ( pxTCB )->xStateListItem ) ) != pdFALSE ) ||		\
+			( listIS_CONTAINED_WITHIN( &xBackgroundTasksListEDF, &( ( pxTCB )->xStateListItem ) ) != pdFALSE ) ) ? pdTRUE : pdFALSE )
+	#else
+		#define prvEDFTaskIsReady( pxTCB )																				\
+			( ( ( listIS_CONTAINED_WITHIN( &xReadyTasksListEDF, &( ( pxTCB )->xStateListItem ) ) != pdFALSE ) ||		\
+			( listIS_CONTAINED_WITHIN( &xBackgroundTasksListEDF, &( ( pxTCB )->xStateListItem ) ) != pdFALSE ) ||		\
+			( prvEDFIsFixedPriorityReadyList( listLIST_ITEM_CONTAINER( &( ( pxTCB )->xStateListItem ) ) ) != pdFALSE ) ) ? pdTRUE : pdFALSE )
+
+		/* Returns pdTRUE if pxList is one of the ready lists of the fixed
+		priority band.  The ready lists of the priorities of the EDF band are
+		never used. */
+		#define prvEDFIsFixedPriorityReadyList( pxList )															\
+			( ( ( ( pxList ) > &( pxReadyTasksLists[ configEDF_MAX_PRIORITY ] ) ) &&								\
+			( ( pxList ) < &( pxReadyTasksLists[ configMAX_PRIORITIES ] ) ) ) ? pdTRUE : pdFALSE )
+	#endif
+
+	/* Select the task with the earliest deadline to run or, when no task with
+	a deadline is ready, the next of the background tasks in turn.  Both take
+	the same time however many tasks are ready.  Under hybrid scheduling a
+	ready task of the fixed priority band is selected first, in the same way as
+	without EDF. */
+	#if ( configUSE_EDF_HYBRID_SCHEDULING == 0 )
+		#define prvEDFSelectTask()																			\
+		{																									\
+			if( pxEDFReadyHeapRoot != NULL )																\
+			{																								\
+				pxCurrentTCB = pxEDFReadyHeapRoot;															\
+			}																								\
+			else																							\
+			{																								\
+				listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &xBackgroundTasksListEDF );						\
+			}																								\
+		}
+	#else
+		#define prvEDFSelectTask()																			\
+		{																									\
+			if( prvEDFGetTopFixedPriority() > ( UBaseType_t ) configEDF_MAX_PRIORITY )						\
+			{																								\
+				taskSELECT_HIGHEST_PRIORITY_TASK();															\
+			}																								\
+			else if( pxEDFReadyHeapRoot != NULL )															\
+			{																								\
+				pxCurrentTCB = pxEDFReadyHeapRoot;															\
+			}																								\
+			else																							\
+			{																								\
+				listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &xBackgroundTasksListEDF );						\
+			}																								\
+		}
+	#endif
+
+	/* Returns pdTRUE if a task with a deadline is ready and is not the running
+	task, so the running task must be switched out.  Under hybrid scheduling
+	that is decided by prvEDFSwitchRequired(), which also takes the fixed
+	priority band into account. */
+	#if ( configUSE_EDF_HYBRID_SCHEDULING == 0 )
+		#define prvEDFSwitchRequired()	( ( ( pxEDFReadyHeapRoot != NULL ) && ( pxEDFReadyHeapRoot != pxCurrentTCB ) ) ? pdTRUE : pdFALSE )
+	#endif
+
+	/* Returns pdTRUE if the tick time xTimeA is earlier than the tick time
+	xTimeB.  Times wrap with the tick count, so they are compared by the sign of
+	their difference rather than by value.  This orders them correctly across a
+	tick count overflow provided they are less than half the range of the tick
+	type apart, which holds for the deadlines and release times of tasks while
+	task periods are less than that. */
+	#if( configUSE_16_BIT_TICKS == 1 )
+		#define prvEDFTimeIsBefore( xTimeA, xTimeB ) ( ( ( int16_t ) ( ( TickType_t ) ( xTimeA ) - ( TickType_t ) ( xTimeB ) ) < 0 ) ? pdTRUE : pdFALSE )
+	#else
+		#define prvEDFTimeIsBefore( xTimeA, xTimeB ) ( ( ( int32_t ) ( ( TickType_t ) ( xTimeA ) - ( TickType_t ) ( xTimeB ) ) < 0 ) ? pdTRUE : pdFALSE )
+	#endif
+
+	/* Returns pdTRUE if the deadline of the task represented by pxTCBA, held
+	in its list item xListItem, is earlier than that of the task represented by
+	pxTCBB.  A task in the background is ordered behind every task that is not,
+	whatever their deadlines. */
+	#define prvEDFItemIsBefore( pxTCBA, pxTCBB, xListItem )																\
+		( ( ( pxTCBA )->ucBackground != ( pxTCBB )->ucBackground ) ?														\
+		( ( ( pxTCBA )->ucBackground == pdFALSE ) ? pdTRUE : pdFALSE ) :													\
+		prvEDFTimeIsBefore( listGET_LIST_ITEM_VALUE( &( ( pxTCBA )->xListItem ) ), listGET_LIST_ITEM_VALUE( &( ( pxTCBB )->xListItem ) ) ) )
+
+	/* The deadline of a ready task is held in its state list item, and that of
+	a task waiting for an event in its event list item.  Under hybrid
+	scheduling a waiting task of the fixed priority band is ordered by its
+	priority, so ahead of every waiting task of the EDF band. */
+	#define prvEDFDeadlineIsBefore( pxTCBA, pxTCBB )	prvEDFItemIsBefore( pxTCBA, pxTCBB, xStateListItem )
+
+	/* The order of the ready heap.  Tasks with equal deadlines are ordered by
+	when they were added to the heap, as the heap itself does not keep the
+	order in which equal items were inserted. */
+	#define prvEDFReadyHeapIsBefore( pxTCBA, pxTCBB )																	\
+		( ( ( prvEDFDeadlineIsBefore( pxTCBA, pxTCBB ) != pdFALSE ) ||														\
+		( ( prvEDFDeadlineIsBefore( pxTCBB, pxTCBA ) == pdFALSE ) &&														\
+		( ( int32_t ) ( ( pxTCBA )->ulEDFReadySequence - ( pxTCBB )->ulEDFReadySequence ) < 0 ) ) ) ? pdTRUE : pdFALSE )
+	#if ( configUSE_EDF_HYBRID_SCHEDULING == 0 )
+		#define prvEDFWaiterIsBefore( pxTCBA, pxTCBB )	prvEDFItemIsBefore( pxTCBA, pxTCBB, xEventListItem )
+	#else
+		#define prvEDFWaiterIsBefore( pxTCBA, pxTCBB )																		\
+			( ( ( prvEDFIsFixedPriority( pxTCBA ) != pdFALSE ) || ( prvEDFIsFixedPriority( pxTCBB ) != pdFALSE ) ) ?		\
+			( ( ( pxTCBA )->uxPriority > ( pxTCBB )->uxPriority ) ? pdTRUE : pdFALSE ) :									\
+			prvEDFItemIsBefore( pxTCBA, pxTCBB, xEventListItem ) )
+	#endif
+#endif
+/*-----------------------------------------------------------*/
+
+/*
+ * Return pdTRUE if the task represented by pxTCB, which has just been made
+ * ready, should run in place of the running task.  When the EDF scheduler is
+ * used that is if its deadline is earlier than that of the running task,
+ * otherwise if its priority is higher.  prvTaskMayPreempt() is used where the
+ * kernel also yields to a task of equal priority, as a yield then leaves the
+ * ready lists in the correct state.
+ *
+ * The deadline of a task held in the pending ready list is not set until
+ * xTaskResumeAll() moves the task to the ready heap, so it is only compared
+ * then.  Under hybrid scheduling a task of the fixed priority band preempts
+ * any task of the EDF band, and is only preempted by a task of higher
+ * priority.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_HYBRID_SCHEDULING == 0 ) )
+	#define prvTaskPreempts( pxTCB )																		\
+		( ( ( listIS_CONTAINED_WITHIN( &xReadyTasksListEDF, &( ( pxTCB )->xStateListItem ) ) != pdFALSE ) &&	\
+		( prvEDFDeadlineIsBefore( ( pxTCB ), pxCurrentTCB ) != pdFALSE ) ) ? pdTRUE : pdFALSE )
+	#define prvTaskMayPreempt( pxTCB )	prvTaskPreempts( pxTCB )
+#elif ( configUSE_EDF_SCHEDULER == 1 )
+	#define prvTaskPreempts( pxTCB )																				\
+		( ( prvEDFIsFixedPriority( pxTCB ) != pdFALSE ) ?															\
+		( ( ( prvEDFIsFixedPriority( pxCurrentTCB ) == pdFALSE ) || ( ( pxTCB )->uxPriority > pxCurrentTCB->uxPriority ) ) ? pdTRUE : pdFALSE ) :	\
+		( ( ( prvEDFIsFixedPriority( pxCurrentTCB ) == pdFALSE ) &&												\
+		( listIS_CONTAINED_WITHIN( &xReadyTasksListEDF, &( ( pxTCB )->xStateListItem ) ) != pdFALSE ) &&			\
+		( prvEDFDeadlineIsBefore( ( pxTCB ), pxCurrentTCB ) != pdFALSE ) ) ? pdTRUE : pdFALSE ) )
+	#define prvTaskMayPreempt( pxTCB )	prvTaskPreempts( pxTCB )
+#else
+	#define prvTaskPreempts( pxTCB )	( ( ( pxTCB )->uxPriority > pxCurrentTCB->uxPriority ) ? pdTRUE : pdFALSE )
+	#define prvTaskMayPreempt( pxTCB )	( ( ( pxTCB )->uxPriority >= pxCurrentTCB->uxPriority ) ? pdTRUE : pdFALSE )
 #endif
 /*-----------------------------------------------------------*/
 
@@ -249,6 +513,25 @@ to its original value when it is released. */
 	#define taskEVENT_LIST_ITEM_VALUE_IN_USE	0x80000000UL
 #endif
 
+#if ( configUSE_EDF_UTILISATION_MONITOR == 1 )
+
+	/*
+	 * The processor time used by a task, or by every task but the idle task,
+	 * in run time stats counts.  ulRunTime is only added to the moving average
+	 * once the window it was measured in has ended, and the windows that ended
+	 * since are then added as windows in which no time was used.
+	 */
+	typedef struct tskEDF_UTILISATION
+	{
+		uint32_t ulWindow;		/*< The number of the window ulRunTime was measured in. */
+		uint32_t ulRunTime;		/*< The time used in that window so far. */
+		uint32_t ulAverage;		/*< The moving average of the time used in a window. */
+		uint32_t ulLastWindow;	/*< The time used in the window that ended last. */
+		uint32_t ulPeak;		/*< The largest value of ulAverage. */
+	} EDFUtilisation_t;
+
+#endif /* configUSE_EDF_UTILISATION_MONITOR */
+
 /*
  * Task control block.  A task control block (TCB) is allocated for each task,
  * and stores task state information, including a pointer to the task's context
@@ -270,6 +553,51 @@ typedef struct tskTaskControlBlock {			/* The old naming convention is used to p
 	
 	#if ( configUSE_EDF_SCHEDULER == 1 )
  TickType_t xTaskPeriod; /*< Stores the period in tick of the task. > */
+		TickType_t xTaskRelativeDeadline;	/*< The deadline of each job relative to its release, no longer than the period. */
+		TickType_t xTaskPhase;				/*< The offset of the first release from the time the task was created. */
+		TickType_t xTaskWCET;				/*< The worst case execution time of a job, or 0 if it is not known. */
+		TickType_t xTaskBlockingTime;		/*< The longest time a job can be blocked by tasks with later deadlines holding mutexes it needs. */
+		struct tskTaskControlBlock *pxEDFHeapParent;	/*< Links the task into the EDF ready heap.  Only valid while the task is in the Ready state. */
+		struct tskTaskControlBlock *pxEDFHeapLeft;
+		struct tskTaskControlBlock *pxEDFHeapRight;
+		uint32_t			ulEDFReadySequence;	/*< When the task was added to the ready heap, which orders it behind the tasks with the same deadline added before it. */
+		TickType_t			xTaskReleaseTime;	/*< The nominal release time of the current job, or of the next job while ucReleasePending is set.  The deadline of a job is always calculated from it. */
+		TaskReleaseJitter_t	xReleaseJitter;		/*< How late jobs were released relative to their nominal release times. */
+		uint8_t				ucReleasePending;	/*< Set while the task is delayed until the release of its next job. */
+		uint8_t				ucBackground;		/*< Set while the task is in the background, where it is ordered behind every task that has a deadline. */
+		uint8_t				ucEventListOrdered;	/*< Set if the event list item of the task was last placed in an event list ordered by deadline, where its place changes with the deadline of the task. */
+		#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+			struct tskTaskControlBlock *pxEDFNextAdmitted;	/*< Links the task into the list of periodic tasks accepted by the admission test. */
+		#endif
+		#if ( configUSE_EDF_OVERRUN_HANDLING == 1 )
+			TaskOverrunStatus_t	xOverrunStatus;		/*< The number of jobs of the task that have overrun. */
+			uint32_t			ulJobStartRunTime;	/*< The run time counter of the task when its current job was released, from which the execution time of the job is measured. */
+			uint8_t				ucOverrunPolicy;	/*< The eOverrunPolicy applied when a job of the task overruns. */
+			uint8_t				ucJobOverruns;		/*< The tskEDF_JOB_ bits recording how the current job has overrun and what has been done about it. */
+		#endif
+		#if ( configUSE_EDF_BANDWIDTH_SERVER == 1 )
+			TickType_t			xServerBudget;		/*< The budget a server has left before its deadline is postponed.  The full budget is held in xTaskWCET. */
+			TickType_t			xServerDeadline;	/*< The deadline of a server, which is kept while the server is blocked. */
+			uint8_t				ucServer;			/*< Set if the task is run by a constant bandwidth server rather than released periodically. */
+		#endif
+		#if ( configUSE_EDF_SPORADIC_TASKS == 1 )
+			uint8_t				ucSporadic;			/*< Set if the jobs of the task are released by notifications rather than periodically.  xTaskPeriod then holds the minimum inter-arrival time. */
+		#endif
+		#if ( configUSE_EDF_MODE_CHANGE == 1 )
+			TaskPeriodicParameters_t xNewTiming;	/*< The timing the task moves to when one of its jobs is released, valid while ucTimingChange is set.  The relative deadline is never 0. */
+			uint8_t				ucTimingChange;		/*< The tskEDF_TIMING_ bits recording whether the task has a change of timing pending. */
+		#endif
+		#if ( configUSE_MUTEXES == 1 )
+			TickType_t			xInheritedDeadline;	/*< The earliest deadline of the tasks blocked on mutexes held by the task, valid while ucDeadlineInherited is set. */
+			uint8_t				ucDeadlineInherited;/*< The tskEDF_INHERITED_ bits recording whether the task is running with an inherited deadline. */
+		#endif
+		#if ( configUSE_EDF_TASK_STATISTICS == 1 )
+			TaskJobStatistics_t	xJobStatistics;		/*< The statistics of the jobs of the task, see vTaskGetJobStatistics(). */
+			uint32_t			ulJobReleaseRunTime;/*< The run time counter of the task when its current job was released, from which the execution time of the job is measured. */
+		#endif
+		#if ( configUSE_EDF_UTILISATION_MONITOR == 1 )
+			EDFUtilisation_t	xUtilisation;		/*< The processor time used by the task, see vTaskGetUtilisation(). */
+		#endif
  
 //ListItem_t  xGenericListItem;
  #endif
@@ -356,7 +684,32 @@ doing so breaks some kernel aware debuggers and debuggers that rely on removing
 the static qualifier. */
 /*EDF*/
 #if ( configUSE_EDF_SCHEDULER == 1 )
- PRIVILEGED_DATA static List_t xReadyTasksListEDF; /*< Ready tasks ordered by their deadline. */
+ PRIVILEGED_DATA static List_t xReadyTasksListEDF; /*< Never holds items.  The state list item of each task in the EDF ready heap references this list, and its length is the number of tasks in the heap, so the state of a task can be determined as when lists are used. */
+	PRIVILEGED_DATA static TCB_t * volatile pxEDFReadyHeapRoot = NULL; /*< Ready tasks ordered by their deadline.  The root is the ready task with the earliest deadline. */
+	PRIVILEGED_DATA static uint32_t ulEDFReadySequence = 0UL; /*< Counts the tasks added to the ready heap. */
+	PRIVILEGED_DATA static List_t xBackgroundTasksListEDF;	/*< Ready tasks in the background, including the idle task.  They share the processor in turn while the ready heap is empty. */
+
+	#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+		PRIVILEGED_DATA static TCB_t *pxEDFAdmittedTasks = NULL;	/*< The periodic tasks accepted by the admission test, linked through pxEDFNextAdmitted. */
+		PRIVILEGED_DATA static uint32_t ulEDFUtilisation = 0UL;		/*< The sum of the utilisations of the admitted tasks, where tskEDF_FULL_UTILISATION is a utilisation of 1. */
+	#endif
+
+	#if ( configUSE_EDF_MODE_CHANGE == 1 )
+		PRIVILEGED_DATA static UBaseType_t uxEDFTimingChangesPending = ( UBaseType_t ) 0U;	/*< The number of tasks with a change of timing pending. */
+		PRIVILEGED_DATA static UBaseType_t uxEDFDemandDecreasesPending = ( UBaseType_t ) 0U;	/*< The number of those changes that cannot raise the demand of their tasks, which the other changes wait for.  Each is waiting for the current job of its task to complete. */
+		PRIVILEGED_DATA static TimeOut_t xEDFDemandDecreasesTimeOut;							/*< When xEDFDemandDecreasesWait was last set. */
+		PRIVILEGED_DATA static TickType_t xEDFDemandDecreasesWait = ( TickType_t ) 0U;			/*< The ticks from xEDFDemandDecreasesTimeOut to the latest deadline of the jobs those changes wait for, after which the other changes stop waiting. */
+		#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+			PRIVILEGED_DATA static BaseType_t xEDFAnalyseNewTiming = pdFALSE;	/*< Set while the admission test analyses the admitted tasks with their pending changes of timing applied. */
+		#endif
+	#endif
+
+	#if ( configUSE_EDF_UTILISATION_MONITOR == 1 )
+		PRIVILEGED_DATA static uint32_t ulEDFUtilisationWindow = 0UL;		/*< The number of the current utilisation window, which counts the windows that have ended. */
+		PRIVILEGED_DATA static uint32_t ulEDFUtilisationWindowStart = 0UL;	/*< The run time counter at the start of the current window.  Like ulTaskSwitchedInTime it assumes the counter starts from 0. */
+		PRIVILEGED_DATA static uint32_t ulEDFUtilisationAccounted = 0UL;	/*< The run time counter up to which the time of the running task has been added to its utilisation. */
+		PRIVILEGED_DATA static EDFUtilisation_t xEDFSystemUtilisation;		/*< The processor time used by every task but the idle task. */
+	#endif
  #endif
 
 PRIVILEGED_DATA static List_t pxReadyTasksLists[ configMAX_PRIORITIES ];/*< Prioritised ready tasks. */
@@ -442,6 +795,12 @@ PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended	= ( UBaseType_t
 
 #endif
 
+#if( configUSE_EDF_OVERRUN_HOOK == 1 )
+
+	extern void vApplicationOverrunHook( TaskHandle_t xTask, eOverrunType eType ); /*lint !e526 Symbol not defined as it is an application callback. */
+
+#endif
+
 /* File private functions. --------------------------------*/
 
 /**
@@ -514,6 +873,16 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait, const BaseT
 
 #endif
 
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) )
+
+	/*
+	 * As prvListTasksWithinSingleList(), but for the tasks in the EDF ready
+	 * heap.
+	 */
+	static UBaseType_t prvListTasksWithinEDFReadyHeap( TaskStatus_t *pxTaskStatusArray ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
  * Searches pxList for a task with name pcNameToQuery - returning a handle to
  * the task if it is found, or NULL if the task is not found.
@@ -550,6 +919,18 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait, const BaseT
 
 #endif
 
+#if ( configUSE_EVENT_DRIVEN_TICK == 1 )
+
+	/*
+	 * Return the number of ticks, at least 1, from the current tick count to
+	 * the next tick that xTaskIncrementTick() has to process, leaving out the
+	 * budget of the running job, which depends on the time it runs for rather
+	 * than on the tick count.
+	 */
+	static TickType_t prvGetTicksToNextEvent( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
  * Set xNextTaskUnblockTime to the time at which the next Blocked state task
  * will exit the Blocked state.
@@ -585,6 +966,362 @@ static void prvInitialiseNewTask( 	TaskFunction_t pxTaskCode,
  */
 static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+	/*
+	 * The ready tasks are held in a binary min-heap ordered by the deadline held
+	 * in the state list item of each task, and first in first out among tasks
+	 * with equal deadlines.  The heap is built from links held in
+	 * the TCB, so inserting or removing a task takes O(log n) time, without any
+	 * memory being allocated, and the task with the earliest deadline is always
+	 * at the root.
+	 */
+	static void prvEDFReadyHeapInsert( TCB_t *pxTCB ) PRIVILEGED_FUNCTION;
+	static UBaseType_t prvEDFReadyHeapRemove( TCB_t *pxTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Return the task at position uxPosition of the heap, where the root is at
+	 * position 1 and the children of the task at position n are at positions 2n
+	 * and 2n + 1.
+	 */
+	static TCB_t *prvEDFReadyHeapGetTask( UBaseType_t uxPosition ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Exchange the positions in the heap of the task represented by pxTCB and
+	 * its parent.
+	 */
+	static void prvEDFReadyHeapSwapWithParent( TCB_t *pxTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Returns pdTRUE if the timing parameters pointed to by pxPeriodicParameters
+	 * describe a periodic task that can be created, otherwise pdFALSE.
+	 */
+	static BaseType_t prvEDFTimingIsValid( const TaskPeriodicParameters_t * const pxPeriodicParameters ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Called after a periodic task has been initialised to store its timing
+	 * parameters in the TCB and set the deadline of its first job.  A task
+	 * created with pxPeriodicParameters set to NULL runs in the background.
+	 */
+	static void prvEDFInitialiseNewTaskTiming( TCB_t *pxNewTCB, const TaskPeriodicParameters_t * const pxPeriodicParameters ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Set the deadline of the task represented by pxTCB from the nominal
+	 * release time of its job.  If the task was waiting for the release of its
+	 * next job then that job is released now, and how late it is released is
+	 * recorded.
+	 */
+	static void prvEDFSetDeadline( TCB_t *pxTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Place the task represented by pxTCB, which must not be in any state list,
+	 * in the Blocked state until the tick count reaches xTimeToWake.  As
+	 * prvAddCurrentTaskToDelayedList(), but for any task.
+	 */
+	static void prvEDFAddTaskToDelayedList( TCB_t *pxTCB, TickType_t xTimeToWake ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Release the job of the task represented by pxTCB, which was waiting for
+	 * a notification and has been removed from its state list, and place the
+	 * task in the ready heap.  A job that arrives at a sporadic task before its
+	 * minimum inter-arrival time has passed is not released until it has, so
+	 * the task is held in the Blocked state until then.  Returns pdTRUE if the
+	 * task was made ready.
+	 */
+	static BaseType_t prvEDFReleaseNotifiedTask( TCB_t *pxTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Place the event list item of the running task in pxEventList, holding
+	 * the deadline of the task, behind the items of the tasks with earlier or
+	 * equal deadlines.
+	 */
+	static void prvEDFPlaceOnEventList( List_t * const pxEventList ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Insert the event list item of the task represented by pxTCB, which
+	 * already holds the deadline of the task, in pxEventList behind the items
+	 * of the tasks that are woken first.
+	 */
+	static void prvEDFInsertInEventList( List_t * const pxEventList, TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+	#if ( ( configUSE_MUTEXES == 1 ) || ( configUSE_EDF_MODE_CHANGE == 1 ) || ( ( configUSE_EDF_HYBRID_SCHEDULING == 1 ) && ( INCLUDE_vTaskPrioritySet == 1 ) ) )
+
+		/*
+		 * Called when the deadline, or under hybrid scheduling the priority,
+		 * of the task represented by pxTCB, which is not ready, has changed.
+		 * If the task is waiting in an event list ordered by deadline its
+		 * event list item is moved to the place of the deadline the task has
+		 * when it is next made ready.  Must be called from a critical section,
+		 * as the event list can be accessed from interrupts.
+		 */
+		static void prvEDFReorderWaitingTask( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+	#endif
+
+#endif /* configUSE_EDF_SCHEDULER */
+
+#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+
+	/*
+	 * Returns pdTRUE if every job of the admitted tasks would still meet its
+	 * deadline if a task with the timing parameters pointed to by
+	 * pxPeriodicParameters were admitted in place of the task represented by
+	 * pxReplacedTCB, or in addition to the admitted tasks if pxReplacedTCB is
+	 * NULL.  Otherwise returns pdFALSE.  The test uses the declared worst case
+	 * execution and blocking times of the tasks.  The scheduler must be
+	 * suspended.  While changes of timing are pending the test must pass both
+	 * before and after they are applied.
+	 */
+	static BaseType_t prvEDFTaskSetIsSchedulable( const TCB_t * const pxReplacedTCB, const TaskPeriodicParameters_t * const pxPeriodicParameters ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * As prvEDFTaskSetIsSchedulable(), for the admitted tasks with or without
+	 * their pending changes of timing, as selected by xEDFAnalyseNewTiming.
+	 */
+	static BaseType_t prvEDFModeIsSchedulable( const TCB_t * const pxReplacedTCB, const TaskPeriodicParameters_t * const pxPeriodicParameters ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * The processor demand of the admitted tasks, other than the task
+	 * represented by pxReplacedTCB, and of a task with the timing parameters
+	 * pointed to by pxPeriodicParameters, when the first jobs of all the tasks
+	 * are released at time 0.  That is the execution time of the jobs due by
+	 * ullTime, or of the jobs released by ullTime if xCountReleases is pdTRUE,
+	 * plus the longest time one of those jobs can be blocked on a mutex.
+	 */
+	static uint64_t prvEDFDemand( const TCB_t * const pxReplacedTCB, const TaskPeriodicParameters_t * const pxPeriodicParameters, uint64_t ullTime, BaseType_t xCountReleases ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * For the same tasks as prvEDFDemand(), returns the latest deadline that
+	 * is earlier than ullTime, or 0 if there is none.
+	 */
+	static uint64_t prvEDFLatestDeadlineBefore( const TCB_t * const pxReplacedTCB, const TaskPeriodicParameters_t * const pxPeriodicParameters, uint64_t ullTime ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Add the task represented by pxTCB to, or remove it from, the admitted
+	 * tasks.
+	 */
+	static void prvEDFAdmitTask( TCB_t *pxTCB ) PRIVILEGED_FUNCTION;
+	static void prvEDFWithdrawTask( TCB_t *pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_EDF_ADMISSION_CONTROL */
+
+#if ( configUSE_EDF_OVERRUN_HANDLING == 1 )
+
+	/*
+	 * Called from the tick interrupt to check whether the job of the running
+	 * task has missed its deadline or exhausted its budget, and if so to apply
+	 * the overrun policy of the task.
+	 */
+	static void prvEDFCheckForOverrun( void ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Count an overrun of the current job of the task represented by pxTCB,
+	 * and pass it to the overrun hook if one is configured.
+	 */
+	static void prvEDFRecordOverrun( TCB_t *pxTCB, eOverrunType eType ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Apply the overrun policy of the task represented by pxTCB, which must be
+	 * in the ready heap, to its current job.
+	 */
+	static void prvEDFApplyOverrunPolicy( TCB_t *pxTCB ) PRIVILEGED_FUNCTION;
+
+	#if ( configGENERATE_RUN_TIME_STATS == 1 )
+
+		/*
+		 * Returns pdTRUE if the current job of the task represented by pxTCB
+		 * has executed for longer than the worst case execution time of the
+		 * task, otherwise pdFALSE.
+		 */
+		static BaseType_t prvEDFBudgetIsExhausted( const TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+	#endif /* configGENERATE_RUN_TIME_STATS */
+
+#endif /* configUSE_EDF_OVERRUN_HANDLING */
+
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+	/*
+	 * Record the completion, at xCompletionTime, of the current job of the
+	 * task represented by pxTCB, if it is the job of a periodic task.  Must be
+	 * called before the release time of the next job is set.
+	 */
+	static void prvEDFRecordJobCompletion( TCB_t *pxTCB, const TickType_t xCompletionTime ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_EDF_SCHEDULER */
+
+#if ( configUSE_EDF_TASK_STATISTICS == 1 )
+
+	/*
+	 * Add the job of the task represented by pxTCB completed at
+	 * xCompletionTime to the statistics of the task.
+	 */
+	static void prvEDFUpdateJobStatistics( TCB_t *pxTCB, const TickType_t xCompletionTime ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_EDF_TASK_STATISTICS */
+
+#if ( ( ( configUSE_EDF_OVERRUN_HANDLING == 1 ) || ( configUSE_EDF_TASK_STATISTICS == 1 ) ) && ( configGENERATE_RUN_TIME_STATS == 1 ) )
+
+	/*
+	 * The run time counter of the task represented by pxTCB, including the
+	 * time it has been running since it was last switched in if it is the
+	 * running task.
+	 */
+	static uint32_t prvEDFGetRunTime( const TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_EDF_UTILISATION_MONITOR == 1 )
+
+	/*
+	 * Add the time the running task has run since it was last accounted, up
+	 * to the run time counter value ulNow, to its utilisation and to that of
+	 * the system, ending each utilisation window that ended in that time.
+	 * Called from vTaskSwitchContext() before the running task is switched
+	 * out.
+	 */
+	static void prvEDFAccountUtilisation( const uint32_t ulNow ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Add ulRunTime to the time used in the current window by the running task
+	 * and, if it is not the idle task, by the system.
+	 */
+	static void prvEDFAddUtilisation( const uint32_t ulRunTime ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Bring the moving average of pxUtilisation up to date with the windows
+	 * that have ended since it was last updated.
+	 */
+	static void prvEDFUpdateUtilisation( EDFUtilisation_t *pxUtilisation ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Account the running task up to now and write pxUtilisation, brought up
+	 * to date, to pxTaskUtilisation as fractions of a window.
+	 */
+	static void prvEDFGetUtilisation( EDFUtilisation_t *pxUtilisation, TaskUtilisation_t *pxTaskUtilisation ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_EDF_UTILISATION_MONITOR */
+
+#if ( configUSE_EDF_BANDWIDTH_SERVER == 1 )
+
+	/*
+	 * Called when the server represented by pxTCB becomes ready.  The server
+	 * keeps its deadline and remaining budget only if using the budget by that
+	 * deadline would not take more than its bandwidth, otherwise it is given a
+	 * full budget and a deadline one server period away.
+	 */
+	static void prvEDFServerWake( TCB_t *pxTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Makes the newly created task represented by pxTCB, the worst case
+	 * execution time of which is the server budget, a server.  The scheduler
+	 * must be suspended from the creation of the task.
+	 */
+	static void prvEDFInitialiseServer( TCB_t *pxTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Called from the tick interrupt to charge the tick to the budget of the
+	 * running task if it is a server.  An exhausted budget is recharged and
+	 * the deadline of the server postponed by one server period.
+	 */
+	static void prvEDFChargeServer( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_EDF_BANDWIDTH_SERVER */
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_MUTEXES == 1 ) )
+
+	/*
+	 * Under EDF a task that holds a mutex runs with the earliest deadline of
+	 * the tasks blocked on the mutexes it holds, rather than inheriting their
+	 * priority.  Called by xTaskPriorityInherit() and xTaskPriorityDisinherit().
+	 */
+	static BaseType_t prvEDFInheritDeadline( TCB_t * const pxMutexHolderTCB ) PRIVILEGED_FUNCTION;
+	static BaseType_t prvEDFDisinheritDeadline( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Set the deadline of the task represented by pxTCB, which must not be in
+	 * the ready heap, to its inherited deadline if it has one that is earlier
+	 * than its own.
+	 */
+	static void prvEDFApplyInheritedDeadline( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * The deadline of the task represented by pxTCB, ignoring any deadline it
+	 * has inherited.
+	 */
+	static TickType_t prvEDFOwnDeadline( const TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_MUTEXES == 1 ) */
+
+#if ( configUSE_EDF_HYBRID_SCHEDULING == 1 )
+
+	/*
+	 * Returns the highest priority of the ready tasks of the fixed priority
+	 * band, or configEDF_MAX_PRIORITY if none of them is ready.
+	 */
+	static UBaseType_t prvEDFGetTopFixedPriority( void ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Returns pdTRUE if a ready task other than the running task should run in
+	 * its place, either a task of the fixed priority band of higher priority or,
+	 * if the running task is in the EDF band, a task with an earlier deadline.
+	 */
+	static BaseType_t prvEDFSwitchRequired( void ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * As the macro used without hybrid scheduling, but also clears the ready
+	 * priority of a ready list of the fixed priority band left empty, so
+	 * taskSELECT_HIGHEST_PRIORITY_TASK() finds the band as it would without
+	 * EDF.
+	 */
+	static UBaseType_t prvRemoveTaskFromStateList( TCB_t *pxTCB ) PRIVILEGED_FUNCTION;
+
+	#if ( configUSE_MUTEXES == 1 )
+
+		/*
+		 * A task of the fixed priority band blocked on a mutex raises the
+		 * holder to its priority, as without EDF, so a holder from the EDF band
+		 * runs ahead of every task with a deadline until it gives the mutex
+		 * back.  Called by xTaskPriorityInherit() and xTaskPriorityDisinherit().
+		 */
+		static BaseType_t prvEDFInheritPriority( TCB_t * const pxMutexHolderTCB ) PRIVILEGED_FUNCTION;
+		static BaseType_t prvEDFDisinheritPriority( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+	#endif /* configUSE_MUTEXES */
+
+#endif /* configUSE_EDF_HYBRID_SCHEDULING */
+
+#if ( configUSE_EDF_MODE_CHANGE == 1 )
+
+	/*
+	 * Called between jobs of the task represented by pxTCB.  Moves the task to
+	 * its new timing if it has a change pending and the change does not have to
+	 * wait for the changes that lower demand to be applied first.
+	 */
+	static void prvEDFApplyTimingChange( TCB_t *pxTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Records a change that cannot raise the demand of the task represented by
+	 * pxTCB, which is applied when the current job of the task completes.  The
+	 * changes that can raise demand wait for it until then, or until the
+	 * deadline of the job has passed if the job does not complete by then.
+	 */
+	static void prvEDFWaitForDemandDecrease( const TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Returns pdTRUE if the changes that can raise demand must still wait for
+	 * a change that cannot.
+	 */
+	static BaseType_t prvEDFDemandDecreasesPending( void ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Discards the pending change of timing, if any, of a task that is being
+	 * deleted.
+	 */
+	static void prvEDFCancelTimingChange( TCB_t *pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_EDF_MODE_CHANGE */
+
 /*
  * freertos_tasks_c_additions_init() should only be called if the user definable
  * macro FREERTOS_TASKS_C_ADDITIONS_INIT() is defined, as that is the only macro
@@ -750,15 +1487,155 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) PRIVILEGED_FUNCTION;
 #endif /* portUSING_MPU_WRAPPERS */
 /*-----------------------------------------------------------*/
 
-#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
-/*EDF*/
-#if ( configUSE_EDF_SCHEDULER == 1 )
-BaseType_t  xTaskPeriodicCreate(	TaskFunction_t pxTaskCode,
+#if( ( portUSING_MPU_WRAPPERS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) )
+
+	BaseType_t xTaskPeriodicCreateRestrictedStatic( const TaskParameters_t * const pxTaskDefinition, TaskHandle_t *pxCreatedTask, const TaskPeriodicParameters_t * const pxPeriodicParameters )
+	{
+	TCB_t *pxNewTCB;
+	BaseType_t xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+
+		configASSERT( pxTaskDefinition->puxStackBuffer != NULL );
+		configASSERT( pxTaskDefinition->pxTaskBuffer != NULL );
+
+		/* As xTaskPeriodicCreateConstrained(). */
+		if( ( pxPeriodicParameters != NULL ) && ( prvEDFTimingIsValid( pxPeriodicParameters ) == pdFALSE ) )
+		{
+			return pdFAIL;
+		}
+
+		#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+		{
+			vTaskSuspendAll();
+
+			if( ( pxPeriodicParameters != NULL ) && ( prvEDFTaskSetIsSchedulable( NULL, pxPeriodicParameters ) == pdFALSE ) )
+			{
+				( void ) xTaskResumeAll();
+				return errTASK_SET_NOT_SCHEDULABLE;
+			}
+		}
+		#endif /* configUSE_EDF_ADMISSION_CONTROL */
+
+		if( ( pxTaskDefinition->puxStackBuffer != NULL ) && ( pxTaskDefinition->pxTaskBuffer != NULL ) )
+		{
+			pxNewTCB = ( TCB_t * ) pxTaskDefinition->pxTaskBuffer;
+
+			/* Store the stack location in the TCB. */
+			pxNewTCB->pxStack = pxTaskDefinition->puxStackBuffer;
+
+			#if( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
+			{
+				/* Tasks can be created statically or dynamically, so note this
+				task was created statically in case the task is later deleted. */
+				pxNewTCB->ucStaticallyAllocated = tskSTATICALLY_ALLOCATED_STACK_AND_TCB;
+			}
+			#endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
+
+			prvInitialiseNewTask(	pxTaskDefinition->pvTaskCode,
+									pxTaskDefinition->pcName,
+									( uint32_t ) pxTaskDefinition->usStackDepth,
+									pxTaskDefinition->pvParameters,
+									pxTaskDefinition->uxPriority,
+									pxCreatedTask, pxNewTCB,
+									pxTaskDefinition->xRegions );
+
+			prvEDFInitialiseNewTaskTiming( pxNewTCB, pxPeriodicParameters );
+			prvAddNewTaskToReadyList( pxNewTCB );
+			xReturn = pdPASS;
+		}
+
+		#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+		{
+			( void ) xTaskResumeAll();
+		}
+		#endif
+
+		return xReturn;
+	}
+
+#endif /* ( portUSING_MPU_WRAPPERS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if( ( portUSING_MPU_WRAPPERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) )
+
+	BaseType_t xTaskPeriodicCreateRestricted( const TaskParameters_t * const pxTaskDefinition, TaskHandle_t *pxCreatedTask, const TaskPeriodicParameters_t * const pxPeriodicParameters )
+	{
+	TCB_t *pxNewTCB;
+	BaseType_t xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+
+		configASSERT( pxTaskDefinition->puxStackBuffer );
+
+		/* As xTaskPeriodicCreateConstrained(). */
+		if( ( pxPeriodicParameters != NULL ) && ( prvEDFTimingIsValid( pxPeriodicParameters ) == pdFALSE ) )
+		{
+			return pdFAIL;
+		}
+
+		#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+		{
+			vTaskSuspendAll();
+
+			if( ( pxPeriodicParameters != NULL ) && ( prvEDFTaskSetIsSchedulable( NULL, pxPeriodicParameters ) == pdFALSE ) )
+			{
+				( void ) xTaskResumeAll();
+				return errTASK_SET_NOT_SCHEDULABLE;
+			}
+		}
+		#endif /* configUSE_EDF_ADMISSION_CONTROL */
+
+		if( pxTaskDefinition->puxStackBuffer != NULL )
+		{
+			pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+
+			if( pxNewTCB != NULL )
+			{
+				/* Store the stack location in the TCB. */
+				pxNewTCB->pxStack = pxTaskDefinition->puxStackBuffer;
+
+				#if( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
+				{
+					/* Tasks can be created statically or dynamically, so note
+					this task had a statically allocated stack in case it is
+					later deleted.  The TCB was allocated dynamically. */
+					pxNewTCB->ucStaticallyAllocated = tskSTATICALLY_ALLOCATED_STACK_ONLY;
+				}
+				#endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
+
+				prvInitialiseNewTask(	pxTaskDefinition->pvTaskCode,
+										pxTaskDefinition->pcName,
+										( uint32_t ) pxTaskDefinition->usStackDepth,
+										pxTaskDefinition->pvParameters,
+										pxTaskDefinition->uxPriority,
+										pxCreatedTask, pxNewTCB,
+										pxTaskDefinition->xRegions );
+
+				prvEDFInitialiseNewTaskTiming( pxNewTCB, pxPeriodicParameters );
+				prvAddNewTaskToReadyList( pxNewTCB );
+				xReturn = pdPASS;
+			}
+		}
+
+		#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+		{
+			( void ) xTaskResumeAll();
+		}
+		#endif
+
+		return xReturn;
+	}
+
+#endif /* ( portUSING_MPU_WRAPPERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+/*EDF*/
+#if ( configUSE_EDF_SCHEDULER == 1 )
+BaseType_t  xTaskPeriodicCreateConstrained(	TaskFunction_t pxTaskCode,
 							const char * const pcName,		/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 							const configSTACK_DEPTH_TYPE usStackDepth,
 							void * const pvParameters,
 							UBaseType_t uxPriority,
-							TaskHandle_t * const pxCreatedTask, TickType_t period )
+							TaskHandle_t * const pxCreatedTask,
+							const TaskPeriodicParameters_t * const pxPeriodicParameters )
 								#else
 	BaseType_t xTaskCreate(	TaskFunction_t pxTaskCode,
 							const char * const pcName,		/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
@@ -770,8 +1647,33 @@ BaseType_t  xTaskPeriodicCreate(	TaskFunction_t pxTaskCode,
 							{
 	TCB_t *pxNewTCB;
 	BaseType_t xReturn;
-								
-		
+
+		#if ( configUSE_EDF_SCHEDULER == 1 )
+		{
+			/* A task created without timing parameters runs in the
+			background, so has no timing to validate or admit. */
+			if( ( pxPeriodicParameters != NULL ) && ( prvEDFTimingIsValid( pxPeriodicParameters ) == pdFALSE ) )
+			{
+				return pdFAIL;
+			}
+
+			#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+			{
+				/* The scheduler remains suspended until the task has been
+				added to the admitted tasks, so no other task can be admitted
+				on the strength of the same test. */
+				vTaskSuspendAll();
+
+				if( ( pxPeriodicParameters != NULL ) && ( prvEDFTaskSetIsSchedulable( NULL, pxPeriodicParameters ) == pdFALSE ) )
+				{
+					( void ) xTaskResumeAll();
+					return errTASK_SET_NOT_SCHEDULABLE;
+				}
+			}
+			#endif /* configUSE_EDF_ADMISSION_CONTROL */
+		}
+		#endif
+
 		/* If the stack grows down then allocate the stack then the TCB so the stack
 		does not grow into the TCB.  Likewise if the stack grows up then allocate
 		the TCB then the stack. */
@@ -827,11 +1729,6 @@ BaseType_t  xTaskPeriodicCreate(	TaskFunction_t pxTaskCode,
 			}
 		}
 		#endif /* portSTACK_GROWTH */
-		#if ( configUSE_EDF_SCHEDULER == 1 )
-		/*EDF*/
-			/*E.C. : initialize the period */
-			 pxNewTCB->xTaskPeriod = period;
-								#endif
 
 		if( pxNewTCB != NULL )
 		{
@@ -842,13 +1739,13 @@ BaseType_t  xTaskPeriodicCreate(	TaskFunction_t pxTaskCode,
 				pxNewTCB->ucStaticallyAllocated = tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB;
 			}
 			#endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
+
+			prvInitialiseNewTask( pxTaskCode, pcName, ( uint32_t ) usStackDepth, pvParameters, uxPriority, pxCreatedTask, pxNewTCB, NULL );
 			#if ( configUSE_EDF_SCHEDULER == 1 )
-			/*E.C. : insert the period value in the generic list iteam before to add the
-      task in RL: */
-			listSET_LIST_ITEM_VALUE(&( ( pxNewTCB )->xStateListItem ),(pxNewTCB)->xTaskPeriod + xTaskGetTickCount());
+			{
+				prvEDFInitialiseNewTaskTiming( pxNewTCB, pxPeriodicParameters );
+			}
 			#endif
-			//prvAddTaskToReadyList( pxNewTCB );
-			prvInitialiseNewTask( pxTaskCode, pcName, ( uint32_t ) usStackDepth, pvParameters, uxPriority, pxCreatedTask, pxNewTCB, NULL );
 			prvAddNewTaskToReadyList( pxNewTCB );
 			xReturn = pdPASS;
 		}
@@ -857,105 +1754,375 @@ BaseType_t  xTaskPeriodicCreate(	TaskFunction_t pxTaskCode,
 			xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
 		}
 
+		#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+		{
+			( void ) xTaskResumeAll();
+		}
+		#endif
+
 		return xReturn;
 	}
 
 #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
 /*-----------------------------------------------------------*/
 
-static void prvInitialiseNewTask( 	TaskFunction_t pxTaskCode,
+#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) )
+
+	BaseType_t xTaskPeriodicCreate(	TaskFunction_t pxTaskCode,
 									const char * const pcName,		/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-									const uint32_t ulStackDepth,
+									const configSTACK_DEPTH_TYPE usStackDepth,
 									void * const pvParameters,
 									UBaseType_t uxPriority,
 									TaskHandle_t * const pxCreatedTask,
-									TCB_t *pxNewTCB,
-									const MemoryRegion_t * const xRegions )
-{
-StackType_t *pxTopOfStack;
-UBaseType_t x;
+									TickType_t period )
+	{
+	TaskPeriodicParameters_t xPeriodicParameters;
 
-	#if( portUSING_MPU_WRAPPERS == 1 )
-		/* Should the task be created in privileged mode? */
-		BaseType_t xRunPrivileged;
-		if( ( uxPriority & portPRIVILEGE_BIT ) != 0U )
-		{
-			xRunPrivileged = pdTRUE;
-		}
-		else
-		{
-			xRunPrivileged = pdFALSE;
-		}
-		uxPriority &= ~portPRIVILEGE_BIT;
-	#endif /* portUSING_MPU_WRAPPERS == 1 */
+		xPeriodicParameters.xPeriod = period;
+		xPeriodicParameters.xRelativeDeadline = period;
+		xPeriodicParameters.xPhase = ( TickType_t ) 0;
+		xPeriodicParameters.xWorstCaseExecutionTime = ( TickType_t ) 0;
+		xPeriodicParameters.xBlockingTime = ( TickType_t ) 0;
 
-	/* Avoid dependency on memset() if it is not required. */
-	#if( tskSET_NEW_STACKS_TO_KNOWN_VALUE == 1 )
+		return xTaskPeriodicCreateConstrained( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pxCreatedTask, &xPeriodicParameters );
+	}
+
+#endif /* ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) )
+
+	BaseType_t xTaskBackgroundCreate(	TaskFunction_t pxTaskCode,
+										const char * const pcName,		/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+										const configSTACK_DEPTH_TYPE usStackDepth,
+										void * const pvParameters,
+										UBaseType_t uxPriority,
+										TaskHandle_t * const pxCreatedTask )
 	{
-		/* Fill the stack with a known value to assist debugging. */
-		( void ) memset( pxNewTCB->pxStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) ulStackDepth * sizeof( StackType_t ) );
+		return xTaskPeriodicCreateConstrained( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pxCreatedTask, NULL );
 	}
-	#endif /* tskSET_NEW_STACKS_TO_KNOWN_VALUE */
 
-	/* Calculate the top of stack address.  This depends on whether the stack
-	grows from high memory to low (as per the 80x86) or vice versa.
-	portSTACK_GROWTH is used to make the result positive or negative as required
-	by the port. */
-	#if( portSTACK_GROWTH < 0 )
+#endif /* ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_EDF_BANDWIDTH_SERVER == 1 ) )
+
+	BaseType_t xTaskServerCreate(	TaskFunction_t pxTaskCode,
+									const char * const pcName,		/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+									const configSTACK_DEPTH_TYPE usStackDepth,
+									void * const pvParameters,
+									UBaseType_t uxPriority,
+									TaskHandle_t * const pxCreatedTask,
+									TickType_t xBudget,
+									TickType_t xPeriod )
 	{
-		pxTopOfStack = &( pxNewTCB->pxStack[ ulStackDepth - ( uint32_t ) 1 ] );
-		pxTopOfStack = ( StackType_t * ) ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack ) & ( ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) ); /*lint !e923 !e9033 !e9078 MISRA exception.  Avoiding casts between pointers and integers is not practical.  Size differences accounted for using portPOINTER_SIZE_TYPE type.  Checked by assert(). */
+	TaskPeriodicParameters_t xPeriodicParameters;
+	TaskHandle_t xCreatedTask;
+	BaseType_t xReturn;
 
-		/* Check the alignment of the calculated top of stack is correct. */
-		configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
+		configASSERT( xBudget > ( TickType_t ) 0 );
 
-		#if( configRECORD_STACK_HIGH_ADDRESS == 1 )
+		/* The server takes no more than its budget in any of its periods, so
+		it is admitted as a task whose execution time is the budget. */
+		xPeriodicParameters.xPeriod = xPeriod;
+		xPeriodicParameters.xRelativeDeadline = xPeriod;
+		xPeriodicParameters.xPhase = ( TickType_t ) 0;
+		xPeriodicParameters.xWorstCaseExecutionTime = xBudget;
+		xPeriodicParameters.xBlockingTime = ( TickType_t ) 0;
+
+		/* The task must not run until it has been made a server. */
+		vTaskSuspendAll();
 		{
-			/* Also record the stack's high address, which may assist
-			debugging. */
-			pxNewTCB->pxEndOfStack = pxTopOfStack;
+			xReturn = xTaskPeriodicCreateConstrained( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, &xCreatedTask, &xPeriodicParameters );
+
+			if( xReturn == pdPASS )
+			{
+				prvEDFInitialiseServer( xCreatedTask );
+
+				if( pxCreatedTask != NULL )
+				{
+					*pxCreatedTask = xCreatedTask;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
-		#endif /* configRECORD_STACK_HIGH_ADDRESS */
+		( void ) xTaskResumeAll();
+
+		return xReturn;
 	}
-	#else /* portSTACK_GROWTH */
-	{
-		pxTopOfStack = pxNewTCB->pxStack;
 
-		/* Check the alignment of the stack buffer is correct. */
-		configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxNewTCB->pxStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
+#endif /* ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_EDF_BANDWIDTH_SERVER == 1 ) */
+/*-----------------------------------------------------------*/
 
-		/* The other extreme of the stack space is required if stack checking is
-		performed. */
-		pxNewTCB->pxEndOfStack = pxNewTCB->pxStack + ( ulStackDepth - ( uint32_t ) 1 );
-	}
-	#endif /* portSTACK_GROWTH */
+#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_EDF_SPORADIC_TASKS == 1 ) )
 
-	/* Store the task name in the TCB. */
-	if( pcName != NULL )
+	BaseType_t xTaskSporadicCreate(	TaskFunction_t pxTaskCode,
+									const char * const pcName,		/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+									const configSTACK_DEPTH_TYPE usStackDepth,
+									void * const pvParameters,
+									UBaseType_t uxPriority,
+									TaskHandle_t * const pxCreatedTask,
+									const TaskPeriodicParameters_t * const pxSporadicParameters )
 	{
-		for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) configMAX_TASK_NAME_LEN; x++ )
+	TaskHandle_t xCreatedTask;
+	BaseType_t xReturn;
+
+		/* A sporadic task releases jobs no more often than a periodic task
+		with a period of its minimum inter-arrival time, so it is created, and
+		admitted, as one. */
+		vTaskSuspendAll();
 		{
-			pxNewTCB->pcTaskName[ x ] = pcName[ x ];
+			xReturn = xTaskPeriodicCreateConstrained( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, &xCreatedTask, pxSporadicParameters );
 
-			/* Don't copy all configMAX_TASK_NAME_LEN if the string is shorter than
-			configMAX_TASK_NAME_LEN characters just in case the memory after the
-			string is not accessible (extremely unlikely). */
-			if( pcName[ x ] == ( char ) 0x00 )
+			if( xReturn == pdPASS )
 			{
-				break;
+				xCreatedTask->ucSporadic = pdTRUE;
+
+				if( pxCreatedTask != NULL )
+				{
+					*pxCreatedTask = xCreatedTask;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
 		}
+		( void ) xTaskResumeAll();
 
-		/* Ensure the name string is terminated in the case that the string length
-		was greater or equal to configMAX_TASK_NAME_LEN. */
-		pxNewTCB->pcTaskName[ configMAX_TASK_NAME_LEN - 1 ] = '\0';
+		return xReturn;
 	}
-	else
-	{
+
+#endif /* ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_EDF_SPORADIC_TASKS == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) )
+
+	TaskHandle_t xTaskPeriodicCreateStatic(	TaskFunction_t pxTaskCode,
+											const char * const pcName,		/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+											const uint32_t ulStackDepth,
+											void * const pvParameters,
+											UBaseType_t uxPriority,
+											StackType_t * const puxStackBuffer,
+											StaticTask_t * const pxTaskBuffer,
+											const TaskPeriodicParameters_t * const pxPeriodicParameters )
+	{
+	TCB_t *pxNewTCB;
+	TaskHandle_t xReturn;
+
+		configASSERT( puxStackBuffer != NULL );
+		configASSERT( pxTaskBuffer != NULL );
+
+		#if( configASSERT_DEFINED == 1 )
+		{
+			/* Sanity check that the size of the structure used to declare a
+			variable of type StaticTask_t equals the size of the real task
+			structure. */
+			volatile size_t xSize = sizeof( StaticTask_t );
+			configASSERT( xSize == sizeof( TCB_t ) );
+			( void ) xSize; /* Prevent lint warning when configASSERT() is not used. */
+		}
+		#endif /* configASSERT_DEFINED */
+
+		#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+		{
+			/* As xTaskPeriodicCreateConstrained(). */
+			vTaskSuspendAll();
+		}
+		#endif
+
+		/* A task created without timing parameters runs in the background, so
+		has no timing to validate or admit. */
+		if( ( pxTaskBuffer != NULL ) && ( puxStackBuffer != NULL ) &&
+			( ( pxPeriodicParameters == NULL ) || ( prvEDFTimingIsValid( pxPeriodicParameters ) != pdFALSE ) )
+			#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+				&& ( ( pxPeriodicParameters == NULL ) || ( prvEDFTaskSetIsSchedulable( NULL, pxPeriodicParameters ) != pdFALSE ) )
+			#endif
+			)
+		{
+			/* The memory used for the task's TCB and stack are passed into this
+			function - use them. */
+			pxNewTCB = ( TCB_t * ) pxTaskBuffer; /*lint !e740 !e9087 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
+			pxNewTCB->pxStack = ( StackType_t * ) puxStackBuffer;
+
+			#if( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 !e9029 Macro has been consolidated for readability reasons. */
+			{
+				/* Tasks can be created statically or dynamically, so note this
+				task was created statically in case the task is later deleted. */
+				pxNewTCB->ucStaticallyAllocated = tskSTATICALLY_ALLOCATED_STACK_AND_TCB;
+			}
+			#endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
+
+			prvInitialiseNewTask( pxTaskCode, pcName, ulStackDepth, pvParameters, uxPriority, &xReturn, pxNewTCB, NULL );
+			prvEDFInitialiseNewTaskTiming( pxNewTCB, pxPeriodicParameters );
+			prvAddNewTaskToReadyList( pxNewTCB );
+		}
+		else
+		{
+			xReturn = NULL;
+		}
+
+		#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+		{
+			( void ) xTaskResumeAll();
+		}
+		#endif
+
+		return xReturn;
+	}
+
+#endif /* ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_EDF_BANDWIDTH_SERVER == 1 ) )
+
+	TaskHandle_t xTaskServerCreateStatic(	TaskFunction_t pxTaskCode,
+											const char * const pcName,		/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+											const uint32_t ulStackDepth,
+											void * const pvParameters,
+											UBaseType_t uxPriority,
+											StackType_t * const puxStackBuffer,
+											StaticTask_t * const pxTaskBuffer,
+											TickType_t xBudget,
+											TickType_t xPeriod )
+	{
+	TaskPeriodicParameters_t xPeriodicParameters;
+	TaskHandle_t xReturn;
+
+		configASSERT( xBudget > ( TickType_t ) 0 );
+
+		/* As xTaskServerCreate(). */
+		xPeriodicParameters.xPeriod = xPeriod;
+		xPeriodicParameters.xRelativeDeadline = xPeriod;
+		xPeriodicParameters.xPhase = ( TickType_t ) 0;
+		xPeriodicParameters.xWorstCaseExecutionTime = xBudget;
+		xPeriodicParameters.xBlockingTime = ( TickType_t ) 0;
+
+		vTaskSuspendAll();
+		{
+			xReturn = xTaskPeriodicCreateStatic( pxTaskCode, pcName, ulStackDepth, pvParameters, uxPriority, puxStackBuffer, pxTaskBuffer, &xPeriodicParameters );
+
+			if( xReturn != NULL )
+			{
+				prvEDFInitialiseServer( xReturn );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		( void ) xTaskResumeAll();
+
+		return xReturn;
+	}
+
+#endif /* ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_EDF_BANDWIDTH_SERVER == 1 ) */
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewTask( 	TaskFunction_t pxTaskCode,
+									const char * const pcName,		/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+									const uint32_t ulStackDepth,
+									void * const pvParameters,
+									UBaseType_t uxPriority,
+									TaskHandle_t * const pxCreatedTask,
+									TCB_t *pxNewTCB,
+									const MemoryRegion_t * const xRegions )
+{
+StackType_t *pxTopOfStack;
+UBaseType_t x;
+
+	#if( portUSING_MPU_WRAPPERS == 1 )
+		/* Should the task be created in privileged mode? */
+		BaseType_t xRunPrivileged;
+		if( ( uxPriority & portPRIVILEGE_BIT ) != 0U )
+		{
+			xRunPrivileged = pdTRUE;
+		}
+		else
+		{
+			xRunPrivileged = pdFALSE;
+		}
+		uxPriority &= ~portPRIVILEGE_BIT;
+	#endif /* portUSING_MPU_WRAPPERS == 1 */
+
+	/* Avoid dependency on memset() if it is not required. */
+	#if( tskSET_NEW_STACKS_TO_KNOWN_VALUE == 1 )
+	{
+		/* Fill the stack with a known value to assist debugging. */
+		( void ) memset( pxNewTCB->pxStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) ulStackDepth * sizeof( StackType_t ) );
+	}
+	#endif /* tskSET_NEW_STACKS_TO_KNOWN_VALUE */
+
+	/* Calculate the top of stack address.  This depends on whether the stack
+	grows from high memory to low (as per the 80x86) or vice versa.
+	portSTACK_GROWTH is used to make the result positive or negative as required
+	by the port. */
+	#if( portSTACK_GROWTH < 0 )
+	{
+		pxTopOfStack = &( pxNewTCB->pxStack[ ulStackDepth - ( uint32_t ) 1 ] );
+		pxTopOfStack = ( StackType_t * ) ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack ) & ( ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) ); /*lint !e923 !e9033 !e9078 MISRA exception.  Avoiding casts between pointers and integers is not practical.  Size differences accounted for using portPOINTER_SIZE_TYPE type.  Checked by assert(). */
+
+		/* Check the alignment of the calculated top of stack is correct. */
+		configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
+
+		#if( configRECORD_STACK_HIGH_ADDRESS == 1 )
+		{
+			/* Also record the stack's high address, which may assist
+			debugging. */
+			pxNewTCB->pxEndOfStack = pxTopOfStack;
+		}
+		#endif /* configRECORD_STACK_HIGH_ADDRESS */
+	}
+	#else /* portSTACK_GROWTH */
+	{
+		pxTopOfStack = pxNewTCB->pxStack;
+
+		/* Check the alignment of the stack buffer is correct. */
+		configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxNewTCB->pxStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
+
+		/* The other extreme of the stack space is required if stack checking is
+		performed. */
+		pxNewTCB->pxEndOfStack = pxNewTCB->pxStack + ( ulStackDepth - ( uint32_t ) 1 );
+	}
+	#endif /* portSTACK_GROWTH */
+
+	/* Store the task name in the TCB. */
+	if( pcName != NULL )
+	{
+		for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) configMAX_TASK_NAME_LEN; x++ )
+		{
+			pxNewTCB->pcTaskName[ x ] = pcName[ x ];
+
+			/* Don't copy all configMAX_TASK_NAME_LEN if the string is shorter than
+			configMAX_TASK_NAME_LEN characters just in case the memory after the
+			string is not accessible (extremely unlikely). */
+			if( pcName[ x ] == ( char ) 0x00 )
+			{
+				break;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		/* Ensure the name string is terminated in the case that the string length
+		was greater or equal to configMAX_TASK_NAME_LEN. */
+		pxNewTCB->pcTaskName[ configMAX_TASK_NAME_LEN - 1 ] = '\0';
+	}
+	else
+	{
 		/* The task has not been given a name, so just ensure there is a NULL
 		terminator when it is read out. */
 		pxNewTCB->pcTaskName[ 0 ] = 0x00;
@@ -980,6 +2147,82 @@ UBaseType_t x;
 	}
 	#endif /* configUSE_MUTEXES */
 
+	#if ( configUSE_EDF_SCHEDULER == 1 )
+	{
+		/* A task that is not created with timing parameters has no
+		deadline, so runs in the background, where tasks are ordered first in
+		first out and the value of the state list item is never compared as a
+		deadline.  prvEDFInitialiseNewTaskTiming() moves a task that is given
+		timing parameters into the ready heap. */
+		pxNewTCB->xTaskPeriod = ( TickType_t ) 0;
+		pxNewTCB->xTaskRelativeDeadline = ( TickType_t ) 0;
+		pxNewTCB->xTaskPhase = ( TickType_t ) 0;
+		pxNewTCB->xTaskWCET = ( TickType_t ) 0;
+		pxNewTCB->xTaskBlockingTime = ( TickType_t ) 0;
+		pxNewTCB->xTaskReleaseTime = xTickCount;
+		pxNewTCB->ucReleasePending = pdFALSE;
+		pxNewTCB->xReleaseJitter.ulReleases = 0UL;
+		pxNewTCB->xReleaseJitter.xLastJitter = ( TickType_t ) 0;
+		pxNewTCB->xReleaseJitter.xMaxJitter = ( TickType_t ) 0;
+		pxNewTCB->xReleaseJitter.ulTotalJitter = 0UL;
+		pxNewTCB->ucBackground = pdTRUE;
+		pxNewTCB->ucEventListOrdered = pdFALSE;
+		listSET_LIST_ITEM_VALUE( &( pxNewTCB->xStateListItem ), xTickCount );
+
+		#if ( configUSE_EDF_OVERRUN_HANDLING == 1 )
+		{
+			pxNewTCB->xOverrunStatus.ulDeadlineMisses = 0UL;
+			pxNewTCB->xOverrunStatus.ulBudgetOverruns = 0UL;
+			pxNewTCB->ulJobStartRunTime = 0UL;
+			pxNewTCB->ucOverrunPolicy = ( uint8_t ) configEDF_DEFAULT_OVERRUN_POLICY;
+			pxNewTCB->ucJobOverruns = ( uint8_t ) 0U;
+		}
+		#endif
+
+		#if ( configUSE_EDF_BANDWIDTH_SERVER == 1 )
+		{
+			pxNewTCB->xServerBudget = ( TickType_t ) 0;
+			pxNewTCB->xServerDeadline = ( TickType_t ) 0;
+			pxNewTCB->ucServer = pdFALSE;
+		}
+		#endif
+
+		#if ( configUSE_EDF_SPORADIC_TASKS == 1 )
+		{
+			pxNewTCB->ucSporadic = pdFALSE;
+		}
+		#endif
+
+		#if ( configUSE_EDF_MODE_CHANGE == 1 )
+		{
+			pxNewTCB->ucTimingChange = ( uint8_t ) 0U;
+		}
+		#endif
+
+		#if ( configUSE_MUTEXES == 1 )
+		{
+			pxNewTCB->xInheritedDeadline = ( TickType_t ) 0;
+			pxNewTCB->ucDeadlineInherited = ( uint8_t ) 0U;
+		}
+		#endif
+
+		#if ( configUSE_EDF_TASK_STATISTICS == 1 )
+		{
+			( void ) memset( ( void * ) &( pxNewTCB->xJobStatistics ), 0x00, sizeof( TaskJobStatistics_t ) );
+			pxNewTCB->ulJobReleaseRunTime = 0UL;
+		}
+		#endif
+
+		#if ( configUSE_EDF_UTILISATION_MONITOR == 1 )
+		{
+			/* The task starts in the current window. */
+			( void ) memset( ( void * ) &( pxNewTCB->xUtilisation ), 0x00, sizeof( EDFUtilisation_t ) );
+			pxNewTCB->xUtilisation.ulWindow = ulEDFUtilisationWindow;
+		}
+		#endif
+	}
+	#endif /* configUSE_EDF_SCHEDULER */
+
 	vListInitialiseItem( &( pxNewTCB->xStateListItem ) );
 	vListInitialiseItem( &( pxNewTCB->xEventListItem ) );
 
@@ -1173,7 +2416,36 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 		#endif /* configUSE_TRACE_FACILITY */
 		traceTASK_CREATE( pxNewTCB );
 
-		prvAddTaskToReadyList( pxNewTCB );
+		#if ( configUSE_EDF_SCHEDULER == 1 )
+		{
+			if( pxNewTCB->xTaskPhase != ( TickType_t ) 0 )
+			{
+				/* The first job is not released until xTaskPhase ticks from
+				now, so the task waits in the Blocked state until then, and
+				is released by the tick as any other job. */
+				prvEDFAddTaskToDelayedList( pxNewTCB, xTickCount + pxNewTCB->xTaskPhase );
+			}
+			else
+			{
+				/* The first job of a periodic task is released along with
+				the task. */
+				if( pxNewTCB->xTaskPeriod != ( TickType_t ) 0 )
+				{
+					traceTASK_JOB_RELEASE( pxNewTCB );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				prvAddTaskToReadyList( pxNewTCB );
+			}
+		}
+		#else
+		{
+			prvAddTaskToReadyList( pxNewTCB );
+		}
+		#endif /* configUSE_EDF_SCHEDULER */
 
 		portSETUP_TCB( pxNewTCB );
 	}
@@ -1183,7 +2455,7 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 	{
 		/* If the created task is of a higher priority than the current task
 		then it should run now. */
-		if( pxCurrentTCB->uxPriority < pxNewTCB->uxPriority )
+		if( prvTaskPreempts( pxNewTCB ) != pdFALSE )
 		{
 			taskYIELD_IF_USING_PREEMPTION();
 		}
@@ -1199,46 +2471,2218 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 }
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskDelete == 1 )
+#if ( configUSE_EDF_SCHEDULER == 1 )
 
-	void vTaskDelete( TaskHandle_t xTaskToDelete )
+	static void prvEDFReadyHeapInsert( TCB_t *pxTCB )
 	{
-	TCB_t *pxTCB;
+	TCB_t *pxParent;
+	UBaseType_t uxPosition;
 
-		taskENTER_CRITICAL();
+		pxTCB->pxEDFHeapLeft = NULL;
+		pxTCB->pxEDFHeapRight = NULL;
+		pxTCB->ulEDFReadySequence = ulEDFReadySequence;
+		ulEDFReadySequence++;
+
+		/* The heap is kept as a complete binary tree, so the task is first
+		added at the next free position of the lowest level of the tree. */
+		( xReadyTasksListEDF.uxNumberOfItems )++;
+		uxPosition = xReadyTasksListEDF.uxNumberOfItems;
+
+		if( uxPosition == ( UBaseType_t ) 1 )
 		{
-			/* If null is passed in here then it is the calling task that is
-			being deleted. */
-			pxTCB = prvGetTCBFromHandle( xTaskToDelete );
+			pxTCB->pxEDFHeapParent = NULL;
+			pxEDFReadyHeapRoot = pxTCB;
+		}
+		else
+		{
+			pxParent = prvEDFReadyHeapGetTask( uxPosition >> 1 );
+			pxTCB->pxEDFHeapParent = pxParent;
 
-			/* Remove task from the ready/delayed list. */
-			if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+			if( ( uxPosition & ( UBaseType_t ) 1 ) == ( UBaseType_t ) 0 )
 			{
-				taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+				pxParent->pxEDFHeapLeft = pxTCB;
 			}
 			else
 			{
-				mtCOVERAGE_TEST_MARKER();
+				pxParent->pxEDFHeapRight = pxTCB;
 			}
 
-			/* Is the task waiting on an event also? */
-			if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
-			{
-				( void ) uxListRemove( &( pxTCB->xEventListItem ) );
-			}
-			else
+			/* Then moved up until its parent does not have a later deadline.
+			The task was added after every task already in the heap, so it
+			stays below those with the same deadline wherever they are in the
+			heap, and tasks with equal deadlines run in the order they became
+			ready. */
+			while( ( pxTCB->pxEDFHeapParent != NULL ) && ( prvEDFReadyHeapIsBefore( pxTCB, pxTCB->pxEDFHeapParent ) != pdFALSE ) )
 			{
-				mtCOVERAGE_TEST_MARKER();
+				prvEDFReadyHeapSwapWithParent( pxTCB );
 			}
+		}
 
-			/* Increment the uxTaskNumber also so kernel aware debuggers can
-			detect that the task lists need re-generating.  This is done before
-			portPRE_TASK_DELETE_HOOK() as in the Windows port that macro will
-			not return. */
-			uxTaskNumber++;
+		/* Mark the task as being in the Ready state. */
+		pxTCB->xStateListItem.pxContainer = &xReadyTasksListEDF;
+	}
+	/*-----------------------------------------------------------*/
 
-			if( pxTCB == pxCurrentTCB )
-			{
+	static UBaseType_t prvEDFReadyHeapRemove( TCB_t *pxTCB )
+	{
+	TCB_t *pxLast, *pxChild;
+	UBaseType_t uxPosition;
+
+		/* Detach the task at the last position of the heap. */
+		uxPosition = xReadyTasksListEDF.uxNumberOfItems;
+		pxLast = prvEDFReadyHeapGetTask( uxPosition );
+
+		if( pxLast->pxEDFHeapParent == NULL )
+		{
+			pxEDFReadyHeapRoot = NULL;
+		}
+		else if( ( uxPosition & ( UBaseType_t ) 1 ) == ( UBaseType_t ) 0 )
+		{
+			pxLast->pxEDFHeapParent->pxEDFHeapLeft = NULL;
+		}
+		else
+		{
+			pxLast->pxEDFHeapParent->pxEDFHeapRight = NULL;
+		}
+
+		( xReadyTasksListEDF.uxNumberOfItems )--;
+
+		if( pxLast != pxTCB )
+		{
+			/* The task being removed is not the last, so the last task takes
+			its position. */
+			pxLast->pxEDFHeapParent = pxTCB->pxEDFHeapParent;
+			pxLast->pxEDFHeapLeft = pxTCB->pxEDFHeapLeft;
+			pxLast->pxEDFHeapRight = pxTCB->pxEDFHeapRight;
+
+			if( pxLast->pxEDFHeapLeft != NULL )
+			{
+				pxLast->pxEDFHeapLeft->pxEDFHeapParent = pxLast;
+			}
+
+			if( pxLast->pxEDFHeapRight != NULL )
+			{
+				pxLast->pxEDFHeapRight->pxEDFHeapParent = pxLast;
+			}
+
+			if( pxLast->pxEDFHeapParent == NULL )
+			{
+				pxEDFReadyHeapRoot = pxLast;
+			}
+			else if( pxLast->pxEDFHeapParent->pxEDFHeapLeft == pxTCB )
+			{
+				pxLast->pxEDFHeapParent->pxEDFHeapLeft = pxLast;
+			}
+			else
+			{
+				pxLast->pxEDFHeapParent->pxEDFHeapRight = pxLast;
+			}
+
+			/* Restore the heap order, which the moved task can break in
+			either direction. */
+			if( ( pxLast->pxEDFHeapParent != NULL ) && ( prvEDFReadyHeapIsBefore( pxLast, pxLast->pxEDFHeapParent ) != pdFALSE ) )
+			{
+				do
+				{
+					prvEDFReadyHeapSwapWithParent( pxLast );
+				} while( ( pxLast->pxEDFHeapParent != NULL ) && ( prvEDFReadyHeapIsBefore( pxLast, pxLast->pxEDFHeapParent ) != pdFALSE ) );
+			}
+			else
+			{
+				for( ;; )
+				{
+					pxChild = pxLast->pxEDFHeapLeft;
+
+					if( ( pxLast->pxEDFHeapRight != NULL ) && ( prvEDFReadyHeapIsBefore( pxLast->pxEDFHeapRight, pxChild ) != pdFALSE ) )
+					{
+						pxChild = pxLast->pxEDFHeapRight;
+					}
+
+					if( ( pxChild != NULL ) && ( prvEDFReadyHeapIsBefore( pxChild, pxLast ) != pdFALSE ) )
+					{
+						prvEDFReadyHeapSwapWithParent( pxChild );
+					}
+					else
+					{
+						break;
+					}
+				}
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		pxTCB->xStateListItem.pxContainer = NULL;
+
+		return xReadyTasksListEDF.uxNumberOfItems;
+	}
+	/*-----------------------------------------------------------*/
+
+	static TCB_t *prvEDFReadyHeapGetTask( UBaseType_t uxPosition )
+	{
+	TCB_t *pxTCB = pxEDFReadyHeapRoot;
+	UBaseType_t uxBit = ( UBaseType_t ) 1;
+
+		/* Below the most significant set bit, the bits of the position give the
+		path from the root to the task, 0 for left and 1 for right. */
+		while( uxBit <= ( uxPosition >> 1 ) )
+		{
+			uxBit <<= 1;
+		}
+
+		for( uxBit >>= 1; uxBit != ( UBaseType_t ) 0; uxBit >>= 1 )
+		{
+			if( ( uxPosition & uxBit ) == ( UBaseType_t ) 0 )
+			{
+				pxTCB = pxTCB->pxEDFHeapLeft;
+			}
+			else
+			{
+				pxTCB = pxTCB->pxEDFHeapRight;
+			}
+		}
+
+		return pxTCB;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvEDFReadyHeapSwapWithParent( TCB_t *pxTCB )
+	{
+	TCB_t * const pxParent = pxTCB->pxEDFHeapParent;
+	TCB_t * const pxGrandParent = pxParent->pxEDFHeapParent;
+	TCB_t * const pxLeft = pxTCB->pxEDFHeapLeft;
+	TCB_t * const pxRight = pxTCB->pxEDFHeapRight;
+
+		/* The parent becomes a child of the task, and the task adopts the
+		other child of the parent. */
+		if( pxParent->pxEDFHeapLeft == pxTCB )
+		{
+			pxTCB->pxEDFHeapLeft = pxParent;
+			pxTCB->pxEDFHeapRight = pxParent->pxEDFHeapRight;
+
+			if( pxTCB->pxEDFHeapRight != NULL )
+			{
+				pxTCB->pxEDFHeapRight->pxEDFHeapParent = pxTCB;
+			}
+		}
+		else
+		{
+			pxTCB->pxEDFHeapRight = pxParent;
+			pxTCB->pxEDFHeapLeft = pxParent->pxEDFHeapLeft;
+			pxTCB->pxEDFHeapLeft->pxEDFHeapParent = pxTCB;
+		}
+
+		/* The parent adopts the children of the task. */
+		pxParent->pxEDFHeapLeft = pxLeft;
+		pxParent->pxEDFHeapRight = pxRight;
+
+		if( pxLeft != NULL )
+		{
+			pxLeft->pxEDFHeapParent = pxParent;
+		}
+
+		if( pxRight != NULL )
+		{
+			pxRight->pxEDFHeapParent = pxParent;
+		}
+
+		pxParent->pxEDFHeapParent = pxTCB;
+		pxTCB->pxEDFHeapParent = pxGrandParent;
+
+		/* The task takes the place of the parent below the grandparent. */
+		if( pxGrandParent == NULL )
+		{
+			pxEDFReadyHeapRoot = pxTCB;
+		}
+		else if( pxGrandParent->pxEDFHeapLeft == pxParent )
+		{
+			pxGrandParent->pxEDFHeapLeft = pxTCB;
+		}
+		else
+		{
+			pxGrandParent->pxEDFHeapRight = pxTCB;
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static BaseType_t prvEDFTimingIsValid( const TaskPeriodicParameters_t * const pxPeriodicParameters )
+	{
+	BaseType_t xReturn;
+	TickType_t xRelativeDeadline = pxPeriodicParameters->xRelativeDeadline;
+
+		if( xRelativeDeadline == ( TickType_t ) 0 )
+		{
+			xRelativeDeadline = pxPeriodicParameters->xPeriod;
+		}
+
+		/* A deadline longer than the period would allow the jobs of a task to
+		overlap, which a task cannot do, as it runs one job at a time.  A job
+		that needs longer than its deadline, including the time it can be
+		blocked, can never meet it. */
+		if( ( pxPeriodicParameters->xPeriod == ( TickType_t ) 0 ) ||
+			( xRelativeDeadline > pxPeriodicParameters->xPeriod ) ||
+			( pxPeriodicParameters->xWorstCaseExecutionTime > xRelativeDeadline ) ||
+			( pxPeriodicParameters->xBlockingTime > ( xRelativeDeadline - pxPeriodicParameters->xWorstCaseExecutionTime ) ) )
+		{
+			xReturn = pdFALSE;
+		}
+		else
+		{
+			xReturn = pdTRUE;
+		}
+
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvEDFInitialiseNewTaskTiming( TCB_t *pxNewTCB, const TaskPeriodicParameters_t * const pxPeriodicParameters )
+	{
+		if( pxPeriodicParameters == NULL )
+		{
+			/* A background task has no jobs, so keeps the timing given to it
+			by prvInitialiseNewTask(). */
+			return;
+		}
+
+		pxNewTCB->ucBackground = pdFALSE;
+
+		#if ( configUSE_EDF_HYBRID_SCHEDULING == 1 )
+		{
+			/* A task with timing parameters is scheduled by its deadlines, so
+			must be created in the EDF band. */
+			configASSERT( pxNewTCB->uxPriority <= ( UBaseType_t ) configEDF_MAX_PRIORITY );
+		}
+		#endif
+
+		pxNewTCB->xTaskPeriod = pxPeriodicParameters->xPeriod;
+		pxNewTCB->xTaskPhase = pxPeriodicParameters->xPhase;
+		pxNewTCB->xTaskWCET = pxPeriodicParameters->xWorstCaseExecutionTime;
+		pxNewTCB->xTaskBlockingTime = pxPeriodicParameters->xBlockingTime;
+
+		if( pxPeriodicParameters->xRelativeDeadline == ( TickType_t ) 0 )
+		{
+			pxNewTCB->xTaskRelativeDeadline = pxPeriodicParameters->xPeriod;
+		}
+		else
+		{
+			pxNewTCB->xTaskRelativeDeadline = pxPeriodicParameters->xRelativeDeadline;
+		}
+
+		/* The first job is released xTaskPhase ticks after the task is
+		created.  If that is now then the job is released along with the task,
+		otherwise the task waits in the Blocked state for the release. */
+		pxNewTCB->xTaskReleaseTime = xTickCount + pxNewTCB->xTaskPhase;
+
+		if( pxNewTCB->xTaskPhase != ( TickType_t ) 0 )
+		{
+			pxNewTCB->ucReleasePending = pdTRUE;
+		}
+		else
+		{
+			prvEDFSetDeadline( pxNewTCB );
+
+			#if ( configUSE_EDF_TASK_STATISTICS == 1 )
+			{
+				/* The first job is released along with the task, so is not
+				counted by prvEDFSetDeadline().  The task has not run yet, so
+				the job starts with a run time of zero. */
+				if( ( pxNewTCB->xTaskPeriod != ( TickType_t ) 0 ) && ( prvEDFIsServer( pxNewTCB ) == pdFALSE ) )
+				{
+					( pxNewTCB->xJobStatistics.ulJobsReleased )++;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif
+		}
+
+		#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+		{
+			/* The task has passed the admission test. */
+			prvEDFAdmitTask( pxNewTCB );
+		}
+		#endif
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvEDFSetDeadline( TCB_t *pxTCB )
+	{
+	TickType_t xJitter;
+	BaseType_t xJobReleased = pdFALSE;
+
+		if( pxTCB->ucReleasePending != pdFALSE )
+		{
+			pxTCB->ucReleasePending = pdFALSE;
+
+			#if ( configUSE_EDF_SPORADIC_TASKS == 1 )
+			{
+				/* The nominal release time of a sporadic task is the earliest
+				time its minimum inter-arrival time allows the next job to be
+				released.  A job that arrives later is released when it
+				arrives, which is now. */
+				if( ( pxTCB->ucSporadic != pdFALSE ) && ( prvEDFTimeIsBefore( xTickCount, pxTCB->xTaskReleaseTime ) == pdFALSE ) )
+				{
+					pxTCB->xTaskReleaseTime = xTickCount;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configUSE_EDF_SPORADIC_TASKS */
+
+			/* A task resumed, or with its delay aborted, before its next
+			release still has the deadline of that release. */
+			if( prvEDFTimeIsBefore( xTickCount, pxTCB->xTaskReleaseTime ) != pdFALSE )
+			{
+				xJitter = ( TickType_t ) 0;
+			}
+			else
+			{
+				xJitter = xTickCount - pxTCB->xTaskReleaseTime;
+			}
+
+			( pxTCB->xReleaseJitter.ulReleases )++;
+			pxTCB->xReleaseJitter.xLastJitter = xJitter;
+			pxTCB->xReleaseJitter.ulTotalJitter += ( uint32_t ) xJitter;
+
+			if( xJitter > pxTCB->xReleaseJitter.xMaxJitter )
+			{
+				pxTCB->xReleaseJitter.xMaxJitter = xJitter;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Only periodic tasks have jobs. */
+			if( ( pxTCB->xTaskPeriod != ( TickType_t ) 0 ) && ( prvEDFIsServer( pxTCB ) == pdFALSE ) )
+			{
+				xJobReleased = pdTRUE;
+
+				#if ( configUSE_EDF_TASK_STATISTICS == 1 )
+				{
+					/* The execution time of the job is measured from its
+					release. */
+					( pxTCB->xJobStatistics.ulJobsReleased )++;
+
+					#if ( configGENERATE_RUN_TIME_STATS == 1 )
+					{
+						pxTCB->ulJobReleaseRunTime = prvEDFGetRunTime( pxTCB );
+					}
+					#endif
+				}
+				#endif /* configUSE_EDF_TASK_STATISTICS */
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			#if ( configUSE_EDF_MODE_CHANGE == 1 )
+			{
+				/* A change of timing takes effect between jobs, so the job
+				being released is the first with the new timing. */
+				prvEDFApplyTimingChange( pxTCB );
+			}
+			#endif
+
+			#if ( configUSE_EDF_OVERRUN_HANDLING == 1 )
+			{
+				/* A job demoted to the background does not take the next job
+				with it.  The task is not in the ready heap here, so its order
+				can be changed. */
+				if( ( pxTCB->ucJobOverruns & tskEDF_JOB_DEMOTED ) != 0U )
+				{
+					pxTCB->ucBackground = pdFALSE;
+
+					#if ( configUSE_MUTEXES == 1 )
+					{
+						/* A task demoted while it held an inherited deadline
+						was only marked to return to the background. */
+						pxTCB->ucDeadlineInherited &= ( uint8_t ) ~tskEDF_INHERITED_BACKGROUND;
+					}
+					#endif
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* The new job has not overrun, but the task has still to be
+				told if it is running the code of an aborted job. */
+				pxTCB->ucJobOverruns &= tskEDF_JOB_ABORTED;
+
+				#if ( configGENERATE_RUN_TIME_STATS == 1 )
+				{
+					pxTCB->ulJobStartRunTime = prvEDFGetRunTime( pxTCB );
+				}
+				#endif
+			}
+			#endif /* configUSE_EDF_OVERRUN_HANDLING */
+		}
+		else if( pxTCB->xTaskPeriod == ( TickType_t ) 0 )
+		{
+			/* A task that is not periodic is released whenever it becomes
+			ready. */
+			pxTCB->xTaskReleaseTime = xTickCount;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* The deadline is relative to the nominal release time rather than
+		the time the job was actually released, so a job that is released late
+		does not move the deadline of the task later. */
+		listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), pxTCB->xTaskReleaseTime + pxTCB->xTaskRelativeDeadline );
+
+		#if ( configUSE_EDF_BANDWIDTH_SERVER == 1 )
+		{
+			if( pxTCB->ucServer != pdFALSE )
+			{
+				prvEDFServerWake( pxTCB );
+				listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), pxTCB->xServerDeadline );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_EDF_BANDWIDTH_SERVER */
+
+		#if ( configUSE_MUTEXES == 1 )
+		{
+			prvEDFApplyInheritedDeadline( pxTCB );
+		}
+		#endif
+
+		if( xJobReleased != pdFALSE )
+		{
+			traceTASK_JOB_RELEASE( pxTCB );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvEDFAddTaskToDelayedList( TCB_t *pxTCB, TickType_t xTimeToWake )
+	{
+		/* The list item will be inserted in wake time order. */
+		listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), xTimeToWake );
+
+		if( xTimeToWake < xTickCount )
+		{
+			/* Wake time has overflowed.  Place this item in the overflow list. */
+			vListInsert( pxOverflowDelayedTaskList, &( pxTCB->xStateListItem ) );
+		}
+		else
+		{
+			/* The wake time has not overflowed, so the current block list is
+			used. */
+			vListInsert( pxDelayedTaskList, &( pxTCB->xStateListItem ) );
+
+			if( xTimeToWake < xNextTaskUnblockTime )
+			{
+				xNextTaskUnblockTime = xTimeToWake;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static BaseType_t prvEDFReleaseNotifiedTask( TCB_t *pxTCB )
+	{
+	BaseType_t xReturn = pdTRUE;
+
+		#if ( configUSE_EDF_SPORADIC_TASKS == 1 )
+		{
+			/* xTaskJobComplete() left the earliest time the next job can be
+			released in xTaskReleaseTime.  A job that arrives before then waits
+			in the Blocked state, and is released by the tick as the job of a
+			periodic task would be, as when the arrival was counted while the
+			previous job ran. */
+			if( ( pxTCB->ucSporadic != pdFALSE ) && ( pxTCB->ucReleasePending != pdFALSE ) &&
+				( prvEDFTimeIsBefore( xTickCount, pxTCB->xTaskReleaseTime ) != pdFALSE ) )
+			{
+				prvEDFAddTaskToDelayedList( pxTCB, pxTCB->xTaskReleaseTime );
+				xReturn = pdFALSE;
+
+				#if ( configUSE_EVENT_DRIVEN_TICK == 1 )
+				{
+					/* The release can be due before the next tick event. */
+					portSET_NEXT_TICK_EVENT();
+				}
+				#endif
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_EDF_SPORADIC_TASKS */
+
+		if( xReturn != pdFALSE )
+		{
+			prvEDFSetDeadline( pxTCB );
+			prvAddTaskToReadyList( pxTCB );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvEDFPlaceOnEventList( List_t * const pxEventList )
+	{
+		/* The running task is in the ready heap, so its state list item holds
+		its deadline.  vListInsert() cannot be used as it does not order the
+		deadlines correctly when the tick count overflows. */
+		listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), listGET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ) ) );
+		pxCurrentTCB->ucEventListOrdered = pdTRUE;
+
+		prvEDFInsertInEventList( pxEventList, pxCurrentTCB );
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvEDFInsertInEventList( List_t * const pxEventList, TCB_t * const pxTCB )
+	{
+	ListItem_t * const pxListEnd = ( ListItem_t * ) &( pxEventList->xListEnd ); /*lint !e826 !e740 !e9087 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+	ListItem_t *pxIterator;
+
+		/* Tasks are run in deadline order, so tasks usually block in deadline
+		order too.  Searching from the back of the list finds the place of the
+		new item straight away when that is so, however many tasks are
+		waiting. */
+		for( pxIterator = pxListEnd->pxPrevious; pxIterator != pxListEnd; pxIterator = pxIterator->pxPrevious )
+		{
+			if( prvEDFWaiterIsBefore( pxTCB, ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxIterator ) ) == pdFALSE )
+			{
+				break;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		vListInsertAfter( pxEventList, pxIterator, &( pxTCB->xEventListItem ) );
+	}
+	/*-----------------------------------------------------------*/
+
+	#if ( ( configUSE_MUTEXES == 1 ) || ( configUSE_EDF_MODE_CHANGE == 1 ) || ( ( configUSE_EDF_HYBRID_SCHEDULING == 1 ) && ( INCLUDE_vTaskPrioritySet == 1 ) ) )
+
+		static void prvEDFReorderWaitingTask( TCB_t * const pxTCB )
+		{
+		List_t * const pxEventList = ( List_t * ) listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) );
+		TickType_t xDeadline;
+
+			/* A task in the pending ready list is already being made ready, and
+			the lists of event groups are not ordered and hold event bits in the
+			item values. */
+			if( ( pxEventList != NULL ) && ( pxEventList != &xPendingReadyList ) && ( pxTCB->ucEventListOrdered != pdFALSE ) )
+			{
+				/* As prvEDFSetDeadline(), but the job of the task is not being
+				released, so its release time is already set. */
+				xDeadline = pxTCB->xTaskReleaseTime + pxTCB->xTaskRelativeDeadline;
+
+				#if ( configUSE_EDF_BANDWIDTH_SERVER == 1 )
+				{
+					if( pxTCB->ucServer != pdFALSE )
+					{
+						xDeadline = pxTCB->xServerDeadline;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif
+
+				#if ( configUSE_MUTEXES == 1 )
+				{
+					if( ( pxTCB->ucDeadlineInherited != 0U ) && ( prvEDFTimeIsBefore( pxTCB->xInheritedDeadline, xDeadline ) != pdFALSE ) )
+					{
+						xDeadline = pxTCB->xInheritedDeadline;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif
+
+				( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+				listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), xDeadline );
+				prvEDFInsertInEventList( pxEventList, pxTCB );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		/*-----------------------------------------------------------*/
+
+	#endif
+
+#endif /* configUSE_EDF_SCHEDULER */
+
+#if ( ( configUSE_EDF_ADMISSION_CONTROL == 1 ) || ( configUSE_EDF_UTILISATION_MONITOR == 1 ) )
+
+	/* The utilisation of a task, rounded up so the sum of the utilisations of a
+	set of tasks is never less than the real utilisation of the set.  Each
+	rounding adds less than one to the sum. */
+	#define prvEDFUtilisation( xWCET, xPeriod ) ( ( uint32_t ) ( ( ( ( uint64_t ) ( xWCET ) * ( uint64_t ) tskEDF_FULL_UTILISATION ) + ( uint64_t ) ( xPeriod ) - 1U ) / ( uint64_t ) ( xPeriod ) ) )
+
+#endif
+
+#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+
+	/* The number of jobs of a task that are due by ullTime when its first job
+	is due at xDeadline. */
+	#define prvEDFJobsDueBy( ullTime, xDeadline, xPeriod ) ( ( ( ullTime ) < ( uint64_t ) ( xDeadline ) ) ? 0U : ( ( ( ( ullTime ) - ( uint64_t ) ( xDeadline ) ) / ( uint64_t ) ( xPeriod ) ) + 1U ) )
+
+	/* The latest deadline of a task that is earlier than ullTime when its first
+	job is due at xDeadline, or 0 if there is none. */
+	#define prvEDFLastDeadlineBefore( ullTime, xDeadline, xPeriod ) ( ( ( ullTime ) > ( uint64_t ) ( xDeadline ) ) ? ( ( ( ( ( ullTime ) - ( uint64_t ) ( xDeadline ) - 1U ) / ( uint64_t ) ( xPeriod ) ) * ( uint64_t ) ( xPeriod ) ) + ( uint64_t ) ( xDeadline ) ) : 0U )
+
+	/* The analysis is abandoned, and the task set treated as unschedulable, if
+	the synchronous busy period grows longer than this. */
+	#define tskEDF_MAX_BUSY_PERIOD ( ( uint64_t ) 0xffffffffUL )
+
+	/* The timing an admitted task is analysed with, which is its new timing
+	while xEDFAnalyseNewTiming is set if it has a change pending or under
+	test. */
+	#if ( configUSE_EDF_MODE_CHANGE == 1 )
+		#define prvEDFUsesNewTiming( pxTCB )	( ( xEDFAnalyseNewTiming != pdFALSE ) && ( ( ( pxTCB )->ucTimingChange & ( tskEDF_TIMING_PENDING | tskEDF_TIMING_TESTING ) ) != 0U ) )
+		#define prvEDFAnalysedPeriod( pxTCB )	( prvEDFUsesNewTiming( pxTCB ) ? ( pxTCB )->xNewTiming.xPeriod : ( pxTCB )->xTaskPeriod )
+		#define prvEDFAnalysedDeadline( pxTCB )	( prvEDFUsesNewTiming( pxTCB ) ? ( pxTCB )->xNewTiming.xRelativeDeadline : ( pxTCB )->xTaskRelativeDeadline )
+		#define prvEDFAnalysedWCET( pxTCB )		( prvEDFUsesNewTiming( pxTCB ) ? ( pxTCB )->xNewTiming.xWorstCaseExecutionTime : ( pxTCB )->xTaskWCET )
+		#define prvEDFAnalysedBlocking( pxTCB )	( prvEDFUsesNewTiming( pxTCB ) ? ( pxTCB )->xNewTiming.xBlockingTime : ( pxTCB )->xTaskBlockingTime )
+	#else
+		#define prvEDFAnalysedPeriod( pxTCB )	( ( pxTCB )->xTaskPeriod )
+		#define prvEDFAnalysedDeadline( pxTCB )	( ( pxTCB )->xTaskRelativeDeadline )
+		#define prvEDFAnalysedWCET( pxTCB )		( ( pxTCB )->xTaskWCET )
+		#define prvEDFAnalysedBlocking( pxTCB )	( ( pxTCB )->xTaskBlockingTime )
+	#endif /* configUSE_EDF_MODE_CHANGE */
+
+	static BaseType_t prvEDFTaskSetIsSchedulable( const TCB_t * const pxReplacedTCB, const TaskPeriodicParameters_t * const pxPeriodicParameters )
+	{
+	BaseType_t xReturn;
+
+		xReturn = prvEDFModeIsSchedulable( pxReplacedTCB, pxPeriodicParameters );
+
+		#if ( configUSE_EDF_MODE_CHANGE == 1 )
+		{
+			/* The tasks with changes pending can move to their new timing in
+			any order, so the task must also fit the task set they lead to. */
+			if( ( xReturn != pdFALSE ) && ( uxEDFTimingChangesPending != ( UBaseType_t ) 0U ) )
+			{
+				xEDFAnalyseNewTiming = pdTRUE;
+				xReturn = prvEDFModeIsSchedulable( pxReplacedTCB, pxPeriodicParameters );
+				xEDFAnalyseNewTiming = pdFALSE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_EDF_MODE_CHANGE */
+
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	static BaseType_t prvEDFModeIsSchedulable( const TCB_t * const pxReplacedTCB, const TaskPeriodicParameters_t * const pxPeriodicParameters )
+	{
+	const TCB_t *pxTCB;
+	TickType_t xRelativeDeadline = pxPeriodicParameters->xRelativeDeadline;
+	uint32_t ulUtilisation;
+	UBaseType_t uxNumberOfTasks = ( UBaseType_t ) 1;
+	BaseType_t xImplicitDeadlines, xReturn;
+	uint64_t ullBusyPeriod, ullTime, ullDemand, ullMinDeadline, ullMaxBlocking;
+
+		if( xRelativeDeadline == ( TickType_t ) 0 )
+		{
+			xRelativeDeadline = pxPeriodicParameters->xPeriod;
+		}
+
+		ulUtilisation = prvEDFUtilisation( pxPeriodicParameters->xWorstCaseExecutionTime, pxPeriodicParameters->xPeriod );
+		xImplicitDeadlines = ( xRelativeDeadline == pxPeriodicParameters->xPeriod ) ? pdTRUE : pdFALSE;
+		ullMinDeadline = ( uint64_t ) xRelativeDeadline;
+		ullBusyPeriod = ( uint64_t ) pxPeriodicParameters->xWorstCaseExecutionTime;
+		ullMaxBlocking = ( uint64_t ) pxPeriodicParameters->xBlockingTime;
+
+		for( pxTCB = pxEDFAdmittedTasks; pxTCB != NULL; pxTCB = pxTCB->pxEDFNextAdmitted )
+		{
+			if( pxTCB != pxReplacedTCB )
+			{
+				uxNumberOfTasks++;
+				ulUtilisation += prvEDFUtilisation( prvEDFAnalysedWCET( pxTCB ), prvEDFAnalysedPeriod( pxTCB ) );
+				ullBusyPeriod += ( uint64_t ) prvEDFAnalysedWCET( pxTCB );
+
+				if( prvEDFAnalysedDeadline( pxTCB ) != prvEDFAnalysedPeriod( pxTCB ) )
+				{
+					xImplicitDeadlines = pdFALSE;
+				}
+
+				if( ( uint64_t ) prvEDFAnalysedBlocking( pxTCB ) > ullMaxBlocking )
+				{
+					ullMaxBlocking = ( uint64_t ) prvEDFAnalysedBlocking( pxTCB );
+				}
+
+				if( ( uint64_t ) prvEDFAnalysedDeadline( pxTCB ) < ullMinDeadline )
+				{
+					ullMinDeadline = ( uint64_t ) prvEDFAnalysedDeadline( pxTCB );
+				}
+			}
+		}
+
+		if( ulUtilisation > ( tskEDF_FULL_UTILISATION + ( uint32_t ) uxNumberOfTasks ) )
+		{
+			/* Even allowing for the rounding the utilisation is over 1, so
+			the processor cannot keep up with the tasks. */
+			xReturn = pdFALSE;
+		}
+		else if( ( xImplicitDeadlines != pdFALSE ) && ( ullMaxBlocking == 0U ) && ( ulUtilisation <= tskEDF_FULL_UTILISATION ) )
+		{
+			/* When every deadline is equal to the period, and no job can be
+			blocked on a mutex, EDF meets every deadline provided the
+			utilisation is no more than 1. */
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			/* Otherwise the demand of the jobs due by each deadline must be
+			no more than the time to that deadline when the first jobs of all
+			the tasks are released together.  This only has to hold for the
+			deadlines within the busy period that starts with that release,
+			the length of which is found by iterating the work released
+			within it until it no longer grows.  A job can also be blocked
+			by a task with a later deadline that holds a mutex the job needs,
+			which prvEDFDemand() adds to the demand. */
+			ullBusyPeriod += ullMaxBlocking;
+
+			do
+			{
+				ullTime = ullBusyPeriod;
+				ullBusyPeriod = ( ullTime == 0U ) ? 0U : prvEDFDemand( pxReplacedTCB, pxPeriodicParameters, ullTime - 1U, pdTRUE );
+			} while( ( ullBusyPeriod != ullTime ) && ( ullBusyPeriod <= tskEDF_MAX_BUSY_PERIOD ) );
+
+			if( ullBusyPeriod > tskEDF_MAX_BUSY_PERIOD )
+			{
+				xReturn = pdFALSE;
+			}
+			else
+			{
+				/* Quick processor demand analysis.  Working back from the end
+				of the busy period, each deadline that is met shows every
+				deadline back to the demand at that deadline is met too, so
+				the deadlines in between need not be checked. */
+				ullTime = prvEDFLatestDeadlineBefore( pxReplacedTCB, pxPeriodicParameters, ullBusyPeriod + 1U );
+				ullDemand = prvEDFDemand( pxReplacedTCB, pxPeriodicParameters, ullTime, pdFALSE );
+
+				while( ( ullDemand <= ullTime ) && ( ullDemand > ullMinDeadline ) )
+				{
+					if( ullDemand < ullTime )
+					{
+						ullTime = ullDemand;
+					}
+					else
+					{
+						ullTime = prvEDFLatestDeadlineBefore( pxReplacedTCB, pxPeriodicParameters, ullTime );
+					}
+
+					ullDemand = prvEDFDemand( pxReplacedTCB, pxPeriodicParameters, ullTime, pdFALSE );
+				}
+
+				xReturn = ( ullDemand <= ullMinDeadline ) ? pdTRUE : pdFALSE;
+			}
+		}
+
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	static uint64_t prvEDFDemand( const TCB_t * const pxReplacedTCB, const TaskPeriodicParameters_t * const pxPeriodicParameters, uint64_t ullTime, BaseType_t xCountReleases )
+	{
+	const TCB_t *pxTCB;
+	TickType_t xRelativeDeadline = pxPeriodicParameters->xRelativeDeadline;
+	uint64_t ullDemand, ullBlocking = 0U;
+
+		/* Counting the jobs released by ullTime is the same as counting the
+		jobs due by ullTime if each job were due when it is released. */
+		if( xCountReleases != pdFALSE )
+		{
+			xRelativeDeadline = ( TickType_t ) 0;
+		}
+		else if( xRelativeDeadline == ( TickType_t ) 0 )
+		{
+			xRelativeDeadline = pxPeriodicParameters->xPeriod;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		ullDemand = prvEDFJobsDueBy( ullTime, xRelativeDeadline, pxPeriodicParameters->xPeriod ) * ( uint64_t ) pxPeriodicParameters->xWorstCaseExecutionTime;
+
+		/* Only a task with a later deadline can block a job, and the tasks
+		with jobs due by ullTime can only be blocked while they are the task
+		with the earliest deadline, so only the longest blocking time of those
+		tasks adds to the demand. */
+		if( ( uint64_t ) xRelativeDeadline <= ullTime )
+		{
+			ullBlocking = ( uint64_t ) pxPeriodicParameters->xBlockingTime;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		for( pxTCB = pxEDFAdmittedTasks; pxTCB != NULL; pxTCB = pxTCB->pxEDFNextAdmitted )
+		{
+			if( pxTCB != pxReplacedTCB )
+			{
+				xRelativeDeadline = ( xCountReleases != pdFALSE ) ? ( TickType_t ) 0 : prvEDFAnalysedDeadline( pxTCB );
+				ullDemand += prvEDFJobsDueBy( ullTime, xRelativeDeadline, prvEDFAnalysedPeriod( pxTCB ) ) * ( uint64_t ) prvEDFAnalysedWCET( pxTCB );
+
+				if( ( ( uint64_t ) xRelativeDeadline <= ullTime ) && ( ( uint64_t ) prvEDFAnalysedBlocking( pxTCB ) > ullBlocking ) )
+				{
+					ullBlocking = ( uint64_t ) prvEDFAnalysedBlocking( pxTCB );
+				}
+			}
+		}
+
+		return ullDemand + ullBlocking;
+	}
+	/*-----------------------------------------------------------*/
+
+	static uint64_t prvEDFLatestDeadlineBefore( const TCB_t * const pxReplacedTCB, const TaskPeriodicParameters_t * const pxPeriodicParameters, uint64_t ullTime )
+	{
+	const TCB_t *pxTCB;
+	TickType_t xRelativeDeadline = pxPeriodicParameters->xRelativeDeadline;
+	uint64_t ullLatest, ullDeadline;
+
+		if( xRelativeDeadline == ( TickType_t ) 0 )
+		{
+			xRelativeDeadline = pxPeriodicParameters->xPeriod;
+		}
+
+		ullLatest = prvEDFLastDeadlineBefore( ullTime, xRelativeDeadline, pxPeriodicParameters->xPeriod );
+
+		for( pxTCB = pxEDFAdmittedTasks; pxTCB != NULL; pxTCB = pxTCB->pxEDFNextAdmitted )
+		{
+			if( pxTCB != pxReplacedTCB )
+			{
+				ullDeadline = prvEDFLastDeadlineBefore( ullTime, prvEDFAnalysedDeadline( pxTCB ), prvEDFAnalysedPeriod( pxTCB ) );
+
+				if( ullDeadline > ullLatest )
+				{
+					ullLatest = ullDeadline;
+				}
+			}
+		}
+
+		return ullLatest;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvEDFAdmitTask( TCB_t *pxTCB )
+	{
+		pxTCB->pxEDFNextAdmitted = pxEDFAdmittedTasks;
+		pxEDFAdmittedTasks = pxTCB;
+		ulEDFUtilisation += prvEDFUtilisation( pxTCB->xTaskWCET, pxTCB->xTaskPeriod );
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvEDFWithdrawTask( TCB_t *pxTCB )
+	{
+	TCB_t **ppxLink;
+
+		for( ppxLink = &pxEDFAdmittedTasks; *ppxLink != NULL; ppxLink = &( ( *ppxLink )->pxEDFNextAdmitted ) )
+		{
+			if( *ppxLink == pxTCB )
+			{
+				*ppxLink = pxTCB->pxEDFNextAdmitted;
+				ulEDFUtilisation -= prvEDFUtilisation( pxTCB->xTaskWCET, pxTCB->xTaskPeriod );
+				break;
+			}
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	uint32_t ulTaskGetEDFUtilisation( void )
+	{
+		return ulEDFUtilisation;
+	}
+	/*-----------------------------------------------------------*/
+
+	uint32_t ulTaskGetEDFSpareUtilisation( void )
+	{
+	uint32_t ulReturn;
+
+		taskENTER_CRITICAL();
+		{
+			if( ulEDFUtilisation < tskEDF_FULL_UTILISATION )
+			{
+				ulReturn = tskEDF_FULL_UTILISATION - ulEDFUtilisation;
+			}
+			else
+			{
+				ulReturn = 0UL;
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		return ulReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+#endif /* configUSE_EDF_ADMISSION_CONTROL */
+
+#if ( configUSE_EDF_OVERRUN_HANDLING == 1 )
+
+	static void prvEDFCheckForOverrun( void )
+	{
+	TCB_t * const pxTCB = pxCurrentTCB;
+
+		/* Only the jobs of periodic tasks have deadlines and budgets.  The
+		running task can already have left the Ready state if the tick was
+		pended while it was blocking, in which case it is checked when it
+		completes its job. */
+		if( ( pxTCB->xTaskPeriod != ( TickType_t ) 0 ) &&
+			( prvEDFIsServer( pxTCB ) == pdFALSE ) &&
+			( pxTCB->ucReleasePending == pdFALSE ) &&
+			( prvEDFTaskIsReady( pxTCB ) != pdFALSE ) )
+		{
+			/* At most one overrun is handled per tick.  If the job has
+			overrun in both ways the other is found on the next tick, unless
+			the policy has moved the task on. */
+			if( ( ( pxTCB->ucJobOverruns & tskEDF_JOB_DEADLINE_MISSED ) == 0U ) &&
+				( prvEDFTimeIsBefore( pxTCB->xTaskReleaseTime + pxTCB->xTaskRelativeDeadline, xTickCount ) != pdFALSE ) )
+			{
+				prvEDFRecordOverrun( pxTCB, eDeadlineMissed );
+				prvEDFApplyOverrunPolicy( pxTCB );
+			}
+			#if ( configGENERATE_RUN_TIME_STATS == 1 )
+			else if( ( ( pxTCB->ucJobOverruns & tskEDF_JOB_BUDGET_EXHAUSTED ) == 0U ) &&
+					 ( prvEDFBudgetIsExhausted( pxTCB ) != pdFALSE ) )
+			{
+				prvEDFRecordOverrun( pxTCB, eBudgetExhausted );
+				prvEDFApplyOverrunPolicy( pxTCB );
+			}
+			#endif /* configGENERATE_RUN_TIME_STATS */
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvEDFRecordOverrun( TCB_t *pxTCB, eOverrunType eType )
+	{
+		if( eType == eDeadlineMissed )
+		{
+			pxTCB->ucJobOverruns |= tskEDF_JOB_DEADLINE_MISSED;
+			( pxTCB->xOverrunStatus.ulDeadlineMisses )++;
+		}
+		else
+		{
+			pxTCB->ucJobOverruns |= tskEDF_JOB_BUDGET_EXHAUSTED;
+			( pxTCB->xOverrunStatus.ulBudgetOverruns )++;
+		}
+
+		traceTASK_JOB_OVERRUN( pxTCB, eType );
+
+		#if ( configUSE_EDF_OVERRUN_HOOK == 1 )
+		{
+			vApplicationOverrunHook( pxTCB, eType );
+		}
+		#endif
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvEDFApplyOverrunPolicy( TCB_t *pxTCB )
+	{
+	TickType_t xNextRelease;
+
+		switch( ( eOverrunPolicy ) pxTCB->ucOverrunPolicy )
+		{
+			case eOverrunAbortJob:
+				#if ( configUSE_EDF_TASK_STATISTICS == 1 )
+				{
+					( pxTCB->xJobStatistics.ulJobsAborted )++;
+
+					if( ( pxTCB->ucJobOverruns & tskEDF_JOB_DEADLINE_MISSED ) != 0U )
+					{
+						( pxTCB->xJobStatistics.ulDeadlinesMissed )++;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configUSE_EDF_TASK_STATISTICS */
+
+				/* The next job is released when it would have been had the
+				job completed now, as by xTaskJobComplete(). */
+				( void ) prvRemoveTaskFromStateList( pxTCB );
+				xNextRelease = pxTCB->xTaskReleaseTime + pxTCB->xTaskPeriod;
+				pxTCB->xTaskReleaseTime = xNextRelease;
+				pxTCB->ucReleasePending = pdTRUE;
+				pxTCB->ucJobOverruns |= tskEDF_JOB_ABORTED;
+
+				if( prvEDFTimeIsBefore( xTickCount, xNextRelease ) != pdFALSE )
+				{
+					prvEDFAddTaskToDelayedList( pxTCB, xNextRelease );
+				}
+				else
+				{
+					prvEDFSetDeadline( pxTCB );
+					prvAddTaskToReadyList( pxTCB );
+				}
+				break;
+
+			case eOverrunDemote:
+				if( pxTCB->ucBackground == pdFALSE )
+				{
+					( void ) prvRemoveTaskFromStateList( pxTCB );
+					pxTCB->ucBackground = pdTRUE;
+					pxTCB->ucJobOverruns |= tskEDF_JOB_DEMOTED;
+
+					#if ( configUSE_MUTEXES == 1 )
+					{
+						/* A task that holds a mutex needed by a task with an
+						earlier deadline stays in the foreground until it gives
+						the mutex back, otherwise the blocking would not be
+						bounded. */
+						if( pxTCB->ucDeadlineInherited != 0U )
+						{
+							pxTCB->ucBackground = pdFALSE;
+							pxTCB->ucDeadlineInherited |= tskEDF_INHERITED_BACKGROUND;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					#endif
+
+					prvAddTaskToReadyList( pxTCB );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+				break;
+
+			case eOverrunSkipNextRelease:
+				/* Acted on by xTaskJobComplete(). */
+				pxTCB->ucJobOverruns |= tskEDF_JOB_SKIP_NEXT_RELEASE;
+				break;
+
+			case eOverrunNotify:
+			default:
+				/* The overrun has already been recorded. */
+				break;
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	#if ( configGENERATE_RUN_TIME_STATS == 1 )
+
+		static BaseType_t prvEDFBudgetIsExhausted( const TCB_t * const pxTCB )
+		{
+		BaseType_t xReturn;
+
+			/* A task without a worst case execution time has no budget. */
+			if( ( pxTCB->xTaskWCET != ( TickType_t ) 0 ) &&
+				( ( prvEDFGetRunTime( pxTCB ) - pxTCB->ulJobStartRunTime ) > ( ( uint32_t ) pxTCB->xTaskWCET * ( uint32_t ) configEDF_RUN_TIME_COUNTS_PER_TICK ) ) )
+			{
+				xReturn = pdTRUE;
+			}
+			else
+			{
+				xReturn = pdFALSE;
+			}
+
+			return xReturn;
+		}
+		/*-----------------------------------------------------------*/
+
+	#endif /* configGENERATE_RUN_TIME_STATS */
+
+	void vTaskSetOverrunPolicy( TaskHandle_t xTask, eOverrunPolicy ePolicy )
+	{
+	TCB_t *pxTCB;
+
+		taskENTER_CRITICAL();
+		{
+			/* If null is passed in here then the policy of the calling task
+			is being set. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+			pxTCB->ucOverrunPolicy = ( uint8_t ) ePolicy;
+		}
+		taskEXIT_CRITICAL();
+	}
+	/*-----------------------------------------------------------*/
+
+	void vTaskGetOverrunStatus( TaskHandle_t xTask, TaskOverrunStatus_t *pxOverrunStatus )
+	{
+	TCB_t *pxTCB;
+
+		configASSERT( pxOverrunStatus );
+
+		taskENTER_CRITICAL();
+		{
+			/* If null is passed in here then the calling task is being
+			queried. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+			*pxOverrunStatus = pxTCB->xOverrunStatus;
+		}
+		taskEXIT_CRITICAL();
+	}
+	/*-----------------------------------------------------------*/
+
+#endif /* configUSE_EDF_OVERRUN_HANDLING */
+
+#if ( ( ( configUSE_EDF_OVERRUN_HANDLING == 1 ) || ( configUSE_EDF_TASK_STATISTICS == 1 ) ) && ( configGENERATE_RUN_TIME_STATS == 1 ) )
+
+	static uint32_t prvEDFGetRunTime( const TCB_t * const pxTCB )
+	{
+	uint32_t ulRunTime = pxTCB->ulRunTimeCounter, ulNow;
+
+		/* The run time counter of the running task is only updated when it
+		is switched out. */
+		if( pxTCB == pxCurrentTCB )
+		{
+			#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+				portALT_GET_RUN_TIME_COUNTER_VALUE( ulNow );
+			#else
+				ulNow = portGET_RUN_TIME_COUNTER_VALUE();
+			#endif
+
+			/* As in vTaskSwitchContext(). */
+			if( ulNow > ulTaskSwitchedInTime )
+			{
+				ulRunTime += ( ulNow - ulTaskSwitchedInTime );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return ulRunTime;
+	}
+	/*-----------------------------------------------------------*/
+
+#endif
+
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+	static void prvEDFRecordJobCompletion( TCB_t *pxTCB, const TickType_t xCompletionTime )
+	{
+	BaseType_t xHasJob;
+
+		/* Only periodic tasks have jobs.  A task waiting for the release of its
+		next job has none to complete, nor does a task still running the code
+		of an aborted job, which was recorded when it was aborted. */
+		xHasJob = ( ( pxTCB->xTaskPeriod != ( TickType_t ) 0 ) && ( prvEDFIsServer( pxTCB ) == pdFALSE ) && ( pxTCB->ucReleasePending == pdFALSE ) ) ? pdTRUE : pdFALSE;
+
+		#if ( configUSE_EDF_OVERRUN_HANDLING == 1 )
+		{
+			if( ( pxTCB->ucJobOverruns & tskEDF_JOB_ABORTED ) != 0U )
+			{
+				xHasJob = pdFALSE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif
+
+		if( xHasJob != pdFALSE )
+		{
+			traceTASK_JOB_COMPLETE( pxTCB );
+
+			#if ( configUSE_EDF_TASK_STATISTICS == 1 )
+			{
+				prvEDFUpdateJobStatistics( pxTCB, xCompletionTime );
+			}
+			#else
+			{
+				( void ) xCompletionTime;
+			}
+			#endif
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+#endif /* configUSE_EDF_SCHEDULER */
+
+#if ( configUSE_EDF_TASK_STATISTICS == 1 )
+
+	static void prvEDFUpdateJobStatistics( TCB_t *pxTCB, const TickType_t xCompletionTime )
+	{
+	TaskJobStatistics_t * const pxStatistics = &( pxTCB->xJobStatistics );
+	const TickType_t xDeadline = pxTCB->xTaskReleaseTime + pxTCB->xTaskRelativeDeadline;
+	TickType_t xResponseTime;
+	int32_t lLateness;
+	uint32_t ulExecutionTime = 0UL;
+
+		/* A task resumed before its release can complete the job before
+		it is due, in which case it responded at once. */
+		if( prvEDFTimeIsBefore( xCompletionTime, pxTCB->xTaskReleaseTime ) != pdFALSE )
+		{
+			xResponseTime = ( TickType_t ) 0;
+		}
+		else
+		{
+			xResponseTime = xCompletionTime - pxTCB->xTaskReleaseTime;
+		}
+
+		if( prvEDFTimeIsBefore( xDeadline, xCompletionTime ) != pdFALSE )
+		{
+			lLateness = ( int32_t ) ( TickType_t ) ( xCompletionTime - xDeadline );
+			( pxStatistics->ulDeadlinesMissed )++;
+		}
+		else
+		{
+			lLateness = -( int32_t ) ( TickType_t ) ( xDeadline - xCompletionTime );
+		}
+
+		#if ( configGENERATE_RUN_TIME_STATS == 1 )
+		{
+			ulExecutionTime = prvEDFGetRunTime( pxTCB ) - pxTCB->ulJobReleaseRunTime;
+		}
+		#endif
+
+		( pxStatistics->ulJobsCompleted )++;
+		pxStatistics->ulTotalResponseTime += ( uint32_t ) xResponseTime;
+		pxStatistics->lTotalLateness += lLateness;
+		pxStatistics->ulTotalExecutionTime += ulExecutionTime;
+
+		if( pxStatistics->ulJobsCompleted == 1UL )
+		{
+			pxStatistics->xMinResponseTime = xResponseTime;
+			pxStatistics->xMaxResponseTime = xResponseTime;
+			pxStatistics->lMinLateness = lLateness;
+			pxStatistics->lMaxLateness = lLateness;
+			pxStatistics->ulMinExecutionTime = ulExecutionTime;
+			pxStatistics->ulMaxExecutionTime = ulExecutionTime;
+		}
+		else
+		{
+			if( xResponseTime < pxStatistics->xMinResponseTime )
+			{
+				pxStatistics->xMinResponseTime = xResponseTime;
+			}
+			else if( xResponseTime > pxStatistics->xMaxResponseTime )
+			{
+				pxStatistics->xMaxResponseTime = xResponseTime;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( lLateness < pxStatistics->lMinLateness )
+			{
+				pxStatistics->lMinLateness = lLateness;
+			}
+			else if( lLateness > pxStatistics->lMaxLateness )
+			{
+				pxStatistics->lMaxLateness = lLateness;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( ulExecutionTime < pxStatistics->ulMinExecutionTime )
+			{
+				pxStatistics->ulMinExecutionTime = ulExecutionTime;
+			}
+			else if( ulExecutionTime > pxStatistics->ulMaxExecutionTime )
+			{
+				pxStatistics->ulMaxExecutionTime = ulExecutionTime;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		#if ( configEDF_RESPONSE_TIME_HISTOGRAM_BINS > 0 )
+		{
+		TickType_t xBin = xResponseTime / ( TickType_t ) configEDF_RESPONSE_TIME_HISTOGRAM_WIDTH;
+
+			if( xBin >= ( TickType_t ) configEDF_RESPONSE_TIME_HISTOGRAM_BINS )
+			{
+				xBin = ( TickType_t ) configEDF_RESPONSE_TIME_HISTOGRAM_BINS - 1U;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			( pxStatistics->ulResponseTimeHistogram[ xBin ] )++;
+		}
+		#endif /* configEDF_RESPONSE_TIME_HISTOGRAM_BINS */
+	}
+	/*-----------------------------------------------------------*/
+
+	void vTaskGetJobStatistics( TaskHandle_t xTask, TaskJobStatistics_t *pxJobStatistics )
+	{
+	TCB_t *pxTCB;
+
+		configASSERT( pxJobStatistics );
+
+		taskENTER_CRITICAL();
+		{
+			/* If null is passed in here then the calling task is being
+			queried. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+			*pxJobStatistics = pxTCB->xJobStatistics;
+		}
+		taskEXIT_CRITICAL();
+	}
+	/*-----------------------------------------------------------*/
+
+#endif /* configUSE_EDF_TASK_STATISTICS */
+
+#if ( configUSE_EDF_UTILISATION_MONITOR == 1 )
+
+	static void prvEDFAccountUtilisation( const uint32_t ulNow )
+	{
+	uint32_t ulStart = ulEDFUtilisationAccounted, ulWindowEnd;
+
+		/* The time is accounted from when it was last accounted, which is
+		always in the current window, so the part of it in each window that
+		has ended since is added before the window is ended.  Only a task that
+		runs for longer than a window ends more than one. */
+		while( ( ulNow - ulEDFUtilisationWindowStart ) >= tskEDF_UTILISATION_WINDOW )
+		{
+			ulWindowEnd = ulEDFUtilisationWindowStart + tskEDF_UTILISATION_WINDOW;
+			prvEDFAddUtilisation( ulWindowEnd - ulStart );
+
+			ulEDFUtilisationWindowStart = ulWindowEnd;
+			ulEDFUtilisationWindow++;
+			ulStart = ulWindowEnd;
+		}
+
+		prvEDFAddUtilisation( ulNow - ulStart );
+		ulEDFUtilisationAccounted = ulNow;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvEDFAddUtilisation( const uint32_t ulRunTime )
+	{
+		/* The averages are brought up to date first so the time is added to
+		the current window. */
+		prvEDFUpdateUtilisation( &( pxCurrentTCB->xUtilisation ) );
+		pxCurrentTCB->xUtilisation.ulRunTime += ulRunTime;
+
+		if( pxCurrentTCB != xIdleTaskHandle )
+		{
+			prvEDFUpdateUtilisation( &xEDFSystemUtilisation );
+			xEDFSystemUtilisation.ulRunTime += ulRunTime;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvEDFUpdateUtilisation( EDFUtilisation_t *pxUtilisation )
+	{
+	uint32_t ulWindows = ulEDFUtilisationWindow - pxUtilisation->ulWindow;
+
+		if( ulWindows != 0UL )
+		{
+			/* The window the time was measured in has ended. */
+			pxUtilisation->ulAverage = prvEDFMovingAverage( pxUtilisation->ulAverage, pxUtilisation->ulRunTime );
+
+			if( pxUtilisation->ulAverage > pxUtilisation->ulPeak )
+			{
+				pxUtilisation->ulPeak = pxUtilisation->ulAverage;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* The windows that have ended since used no time.  The average
+			reaches 0 within a bounded number of them, after which the rest
+			need not be added. */
+			pxUtilisation->ulLastWindow = ( ulWindows == 1UL ) ? pxUtilisation->ulRunTime : 0UL;
+			ulWindows--;
+
+			while( ( ulWindows != 0UL ) && ( pxUtilisation->ulAverage != 0UL ) )
+			{
+				pxUtilisation->ulAverage = prvEDFMovingAverage( pxUtilisation->ulAverage, 0UL );
+				ulWindows--;
+			}
+
+			pxUtilisation->ulRunTime = 0UL;
+			pxUtilisation->ulWindow = ulEDFUtilisationWindow;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvEDFGetUtilisation( EDFUtilisation_t *pxUtilisation, TaskUtilisation_t *pxTaskUtilisation )
+	{
+	uint32_t ulNow;
+
+		#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+			portALT_GET_RUN_TIME_COUNTER_VALUE( ulNow );
+		#else
+			ulNow = portGET_RUN_TIME_COUNTER_VALUE();
+		#endif
+
+		prvEDFAccountUtilisation( ulNow );
+		prvEDFUpdateUtilisation( pxUtilisation );
+
+		/* The only divisions are made here, when the utilisation is read. */
+		pxTaskUtilisation->ulUtilisation = ( uint32_t ) ( ( ( uint64_t ) pxUtilisation->ulAverage * ( uint64_t ) tskEDF_FULL_UTILISATION ) / ( uint64_t ) tskEDF_UTILISATION_WINDOW );
+		pxTaskUtilisation->ulLastWindow = ( uint32_t ) ( ( ( uint64_t ) pxUtilisation->ulLastWindow * ( uint64_t ) tskEDF_FULL_UTILISATION ) / ( uint64_t ) tskEDF_UTILISATION_WINDOW );
+		pxTaskUtilisation->ulPeakUtilisation = ( uint32_t ) ( ( ( uint64_t ) pxUtilisation->ulPeak * ( uint64_t ) tskEDF_FULL_UTILISATION ) / ( uint64_t ) tskEDF_UTILISATION_WINDOW );
+	}
+	/*-----------------------------------------------------------*/
+
+	void vTaskGetUtilisation( TaskHandle_t xTask, TaskUtilisation_t *pxUtilisation )
+	{
+	TCB_t *pxTCB;
+
+		configASSERT( pxUtilisation );
+
+		taskENTER_CRITICAL();
+		{
+			/* If null is passed in here then the calling task is being
+			queried. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+			prvEDFGetUtilisation( &( pxTCB->xUtilisation ), pxUtilisation );
+
+			if( ( pxTCB->xTaskWCET != ( TickType_t ) 0U ) && ( pxTCB->xTaskPeriod != ( TickType_t ) 0U ) )
+			{
+				pxUtilisation->ulDeclaredUtilisation = prvEDFUtilisation( pxTCB->xTaskWCET, pxTCB->xTaskPeriod );
+			}
+			else
+			{
+				pxUtilisation->ulDeclaredUtilisation = 0UL;
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+	/*-----------------------------------------------------------*/
+
+	void vTaskGetSystemUtilisation( TaskUtilisation_t *pxUtilisation )
+	{
+		configASSERT( pxUtilisation );
+
+		taskENTER_CRITICAL();
+		{
+			prvEDFGetUtilisation( &xEDFSystemUtilisation, pxUtilisation );
+
+			#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+			{
+				pxUtilisation->ulDeclaredUtilisation = ulEDFUtilisation;
+			}
+			#else
+			{
+				pxUtilisation->ulDeclaredUtilisation = 0UL;
+			}
+			#endif
+		}
+		taskEXIT_CRITICAL();
+	}
+	/*-----------------------------------------------------------*/
+
+#endif /* configUSE_EDF_UTILISATION_MONITOR */
+
+#if ( configUSE_EDF_BANDWIDTH_SERVER == 1 )
+
+	static void prvEDFServerWake( TCB_t *pxTCB )
+	{
+	const TickType_t xConstTickCount = xTickCount;
+
+		/* The remaining budget c can be used by the deadline d at the
+		bandwidth Q / T of the server if c / ( d - t ) <= Q / T, which is
+		tested as c * T < ( d - t ) * Q so no division is needed.  A deadline
+		that has passed leaves no time to use the budget in. */
+		if( ( prvEDFTimeIsBefore( xConstTickCount, pxTCB->xServerDeadline ) == pdFALSE ) ||
+			( ( ( uint64_t ) pxTCB->xServerBudget * ( uint64_t ) pxTCB->xTaskPeriod ) >= ( ( uint64_t ) ( TickType_t ) ( pxTCB->xServerDeadline - xConstTickCount ) * ( uint64_t ) pxTCB->xTaskWCET ) ) )
+		{
+			pxTCB->xServerDeadline = xConstTickCount + pxTCB->xTaskPeriod;
+			pxTCB->xServerBudget = pxTCB->xTaskWCET;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvEDFInitialiseServer( TCB_t *pxTCB )
+	{
+		pxTCB->ucServer = pdTRUE;
+		pxTCB->xServerBudget = pxTCB->xTaskWCET;
+		pxTCB->xServerDeadline = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
+
+		#if ( configUSE_EDF_TASK_STATISTICS == 1 )
+		{
+			/* The task was created as a periodic task, which counted its
+			first job, but a server has no jobs. */
+			pxTCB->xJobStatistics.ulJobsReleased = 0UL;
+		}
+		#endif
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvEDFChargeServer( void )
+	{
+	TCB_t * const pxTCB = pxCurrentTCB;
+
+		if( pxTCB->ucServer != pdFALSE )
+		{
+			configASSERT( pxTCB->xServerBudget > ( TickType_t ) 0 );
+			( pxTCB->xServerBudget )--;
+
+			if( pxTCB->xServerBudget == ( TickType_t ) 0 )
+			{
+				/* Postponing the deadline rather than stopping the server
+				lets it carry on with its work while no task with an earlier
+				deadline is ready, without it ever taking more than its
+				bandwidth from the tasks that are. */
+				pxTCB->xServerBudget = pxTCB->xTaskWCET;
+				pxTCB->xServerDeadline += pxTCB->xTaskPeriod;
+
+				/* The tick can be charged to a server that has just blocked if
+				the tick was pended, in which case its new deadline is used
+				when it is next ready. */
+				if( listIS_CONTAINED_WITHIN( &xReadyTasksListEDF, &( pxTCB->xStateListItem ) ) != pdFALSE )
+				{
+					( void ) prvRemoveTaskFromStateList( pxTCB );
+					listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), pxTCB->xServerDeadline );
+
+					#if ( configUSE_MUTEXES == 1 )
+					{
+						prvEDFApplyInheritedDeadline( pxTCB );
+					}
+					#endif
+
+					prvAddTaskToReadyList( pxTCB );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+#endif /* configUSE_EDF_BANDWIDTH_SERVER */
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_MUTEXES == 1 ) )
+
+	static BaseType_t prvEDFInheritDeadline( TCB_t * const pxMutexHolderTCB )
+	{
+	const TickType_t xDeadline = listGET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ) );
+	BaseType_t xInherit, xIsReady, xReturn;
+
+		/* The task attempting to obtain the mutex is running, so its list
+		item value is its deadline.  A task in the background has no deadline
+		to pass on, and a holder in the background is behind every task that
+		has one. */
+		if( pxCurrentTCB->ucBackground != pdFALSE )
+		{
+			xInherit = pdFALSE;
+		}
+		else if( pxMutexHolderTCB->ucDeadlineInherited != 0U )
+		{
+			xInherit = prvEDFTimeIsBefore( xDeadline, pxMutexHolderTCB->xInheritedDeadline );
+		}
+		else if( pxMutexHolderTCB->ucBackground != pdFALSE )
+		{
+			xInherit = pdTRUE;
+		}
+		else
+		{
+			xInherit = prvEDFTimeIsBefore( xDeadline, prvEDFOwnDeadline( pxMutexHolderTCB ) );
+		}
+
+		if( xInherit != pdFALSE )
+		{
+			/* If the holder is ready its place in the ready heap changes,
+			otherwise the inherited deadline is applied when it is next made
+			ready. */
+			xIsReady = prvEDFTaskIsReady( pxMutexHolderTCB );
+
+			if( xIsReady != pdFALSE )
+			{
+				( void ) prvRemoveTaskFromStateList( pxMutexHolderTCB );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( pxMutexHolderTCB->ucDeadlineInherited == 0U )
+			{
+				pxMutexHolderTCB->ucDeadlineInherited = tskEDF_INHERITED_DEADLINE;
+
+				if( pxMutexHolderTCB->ucBackground != pdFALSE )
+				{
+					pxMutexHolderTCB->ucBackground = pdFALSE;
+					pxMutexHolderTCB->ucDeadlineInherited |= tskEDF_INHERITED_BACKGROUND;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxMutexHolderTCB->xInheritedDeadline = xDeadline;
+
+			if( xIsReady != pdFALSE )
+			{
+				listSET_LIST_ITEM_VALUE( &( pxMutexHolderTCB->xStateListItem ), xDeadline );
+				prvAddTaskToReadyList( pxMutexHolderTCB );
+			}
+			else
+			{
+				/* A holder blocked on another object is woken by it in the
+				order of its new deadline. */
+				prvEDFReorderWaitingTask( pxMutexHolderTCB );
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* As with priorities, report inheritance if the holder already had a
+		deadline at least as early from another task. */
+		if( pxMutexHolderTCB->ucDeadlineInherited != 0U )
+		{
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			xReturn = pdFALSE;
+		}
+
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	static BaseType_t prvEDFDisinheritDeadline( TCB_t * const pxTCB )
+	{
+	BaseType_t xReturn = pdFALSE;
+
+		/* As with priorities, the inherited deadline is only given up when no
+		other mutexes are held, as any of them may have caused it. */
+		if( ( pxTCB->uxMutexesHeld == ( UBaseType_t ) 0 ) && ( pxTCB->ucDeadlineInherited != 0U ) )
+		{
+			/* The task is giving back the mutex so it is running, and so in
+			the ready heap, from which it moves to the background if it was
+			there before it inherited the deadline. */
+			( void ) prvRemoveTaskFromStateList( pxTCB );
+			listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), prvEDFOwnDeadline( pxTCB ) );
+
+			if( ( pxTCB->ucDeadlineInherited & tskEDF_INHERITED_BACKGROUND ) != 0U )
+			{
+				pxTCB->ucBackground = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxTCB->ucDeadlineInherited = 0U;
+			prvAddTaskToReadyList( pxTCB );
+
+			/* A task with an earlier deadline than the task's own may now be
+			ready. */
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvEDFApplyInheritedDeadline( TCB_t * const pxTCB )
+	{
+		if( ( pxTCB->ucDeadlineInherited != 0U ) &&
+			( prvEDFTimeIsBefore( pxTCB->xInheritedDeadline, listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) ) ) != pdFALSE ) )
+		{
+			listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), pxTCB->xInheritedDeadline );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static TickType_t prvEDFOwnDeadline( const TCB_t * const pxTCB )
+	{
+	TickType_t xDeadline = pxTCB->xTaskReleaseTime + pxTCB->xTaskRelativeDeadline;
+
+		#if ( configUSE_EDF_BANDWIDTH_SERVER == 1 )
+		{
+			if( pxTCB->ucServer != pdFALSE )
+			{
+				xDeadline = pxTCB->xServerDeadline;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif
+
+		return xDeadline;
+	}
+	/*-----------------------------------------------------------*/
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_MUTEXES == 1 ) */
+
+#if ( configUSE_EDF_HYBRID_SCHEDULING == 1 )
+
+	static UBaseType_t prvEDFGetTopFixedPriority( void )
+	{
+	UBaseType_t uxTopPriority;
+
+		/* Only the tasks of the fixed priority band are recorded in
+		uxTopReadyPriority, as the tasks of the EDF band are not held in
+		pxReadyTasksLists. */
+		#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
+		{
+			/* uxTopReadyPriority is only lowered as tasks are selected, so it
+			may be above the highest priority that has ready tasks. */
+			uxTopPriority = uxTopReadyPriority;
+
+			while( ( uxTopPriority > ( UBaseType_t ) configEDF_MAX_PRIORITY ) && ( listLIST_IS_EMPTY( &( pxReadyTasksLists[ uxTopPriority ] ) ) != pdFALSE ) )
+			{
+				--uxTopPriority;
+			}
+
+			uxTopReadyPriority = uxTopPriority;
+		}
+		#else
+		{
+			if( uxTopReadyPriority != ( UBaseType_t ) 0 )
+			{
+				portGET_HIGHEST_PRIORITY( uxTopPriority, uxTopReadyPriority );
+			}
+			else
+			{
+				uxTopPriority = ( UBaseType_t ) 0;
+			}
+		}
+		#endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
+
+		if( uxTopPriority < ( UBaseType_t ) configEDF_MAX_PRIORITY )
+		{
+			uxTopPriority = ( UBaseType_t ) configEDF_MAX_PRIORITY;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return uxTopPriority;
+	}
+	/*-----------------------------------------------------------*/
+
+	static BaseType_t prvEDFSwitchRequired( void )
+	{
+	const UBaseType_t uxTopPriority = prvEDFGetTopFixedPriority();
+	BaseType_t xReturn;
+
+		if( prvEDFIsFixedPriority( pxCurrentTCB ) != pdFALSE )
+		{
+			/* The tasks of equal priority share the processor through the
+			time slicing in xTaskIncrementTick(). */
+			if( uxTopPriority > pxCurrentTCB->uxPriority )
+			{
+				xReturn = pdTRUE;
+			}
+			else
+			{
+				xReturn = pdFALSE;
+			}
+		}
+		else if( uxTopPriority > ( UBaseType_t ) configEDF_MAX_PRIORITY )
+		{
+			xReturn = pdTRUE;
+		}
+		else if( ( pxEDFReadyHeapRoot != NULL ) && ( pxEDFReadyHeapRoot != pxCurrentTCB ) )
+		{
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			xReturn = pdFALSE;
+		}
+
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	static UBaseType_t prvRemoveTaskFromStateList( TCB_t *pxTCB )
+	{
+	List_t * const pxList = listLIST_ITEM_CONTAINER( &( pxTCB->xStateListItem ) );
+	UBaseType_t uxReturn;
+
+		if( pxList == &xReadyTasksListEDF )
+		{
+			uxReturn = prvEDFReadyHeapRemove( pxTCB );
+		}
+		else
+		{
+			uxReturn = uxListRemove( &( pxTCB->xStateListItem ) );
+
+			/* The ready list is found from the list item rather than from the
+			priority of the task, which the caller may already have changed. */
+			if( ( uxReturn == ( UBaseType_t ) 0 ) && ( prvEDFIsFixedPriorityReadyList( pxList ) != pdFALSE ) )
+			{
+				portRESET_READY_PRIORITY( ( UBaseType_t ) ( pxList - pxReadyTasksLists ), uxTopReadyPriority );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		return uxReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	#if ( configUSE_MUTEXES == 1 )
+
+		static BaseType_t prvEDFInheritPriority( TCB_t * const pxMutexHolderTCB )
+		{
+		BaseType_t xIsReady, xReturn;
+
+			if( pxMutexHolderTCB->uxPriority < pxCurrentTCB->uxPriority )
+			{
+				/* If the holder is ready it moves to the ready list of its new
+				priority, otherwise it is placed there when it is next made
+				ready.  The deadline held in its state list item is kept for
+				when it gives the priority back. */
+				xIsReady = prvEDFTaskIsReady( pxMutexHolderTCB );
+
+				if( xIsReady != pdFALSE )
+				{
+					( void ) prvRemoveTaskFromStateList( pxMutexHolderTCB );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				traceTASK_PRIORITY_INHERIT( pxMutexHolderTCB, pxCurrentTCB->uxPriority );
+				pxMutexHolderTCB->uxPriority = pxCurrentTCB->uxPriority;
+
+				if( xIsReady != pdFALSE )
+				{
+					prvAddTaskToReadyList( pxMutexHolderTCB );
+				}
+				else
+				{
+					/* The tasks of the fixed priority band waiting for an
+					event are ordered by their priorities. */
+					prvEDFReorderWaitingTask( pxMutexHolderTCB );
+				}
+
+				xReturn = pdTRUE;
+			}
+			else if( pxMutexHolderTCB->uxBasePriority < pxCurrentTCB->uxPriority )
+			{
+				/* The holder already inherited a priority at least as high
+				from another task. */
+				xReturn = pdTRUE;
+			}
+			else
+			{
+				xReturn = pdFALSE;
+			}
+
+			return xReturn;
+		}
+		/*-----------------------------------------------------------*/
+
+		static BaseType_t prvEDFDisinheritPriority( TCB_t * const pxTCB )
+		{
+		BaseType_t xReturn = pdFALSE;
+
+			/* As prvEDFDisinheritDeadline(), the inherited priority is only
+			given up when no other mutexes are held. */
+			if( ( pxTCB->uxPriority != pxTCB->uxBasePriority ) && ( pxTCB->uxMutexesHeld == ( UBaseType_t ) 0 ) )
+			{
+				/* The task is giving back the mutex so it is running, and so in
+				the ready list of its inherited priority, from which it returns
+				to the EDF band if it came from there. */
+				( void ) prvRemoveTaskFromStateList( pxTCB );
+				traceTASK_PRIORITY_DISINHERIT( pxTCB, pxTCB->uxBasePriority );
+				pxTCB->uxPriority = pxTCB->uxBasePriority;
+				prvAddTaskToReadyList( pxTCB );
+				xReturn = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			return xReturn;
+		}
+		/*-----------------------------------------------------------*/
+
+	#endif /* configUSE_MUTEXES */
+
+#endif /* configUSE_EDF_HYBRID_SCHEDULING */
+
+#if ( configUSE_EDF_MODE_CHANGE == 1 )
+
+	static void prvEDFApplyTimingChange( TCB_t *pxTCB )
+	{
+		/* A change that can raise the demand of its task waits until the
+		changes that lower demand have been applied, so processor time is
+		given up before it is taken. */
+		if( ( ( pxTCB->ucTimingChange & tskEDF_TIMING_PENDING ) != 0U ) &&
+			( ( ( pxTCB->ucTimingChange & tskEDF_TIMING_RAISES_DEMAND ) == 0U ) || ( prvEDFDemandDecreasesPending() == pdFALSE ) ) )
+		{
+			#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+			{
+				ulEDFUtilisation -= prvEDFUtilisation( pxTCB->xTaskWCET, pxTCB->xTaskPeriod );
+			}
+			#endif
+
+			pxTCB->xTaskPeriod = pxTCB->xNewTiming.xPeriod;
+			pxTCB->xTaskRelativeDeadline = pxTCB->xNewTiming.xRelativeDeadline;
+			pxTCB->xTaskWCET = pxTCB->xNewTiming.xWorstCaseExecutionTime;
+			pxTCB->xTaskBlockingTime = pxTCB->xNewTiming.xBlockingTime;
+
+			#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+			{
+				ulEDFUtilisation += prvEDFUtilisation( pxTCB->xTaskWCET, pxTCB->xTaskPeriod );
+			}
+			#endif
+
+			/* A task between jobs that waits for an event in the meantime is
+			woken by it in the order of the deadline of its next job. */
+			prvEDFReorderWaitingTask( pxTCB );
+
+			prvEDFCancelTimingChange( pxTCB );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvEDFCancelTimingChange( TCB_t *pxTCB )
+	{
+		if( ( pxTCB->ucTimingChange & tskEDF_TIMING_PENDING ) != 0U )
+		{
+			if( ( pxTCB->ucTimingChange & tskEDF_TIMING_RAISES_DEMAND ) == 0U )
+			{
+				uxEDFDemandDecreasesPending--;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			uxEDFTimingChangesPending--;
+			pxTCB->ucTimingChange = ( uint8_t ) 0U;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvEDFWaitForDemandDecrease( const TCB_t * const pxTCB )
+	{
+	const TickType_t xDeadline = pxTCB->xTaskReleaseTime + pxTCB->xTaskRelativeDeadline;
+	TickType_t xWait = ( TickType_t ) 0U, xRemaining;
+
+		if( prvEDFTimeIsBefore( xTickCount, xDeadline ) != pdFALSE )
+		{
+			xWait = xDeadline - xTickCount;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* The other changes wait for whichever of the jobs is due last. */
+		if( prvEDFDemandDecreasesPending() != pdFALSE )
+		{
+			xRemaining = xEDFDemandDecreasesWait - ( xTickCount - xEDFDemandDecreasesTimeOut.xTimeOnEntering );
+
+			if( xRemaining > xWait )
+			{
+				xWait = xRemaining;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		vTaskInternalSetTimeOutState( &xEDFDemandDecreasesTimeOut );
+		xEDFDemandDecreasesWait = xWait;
+		uxEDFDemandDecreasesPending++;
+	}
+	/*-----------------------------------------------------------*/
+
+	static BaseType_t prvEDFDemandDecreasesPending( void )
+	{
+	const TickType_t xElapsedTime = xTickCount - xEDFDemandDecreasesTimeOut.xTimeOnEntering;
+	BaseType_t xReturn;
+
+		/* A job that is still running after its deadline has overrun, and no
+		longer holds processor time the task set was admitted with, so the
+		changes stop waiting for a task whose job never completes, such as a
+		task suspended part way through a job.  The time out is checked as in
+		xTaskCheckForTimeOut(). */
+		if( uxEDFDemandDecreasesPending == ( UBaseType_t ) 0U )
+		{
+			xReturn = pdFALSE;
+		}
+		else if( ( xNumOfOverflows != xEDFDemandDecreasesTimeOut.xOverflowCount ) && ( xTickCount >= xEDFDemandDecreasesTimeOut.xTimeOnEntering ) )
+		{
+			xReturn = pdFALSE;
+		}
+		else if( xElapsedTime < xEDFDemandDecreasesWait )
+		{
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			xReturn = pdFALSE;
+		}
+
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+#endif /* configUSE_EDF_MODE_CHANGE */
+
+#if ( INCLUDE_vTaskDelete == 1 )
+
+	void vTaskDelete( TaskHandle_t xTaskToDelete )
+	{
+	TCB_t *pxTCB;
+
+		taskENTER_CRITICAL();
+		{
+			/* If null is passed in here then it is the calling task that is
+			being deleted. */
+			pxTCB = prvGetTCBFromHandle( xTaskToDelete );
+
+			#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+			{
+				/* The time the task was admitted with becomes available to
+				other tasks. */
+				prvEDFWithdrawTask( pxTCB );
+			}
+			#endif
+
+			#if ( configUSE_EDF_MODE_CHANGE == 1 )
+			{
+				prvEDFCancelTimingChange( pxTCB );
+			}
+			#endif
+
+			/* Remove task from the ready/delayed list. */
+			if( prvRemoveTaskFromStateList( pxTCB ) == ( UBaseType_t ) 0 )
+			{
+				taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Is the task waiting on an event also? */
+			if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+			{
+				( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Increment the uxTaskNumber also so kernel aware debuggers can
+			detect that the task lists need re-generating.  This is done before
+			portPRE_TASK_DELETE_HOOK() as in the Windows port that macro will
+			not return. */
+			uxTaskNumber++;
+
+			if( pxTCB == pxCurrentTCB )
+			{
 				/* A task is deleting itself.  This cannot complete within the
 				task itself, as a context switch to another task is required.
 				Place the task in the termination list.  The idle task will
@@ -1246,181 +4690,575 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 				the scheduler for the TCB and stack of the deleted task. */
 				vListInsertEnd( &xTasksWaitingTermination, &( pxTCB->xStateListItem ) );
 
-				/* Increment the ucTasksDeleted variable so the idle task knows
-				there is a task that has been deleted and that it should therefore
-				check the xTasksWaitingTermination list. */
-				++uxDeletedTasksWaitingCleanUp;
+				/* Increment the ucTasksDeleted variable so the idle task knows
+				there is a task that has been deleted and that it should therefore
+				check the xTasksWaitingTermination list. */
+				++uxDeletedTasksWaitingCleanUp;
+
+				/* Call the delete hook before portPRE_TASK_DELETE_HOOK() as
+				portPRE_TASK_DELETE_HOOK() does not return in the Win32 port. */
+				traceTASK_DELETE( pxTCB );
+
+				/* The pre-delete hook is primarily for the Windows simulator,
+				in which Windows specific clean up operations are performed,
+				after which it is not possible to yield away from this task -
+				hence xYieldPending is used to latch that a context switch is
+				required. */
+				portPRE_TASK_DELETE_HOOK( pxTCB, &xYieldPending );
+			}
+			else
+			{
+				--uxCurrentNumberOfTasks;
+				traceTASK_DELETE( pxTCB );
+				prvDeleteTCB( pxTCB );
+
+				/* Reset the next expected unblock time in case it referred to
+				the task that has just been deleted. */
+				prvResetNextTaskUnblockTime();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		/* Force a reschedule if it is the currently running task that has just
+		been deleted. */
+		if( xSchedulerRunning != pdFALSE )
+		{
+			if( pxTCB == pxCurrentTCB )
+			{
+				configASSERT( uxSchedulerSuspended == 0 );
+				portYIELD_WITHIN_API();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+
+#endif /* INCLUDE_vTaskDelete */
+/*-----------------------------------------------------------*/
 
-				/* Call the delete hook before portPRE_TASK_DELETE_HOOK() as
-				portPRE_TASK_DELETE_HOOK() does not return in the Win32 port. */
-				traceTASK_DELETE( pxTCB );
+#if ( INCLUDE_vTaskDelayUntil == 1 )
 
-				/* The pre-delete hook is primarily for the Windows simulator,
-				in which Windows specific clean up operations are performed,
-				after which it is not possible to yield away from this task -
-				hence xYieldPending is used to latch that a context switch is
-				required. */
-				portPRE_TASK_DELETE_HOOK( pxTCB, &xYieldPending );
+	void vTaskDelayUntil( TickType_t * const pxPreviousWakeTime, const TickType_t xTimeIncrement )
+	{
+	TickType_t xTimeToWake;
+	BaseType_t xAlreadyYielded, xShouldDelay = pdFALSE;
+
+		configASSERT( pxPreviousWakeTime );
+		configASSERT( ( xTimeIncrement > 0U ) );
+		configASSERT( uxSchedulerSuspended == 0 );
+
+		vTaskSuspendAll();
+		{
+			/* Minor optimisation.  The tick count cannot change in this
+			block. */
+			const TickType_t xConstTickCount = xTickCount;
+
+			/* Generate the tick time at which the task wants to wake. */
+			xTimeToWake = *pxPreviousWakeTime + xTimeIncrement;
+
+			if( xConstTickCount < *pxPreviousWakeTime )
+			{
+				/* The tick count has overflowed since this function was
+				lasted called.  In this case the only time we should ever
+				actually delay is if the wake time has also	overflowed,
+				and the wake time is greater than the tick time.  When this
+				is the case it is as if neither time had overflowed. */
+				if( ( xTimeToWake < *pxPreviousWakeTime ) && ( xTimeToWake > xConstTickCount ) )
+				{
+					xShouldDelay = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
 			else
 			{
-				--uxCurrentNumberOfTasks;
-				traceTASK_DELETE( pxTCB );
-				prvDeleteTCB( pxTCB );
+				/* The tick time has not overflowed.  In this case we will
+				delay if either the wake time has overflowed, and/or the
+				tick time is less than the wake time. */
+				if( ( xTimeToWake < *pxPreviousWakeTime ) || ( xTimeToWake > xConstTickCount ) )
+				{
+					xShouldDelay = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
 
-				/* Reset the next expected unblock time in case it referred to
-				the task that has just been deleted. */
-				prvResetNextTaskUnblockTime();
+			/* Update the wake time ready for the next call. */
+			*pxPreviousWakeTime = xTimeToWake;
+
+			#if ( configUSE_EDF_SCHEDULER == 1 )
+			{
+				prvEDFRecordJobCompletion( pxCurrentTCB, xConstTickCount );
+
+				/* The wake time is the nominal release time of the next job
+				of the task. */
+				pxCurrentTCB->xTaskReleaseTime = xTimeToWake;
+				pxCurrentTCB->ucReleasePending = pdTRUE;
+			}
+			#endif /* configUSE_EDF_SCHEDULER */
+
+			if( xShouldDelay != pdFALSE )
+			{
+				traceTASK_DELAY_UNTIL( xTimeToWake );
+
+				/* prvAddCurrentTaskToDelayedList() needs the block time, not
+				the time to wake, so subtract the current tick count. */
+				prvAddCurrentTaskToDelayedList( xTimeToWake - xConstTickCount, pdFALSE );
+			}
+			else
+			{
+				#if ( configUSE_EDF_SCHEDULER == 1 )
+				{
+					/* The next job should already have been released, so it
+					is released now, late, and the task moves within the ready
+					heap to the position of its new deadline.  The ready heap
+					cannot be accessed from an interrupt while the scheduler
+					is suspended. */
+					( void ) prvRemoveTaskFromStateList( pxCurrentTCB );
+					prvEDFSetDeadline( pxCurrentTCB );
+					prvAddTaskToReadyList( pxCurrentTCB );
+				}
+				#else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+				#endif /* configUSE_EDF_SCHEDULER */
+			}
+		}
+		xAlreadyYielded = xTaskResumeAll();
+
+		/* Force a reschedule if xTaskResumeAll has not already done so, we may
+		have put ourselves to sleep. */
+		if( xAlreadyYielded == pdFALSE )
+		{
+			portYIELD_WITHIN_API();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* INCLUDE_vTaskDelayUntil */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskDelay == 1 )
+
+	void vTaskDelay( const TickType_t xTicksToDelay )
+	{
+	BaseType_t xAlreadyYielded = pdFALSE;
+
+		/* A delay time of zero just forces a reschedule. */
+		if( xTicksToDelay > ( TickType_t ) 0U )
+		{
+			configASSERT( uxSchedulerSuspended == 0 );
+			vTaskSuspendAll();
+			{
+				traceTASK_DELAY();
+
+				/* A task that is removed from the event list while the
+				scheduler is suspended will not get placed in the ready
+				list or removed from the blocked list until the scheduler
+				is resumed.
+
+				This task cannot be in an event list as it is the currently
+				executing task. */
+				#if ( configUSE_EDF_SCHEDULER == 1 )
+				{
+					prvEDFRecordJobCompletion( pxCurrentTCB, xTickCount );
+
+					/* The task is delayed until the release of its next
+					job. */
+					pxCurrentTCB->xTaskReleaseTime = xTickCount + xTicksToDelay;
+					pxCurrentTCB->ucReleasePending = pdTRUE;
+				}
+				#endif /* configUSE_EDF_SCHEDULER */
+				prvAddCurrentTaskToDelayedList( xTicksToDelay, pdFALSE );
+			}
+			xAlreadyYielded = xTaskResumeAll();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Force a reschedule if xTaskResumeAll has not already done so, we may
+		have put ourselves to sleep. */
+		if( xAlreadyYielded == pdFALSE )
+		{
+			portYIELD_WITHIN_API();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* INCLUDE_vTaskDelay */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+	BaseType_t xTaskJobComplete( void )
+	{
+	TickType_t xDeadline, xNextRelease;
+	BaseType_t xAlreadyYielded, xReturn, xReleased = pdFALSE, xWaitForArrival = pdFALSE;
+
+		configASSERT( uxSchedulerSuspended == 0 );
+		configASSERT( pxCurrentTCB->xTaskPeriod > ( TickType_t ) 0U );
+		configASSERT( prvEDFIsServer( pxCurrentTCB ) == pdFALSE );
+
+		vTaskSuspendAll();
+		{
+			/* Minor optimisation.  The tick count cannot change in this
+			block. */
+			const TickType_t xConstTickCount = xTickCount;
+
+			#if ( configUSE_EDF_OVERRUN_HANDLING == 1 )
+			{
+				/* If the job was aborted then the job released in its place
+				is already running, so it is started rather than waited for.
+				Its budget is measured from here, as the rest of the aborted
+				job has only just completed. */
+				if( ( pxCurrentTCB->ucJobOverruns & tskEDF_JOB_ABORTED ) != 0U )
+				{
+					pxCurrentTCB->ucJobOverruns &= ( uint8_t ) ~tskEDF_JOB_ABORTED;
+					xReleased = pdTRUE;
+
+					#if ( configGENERATE_RUN_TIME_STATS == 1 )
+					{
+						pxCurrentTCB->ulJobStartRunTime = prvEDFGetRunTime( pxCurrentTCB );
+					}
+					#endif
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configUSE_EDF_OVERRUN_HANDLING */
+
+			if( xReleased == pdFALSE )
+			{
+				/* The job completed on time if it completed no later than its
+				deadline. */
+				xDeadline = pxCurrentTCB->xTaskReleaseTime + pxCurrentTCB->xTaskRelativeDeadline;
+				xReturn = ( prvEDFTimeIsBefore( xDeadline, xConstTickCount ) == pdFALSE ) ? pdPASS : pdFAIL;
+
+				prvEDFRecordJobCompletion( pxCurrentTCB, xConstTickCount );
+
+				/* The next job is released one period after the job that has
+				just completed, however late that job was released. */
+				xNextRelease = pxCurrentTCB->xTaskReleaseTime + pxCurrentTCB->xTaskPeriod;
+
+				#if ( configUSE_EDF_OVERRUN_HANDLING == 1 )
+				{
+					/* Count the overruns the tick did not see. */
+					if( ( xReturn == pdFAIL ) && ( ( pxCurrentTCB->ucJobOverruns & tskEDF_JOB_DEADLINE_MISSED ) == 0U ) )
+					{
+						prvEDFRecordOverrun( pxCurrentTCB, eDeadlineMissed );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					#if ( configGENERATE_RUN_TIME_STATS == 1 )
+					{
+						if( ( ( pxCurrentTCB->ucJobOverruns & tskEDF_JOB_BUDGET_EXHAUSTED ) == 0U ) && ( prvEDFBudgetIsExhausted( pxCurrentTCB ) != pdFALSE ) )
+						{
+							prvEDFRecordOverrun( pxCurrentTCB, eBudgetExhausted );
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					#endif /* configGENERATE_RUN_TIME_STATS */
+
+					if( ( pxCurrentTCB->ucJobOverruns & tskEDF_JOB_SKIP_NEXT_RELEASE ) != 0U )
+					{
+						pxCurrentTCB->ucJobOverruns &= ( uint8_t ) ~tskEDF_JOB_SKIP_NEXT_RELEASE;
+						xNextRelease += pxCurrentTCB->xTaskPeriod;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configUSE_EDF_OVERRUN_HANDLING */
+
+				pxCurrentTCB->xTaskReleaseTime = xNextRelease;
+				pxCurrentTCB->ucReleasePending = pdTRUE;
+
+				#if ( configUSE_EDF_MODE_CHANGE == 1 )
+				{
+					/* A change that cannot raise the demand of the task only
+					waited for this job, so it is applied now rather than when
+					the next job is released, and the changes waiting for it
+					can go ahead.  A job can be released from an interrupt,
+					which can also apply a change. */
+					if( ( pxCurrentTCB->ucTimingChange & tskEDF_TIMING_RAISES_DEMAND ) == 0U )
+					{
+						taskENTER_CRITICAL();
+						{
+							prvEDFApplyTimingChange( pxCurrentTCB );
+						}
+						taskEXIT_CRITICAL();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configUSE_EDF_MODE_CHANGE */
+
+				#if ( configUSE_EDF_SPORADIC_TASKS == 1 )
+				{
+					/* Each notification given to a sporadic task is the
+					arrival of a job.  If none has arrived the task waits for
+					one, otherwise one is taken and the job is released as the
+					job of a periodic task would be. */
+					if( pxCurrentTCB->ucSporadic != pdFALSE )
+					{
+						taskENTER_CRITICAL();
+						{
+							if( pxCurrentTCB->ulNotifiedValue == 0UL )
+							{
+								pxCurrentTCB->ucNotifyState = taskWAITING_NOTIFICATION;
+								xWaitForArrival = pdTRUE;
+							}
+							else
+							{
+								( pxCurrentTCB->ulNotifiedValue )--;
+							}
+						}
+						taskEXIT_CRITICAL();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configUSE_EDF_SPORADIC_TASKS */
+
+				if( xWaitForArrival != pdFALSE )
+				{
+					traceTASK_NOTIFY_TAKE_BLOCK();
+
+					/* The job is released by the notification that unblocks
+					the task. */
+					#if ( INCLUDE_vTaskSuspend == 1 )
+					{
+						prvAddCurrentTaskToDelayedList( portMAX_DELAY, pdTRUE );
+					}
+					#else
+					{
+						prvAddCurrentTaskToDelayedList( portMAX_DELAY, pdFALSE );
+					}
+					#endif
+				}
+				else if( prvEDFTimeIsBefore( xConstTickCount, xNextRelease ) != pdFALSE )
+				{
+					traceTASK_DELAY_UNTIL( xNextRelease );
+
+					/* The task waits in the Blocked state until the tick
+					releases the next job. */
+					prvAddCurrentTaskToDelayedList( xNextRelease - xConstTickCount, pdFALSE );
+				}
+				else
+				{
+					/* The next job should already have been released, so it is
+					released now, late, as in vTaskDelayUntil(). */
+					( void ) prvRemoveTaskFromStateList( pxCurrentTCB );
+					prvEDFSetDeadline( pxCurrentTCB );
+					prvAddTaskToReadyList( pxCurrentTCB );
+				}
+			}
+			else
+			{
+				xReturn = pdFAIL;
 			}
 		}
-		taskEXIT_CRITICAL();
+		xAlreadyYielded = xTaskResumeAll();
 
-		/* Force a reschedule if it is the currently running task that has just
-		been deleted. */
-		if( xSchedulerRunning != pdFALSE )
+		/* Force a reschedule if xTaskResumeAll has not already done so, as the
+		task has either blocked or its deadline has moved later. */
+		if( ( xAlreadyYielded == pdFALSE ) && ( xReleased == pdFALSE ) )
 		{
-			if( pxTCB == pxCurrentTCB )
+			portYIELD_WITHIN_API();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		#if ( configUSE_EDF_SPORADIC_TASKS == 1 )
+		{
+			/* Take the notification that released the job. */
+			if( xWaitForArrival != pdFALSE )
 			{
-				configASSERT( uxSchedulerSuspended == 0 );
-				portYIELD_WITHIN_API();
+				taskENTER_CRITICAL();
+				{
+					traceTASK_NOTIFY_TAKE();
+
+					if( pxCurrentTCB->ulNotifiedValue != 0UL )
+					{
+						( pxCurrentTCB->ulNotifiedValue )--;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					pxCurrentTCB->ucNotifyState = taskNOT_WAITING_NOTIFICATION;
+				}
+				taskEXIT_CRITICAL();
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
 		}
+		#endif /* configUSE_EDF_SPORADIC_TASKS */
+
+		return xReturn;
 	}
 
-#endif /* INCLUDE_vTaskDelete */
+#endif /* configUSE_EDF_SCHEDULER */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskDelayUntil == 1 )
+#if ( configUSE_EDF_MODE_CHANGE == 1 )
 
-	void vTaskDelayUntil( TickType_t * const pxPreviousWakeTime, const TickType_t xTimeIncrement )
+	BaseType_t xTaskSetTiming( TaskHandle_t xTask, const TaskPeriodicParameters_t * const pxPeriodicParameters )
 	{
-	TickType_t xTimeToWake;
-	BaseType_t xAlreadyYielded, xShouldDelay = pdFALSE;
+		return xTaskSetTimingGroup( &xTask, pxPeriodicParameters, ( UBaseType_t ) 1U );
+	}
+	/*-----------------------------------------------------------*/
 
-		configASSERT( pxPreviousWakeTime );
-		configASSERT( ( xTimeIncrement > 0U ) );
-		configASSERT( uxSchedulerSuspended == 0 );
+	BaseType_t xTaskSetTimingGroup( const TaskHandle_t * const pxTasks, const TaskPeriodicParameters_t * const pxPeriodicParameters, UBaseType_t uxNumberOfTasks )
+	{
+	TCB_t *pxTCB;
+	UBaseType_t uxTask, uxTested;
+	BaseType_t xReturn = pdPASS;
+
+		configASSERT( uxNumberOfTasks > ( UBaseType_t ) 0U );
 
 		vTaskSuspendAll();
 		{
-			/* Minor optimisation.  The tick count cannot change in this
-			block. */
-			const TickType_t xConstTickCount = xTickCount;
+			/* Each change is recorded as under test, which only the admission
+			test looks at, so the tasks keep their timing until it is known the
+			whole group can change. */
+			for( uxTested = ( UBaseType_t ) 0U; uxTested < uxNumberOfTasks; uxTested++ )
+			{
+				pxTCB = prvGetTCBFromHandle( pxTasks[ uxTested ] );
 
-			/* Generate the tick time at which the task wants to wake. */
-			xTimeToWake = *pxPreviousWakeTime + xTimeIncrement;
+				/* Only a task released in jobs has timing to change, and it can
+				only have one change pending at a time. */
+				if( ( pxTCB->xTaskPeriod == ( TickType_t ) 0 ) ||
+					( prvEDFIsServer( pxTCB ) != pdFALSE ) ||
+					( pxTCB->ucTimingChange != ( uint8_t ) 0U ) ||
+					( prvEDFTimingIsValid( &( pxPeriodicParameters[ uxTested ] ) ) == pdFALSE ) )
+				{
+					xReturn = pdFAIL;
+					break;
+				}
 
-			if( xConstTickCount < *pxPreviousWakeTime )
-			{
-				/* The tick count has overflowed since this function was
-				lasted called.  In this case the only time we should ever
-				actually delay is if the wake time has also	overflowed,
-				and the wake time is greater than the tick time.  When this
-				is the case it is as if neither time had overflowed. */
-				if( ( xTimeToWake < *pxPreviousWakeTime ) && ( xTimeToWake > xConstTickCount ) )
+				pxTCB->xNewTiming = pxPeriodicParameters[ uxTested ];
+				pxTCB->ucTimingChange = tskEDF_TIMING_TESTING;
+
+				if( pxTCB->xNewTiming.xRelativeDeadline == ( TickType_t ) 0 )
 				{
-					xShouldDelay = pdTRUE;
+					pxTCB->xNewTiming.xRelativeDeadline = pxTCB->xNewTiming.xPeriod;
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
 			}
-			else
+
+			#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
 			{
-				/* The tick time has not overflowed.  In this case we will
-				delay if either the wake time has overflowed, and/or the
-				tick time is less than the wake time. */
-				if( ( xTimeToWake < *pxPreviousWakeTime ) || ( xTimeToWake > xConstTickCount ) )
+				/* The task set the changes lead to, including those already
+				pending, must pass the test.  The first task of the group is
+				analysed in place of its admitted timing, the rest along with
+				the other admitted tasks. */
+				if( xReturn == pdPASS )
 				{
-					xShouldDelay = pdTRUE;
+					pxTCB = prvGetTCBFromHandle( pxTasks[ 0 ] );
+					xEDFAnalyseNewTiming = pdTRUE;
+
+					if( prvEDFModeIsSchedulable( pxTCB, &( pxTCB->xNewTiming ) ) == pdFALSE )
+					{
+						xReturn = errTASK_SET_NOT_SCHEDULABLE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					xEDFAnalyseNewTiming = pdFALSE;
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
 			}
+			#endif /* configUSE_EDF_ADMISSION_CONTROL */
 
-			/* Update the wake time ready for the next call. */
-			*pxPreviousWakeTime = xTimeToWake;
-
-			if( xShouldDelay != pdFALSE )
-			{
-				traceTASK_DELAY_UNTIL( xTimeToWake );
-
-				/* prvAddCurrentTaskToDelayedList() needs the block time, not
-				the time to wake, so subtract the current tick count. */
-				prvAddCurrentTaskToDelayedList( xTimeToWake - xConstTickCount, pdFALSE );
-			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
-		}
-		xAlreadyYielded = xTaskResumeAll();
-
-		/* Force a reschedule if xTaskResumeAll has not already done so, we may
-		have put ourselves to sleep. */
-		if( xAlreadyYielded == pdFALSE )
-		{
-			portYIELD_WITHIN_API();
-		}
-		else
-		{
-			mtCOVERAGE_TEST_MARKER();
-		}
-	}
-
-#endif /* INCLUDE_vTaskDelayUntil */
-/*-----------------------------------------------------------*/
-
-#if ( INCLUDE_vTaskDelay == 1 )
-
-	void vTaskDelay( const TickType_t xTicksToDelay )
-	{
-	BaseType_t xAlreadyYielded = pdFALSE;
-
-		/* A delay time of zero just forces a reschedule. */
-		if( xTicksToDelay > ( TickType_t ) 0U )
-		{
-			configASSERT( uxSchedulerSuspended == 0 );
-			vTaskSuspendAll();
+			/* The changes are accepted or discarded together.  A job can be
+			released from an interrupt, so the changes become pending in a
+			critical section. */
+			taskENTER_CRITICAL();
 			{
-				traceTASK_DELAY();
+				for( uxTask = ( UBaseType_t ) 0U; uxTask < uxTested; uxTask++ )
+				{
+					pxTCB = prvGetTCBFromHandle( pxTasks[ uxTask ] );
 
-				/* A task that is removed from the event list while the
-				scheduler is suspended will not get placed in the ready
-				list or removed from the blocked list until the scheduler
-				is resumed.
+					if( xReturn != pdPASS )
+					{
+						pxTCB->ucTimingChange = ( uint8_t ) 0U;
+					}
+					else if( prvEDFTimingRaisesDemand( pxTCB, &( pxTCB->xNewTiming ) ) != pdFALSE )
+					{
+						pxTCB->ucTimingChange = ( uint8_t ) ( tskEDF_TIMING_PENDING | tskEDF_TIMING_RAISES_DEMAND );
+						uxEDFTimingChangesPending++;
+					}
+					else
+					{
+						pxTCB->ucTimingChange = tskEDF_TIMING_PENDING;
+						uxEDFTimingChangesPending++;
 
-				This task cannot be in an event list as it is the currently
-				executing task. */
-				prvAddCurrentTaskToDelayedList( xTicksToDelay, pdFALSE );
+						if( pxTCB->ucReleasePending == pdFALSE )
+						{
+							prvEDFWaitForDemandDecrease( pxTCB );
+						}
+						else
+						{
+							/* The task is between jobs, so nothing holds on to
+							the old timing and the change is applied now.  Its
+							next job is released at the time already set from
+							the old period, as it would otherwise be. */
+							uxEDFDemandDecreasesPending++;
+							prvEDFApplyTimingChange( pxTCB );
+						}
+					}
+				}
 			}
-			xAlreadyYielded = xTaskResumeAll();
-		}
-		else
-		{
-			mtCOVERAGE_TEST_MARKER();
+			taskEXIT_CRITICAL();
 		}
+		( void ) xTaskResumeAll();
 
-		/* Force a reschedule if xTaskResumeAll has not already done so, we may
-		have put ourselves to sleep. */
-		if( xAlreadyYielded == pdFALSE )
-		{
-			portYIELD_WITHIN_API();
-		}
-		else
-		{
-			mtCOVERAGE_TEST_MARKER();
-		}
+		return xReturn;
 	}
 
-#endif /* INCLUDE_vTaskDelay */
+#endif /* configUSE_EDF_MODE_CHANGE */
 /*-----------------------------------------------------------*/
 
 #if( ( INCLUDE_eTaskGetState == 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_xTaskAbortDelay == 1 ) )
@@ -1684,26 +5522,38 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 				#endif
 
 				/* Only reset the event list item value if the value is not
-				being used for anything else. */
-				if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
-				{
-					listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-				}
-				else
+				being used for anything else.  Under EDF the value is the
+				deadline of a waiting task, and is set when the task is placed
+				in an event list. */
+				#if ( configUSE_EDF_SCHEDULER == 0 )
 				{
-					mtCOVERAGE_TEST_MARKER();
+					if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+					{
+						listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
 				}
+				#endif
 
 				/* If the task is in the blocked or suspended list we need do
 				nothing more than change its priority variable. However, if
 				the task is in a ready list it needs to be removed and placed
-				in the list appropriate to its new priority. */
+				in the list appropriate to its new priority.  Under hybrid
+				scheduling that includes moving between the ready heap and the
+				ready lists of the fixed priority band. */
+				#if ( configUSE_EDF_HYBRID_SCHEDULING == 1 )
+				if( prvEDFTaskIsReady( pxTCB ) != pdFALSE )
+				#else
 				if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+				#endif
 				{
 					/* The task is currently in its ready list - remove before
 					adding it to it's new ready list.  As we are in a critical
 					section we can do this even if the scheduler is suspended. */
-					if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+					if( prvRemoveTaskFromStateList( pxTCB ) == ( UBaseType_t ) 0 )
 					{
 						/* It is known that the task is in its ready list so
 						there is no need to check again and the port level
@@ -1718,7 +5568,17 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 				}
 				else
 				{
-					mtCOVERAGE_TEST_MARKER();
+					#if ( configUSE_EDF_HYBRID_SCHEDULING == 1 )
+					{
+						/* The tasks of the fixed priority band waiting for an
+						event are ordered by their priorities. */
+						prvEDFReorderWaitingTask( pxTCB );
+					}
+					#else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+					#endif
 				}
 
 				if( xYieldRequired != pdFALSE )
@@ -1757,7 +5617,7 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 
 			/* Remove task from the ready/delayed list and place in the
 			suspended list. */
-			if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+			if( prvRemoveTaskFromStateList( pxTCB ) == ( UBaseType_t ) 0 )
 			{
 				taskRESET_READY_PRIORITY( pxTCB->uxPriority );
 			}
@@ -1910,10 +5770,15 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 					/* The ready list can be accessed even if the scheduler is
 					suspended because this is inside a critical section. */
 					( void ) uxListRemove(  &( pxTCB->xStateListItem ) );
+					#if ( configUSE_EDF_SCHEDULER == 1 )
+					{
+						prvEDFSetDeadline( pxTCB );
+					}
+					#endif
 					prvAddTaskToReadyList( pxTCB );
 
 					/* A higher priority task may have just been resumed. */
-					if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+					if( prvTaskMayPreempt( pxTCB ) != pdFALSE )
 					{
 						/* This yield may not cause the task just resumed to run,
 						but will leave the lists in the correct state for the
@@ -1980,8 +5845,17 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 				if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
 				{
 					/* Ready lists can be accessed so move the task from the
-					suspended list to the ready list directly. */
-					if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+					suspended list to the ready list directly.  The task is
+					compared with the running task once it has its deadline. */
+					( void ) prvRemoveTaskFromStateList( pxTCB );
+					#if ( configUSE_EDF_SCHEDULER == 1 )
+					{
+						prvEDFSetDeadline( pxTCB );
+					}
+					#endif
+					prvAddTaskToReadyList( pxTCB );
+
+					if( prvTaskMayPreempt( pxTCB ) != pdFALSE )
 					{
 						xYieldRequired = pdTRUE;
 					}
@@ -1989,9 +5863,6 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 					{
 						mtCOVERAGE_TEST_MARKER();
 					}
-
-					( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-					prvAddTaskToReadyList( pxTCB );
 				}
 				else
 				{
@@ -2028,13 +5899,30 @@ BaseType_t xReturn;
 		/* The Idle task is created using user provided RAM - obtain the
 		address of the RAM then create the idle task. */
 		vApplicationGetIdleTaskMemory( &pxIdleTaskTCBBuffer, &pxIdleTaskStackBuffer, &ulIdleTaskStackSize );
-		xIdleTaskHandle = xTaskCreateStatic(	prvIdleTask,
-												configIDLE_TASK_NAME,
-												ulIdleTaskStackSize,
-												( void * ) NULL, /*lint !e961.  The cast is not redundant for all compilers. */
-												portPRIVILEGE_BIT, /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
-												pxIdleTaskStackBuffer,
-												pxIdleTaskTCBBuffer ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+		#if ( configUSE_EDF_SCHEDULER == 1 )
+		{
+			/* The Idle task has no deadline, so it is created in the
+			background, as in the dynamically allocated case below. */
+			xIdleTaskHandle = xTaskPeriodicCreateStatic(	prvIdleTask,
+															configIDLE_TASK_NAME,
+															ulIdleTaskStackSize,
+															( void * ) NULL, /*lint !e961.  The cast is not redundant for all compilers. */
+															portPRIVILEGE_BIT, /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
+															pxIdleTaskStackBuffer,
+															pxIdleTaskTCBBuffer,
+															NULL ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+		}
+		#else
+		{
+			xIdleTaskHandle = xTaskCreateStatic(	prvIdleTask,
+													configIDLE_TASK_NAME,
+													ulIdleTaskStackSize,
+													( void * ) NULL, /*lint !e961.  The cast is not redundant for all compilers. */
+													portPRIVILEGE_BIT, /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
+													pxIdleTaskStackBuffer,
+													pxIdleTaskTCBBuffer ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+		}
+		#endif /* configUSE_EDF_SCHEDULER */
 
 		if( xIdleTaskHandle != NULL )
 		{
@@ -2047,16 +5935,14 @@ BaseType_t xReturn;
 	}
 	#else
 	#if (configUSE_EDF_SCHEDULER == 1)
- 
- TickType_t initIDLEPeriod = 200;
- xReturn = xTaskPeriodicCreate( prvIdleTask, 
-																		configIDLE_TASK_NAME, 
-																		configMINIMAL_STACK_SIZE, 
-																		(	void * ) NULL, 
-																		( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), 
-																		&xIdleTaskHandle, 
-																		initIDLEPeriod );
- 
+		/* The Idle task has no deadline, so it is created in the background
+		where it only runs when no task with a deadline is ready. */
+		xReturn = xTaskBackgroundCreate(	prvIdleTask,
+											configIDLE_TASK_NAME,
+											configMINIMAL_STACK_SIZE,
+											( void * ) NULL,
+											( tskIDLE_PRIORITY | portPRIVILEGE_BIT ),
+											&xIdleTaskHandle );
  #else
 		/* The Idle task is being created using dynamically allocated RAM. */
 		xReturn = xTaskCreate(	prvIdleTask,
@@ -2099,6 +5985,22 @@ BaseType_t xReturn;
 		starts to run. */
 		portDISABLE_INTERRUPTS();
 
+		#if ( configUSE_EDF_SCHEDULER == 1 )
+		{
+			/* The first task to run is the one with the earliest deadline,
+			rather than the highest priority task selected as the tasks were
+			created.  Tasks created with a phase are already in the Blocked
+			state, so the next unblock time is taken from the delayed list
+			rather than reset. */
+			prvEDFSelectTask();
+			prvResetNextTaskUnblockTime();
+		}
+		#else
+		{
+			xNextTaskUnblockTime = portMAX_DELAY;
+		}
+		#endif /* configUSE_EDF_SCHEDULER */
+
 		#if ( configUSE_NEWLIB_REENTRANT == 1 )
 		{
 			/* Switch Newlib's _impure_ptr variable to point to the _reent
@@ -2109,7 +6011,6 @@ BaseType_t xReturn;
 		}
 		#endif /* configUSE_NEWLIB_REENTRANT */
 
-		xNextTaskUnblockTime = portMAX_DELAY;
 		xSchedulerRunning = pdTRUE;
 		xTickCount = ( TickType_t ) configINITIAL_TICK_COUNT;
 
@@ -2186,6 +6087,38 @@ void vTaskSuspendAll( void )
 	static TickType_t prvGetExpectedIdleTime( void )
 	{
 	TickType_t xReturn;
+
+	#if ( configUSE_EDF_SCHEDULER == 1 )
+	{
+		/* The idle task runs in the background, so while it runs no task
+		with a deadline is ready unless configUSE_PREEMPTION is 0.  Each job
+		of a periodic task waits for its release in the delayed lists, so the
+		next release is the next unblock time, and the processor can sleep
+		until then unless another task is ready. */
+		if( pxEDFReadyHeapRoot != NULL )
+		{
+			xReturn = 0;
+		}
+		#if ( configUSE_EDF_HYBRID_SCHEDULING == 1 )
+			else if( prvEDFGetTopFixedPriority() > ( UBaseType_t ) configEDF_MAX_PRIORITY )
+			{
+				/* A task of the fixed priority band is ready, which is only
+				possible if configUSE_PREEMPTION is 0. */
+				xReturn = 0;
+			}
+		#endif
+		else if( listCURRENT_LIST_LENGTH( &xBackgroundTasksListEDF ) > ( UBaseType_t ) 1 )
+		{
+			/* There are other background tasks in the ready state, which
+			share the processor with the idle task. */
+			xReturn = 0;
+		}
+		else
+		{
+			xReturn = xNextTaskUnblockTime - xTickCount;
+		}
+	}
+	#else
 	UBaseType_t uxHigherPriorityReadyTasks = pdFALSE;
 
 		/* uxHigherPriorityReadyTasks takes care of the case where
@@ -2237,6 +6170,7 @@ void vTaskSuspendAll( void )
 		{
 			xReturn = xNextTaskUnblockTime - xTickCount;
 		}
+	#endif /* configUSE_EDF_SCHEDULER */
 
 		return xReturn;
 	}
@@ -2248,6 +6182,7 @@ BaseType_t xTaskResumeAll( void )
 {
 TCB_t *pxTCB = NULL;
 BaseType_t xAlreadyYielded = pdFALSE;
+BaseType_t xReleased = pdTRUE;
 
 	/* If uxSchedulerSuspended is zero then this function does not match a
 	previous call to vTaskSuspendAll(). */
@@ -2272,12 +6207,22 @@ BaseType_t xAlreadyYielded = pdFALSE;
 				{
 					pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xPendingReadyList ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
 					( void ) uxListRemove( &( pxTCB->xEventListItem ) );
-					( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-					prvAddTaskToReadyList( pxTCB );
+					( void ) prvRemoveTaskFromStateList( pxTCB );
+					#if ( configUSE_EDF_SCHEDULER == 1 )
+					{
+						/* A task notified from an interrupt may have been
+						given a job too early to release. */
+						xReleased = prvEDFReleaseNotifiedTask( pxTCB );
+					}
+					#else
+					{
+						prvAddTaskToReadyList( pxTCB );
+					}
+					#endif
 
 					/* If the moved task has a priority higher than the current
 					task then a yield must be performed. */
-					if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+					if( ( xReleased != pdFALSE ) && ( prvTaskMayPreempt( pxTCB ) != pdFALSE ) )
 					{
 						xYieldPending = pdTRUE;
 					}
@@ -2557,7 +6502,12 @@ TCB_t *pxTCB;
 
 	UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, uint32_t * const pulTotalRunTime )
 	{
-	UBaseType_t uxTask = 0, uxQueue = configMAX_PRIORITIES;
+	UBaseType_t uxTask = 0;
+	#if ( ( configUSE_EDF_SCHEDULER == 0 ) || ( configUSE_EDF_HYBRID_SCHEDULING == 1 ) )
+		/* Only the ready lists of fixed priority tasks are walked by
+		priority. */
+		UBaseType_t uxQueue = configMAX_PRIORITIES;
+	#endif
 
 		vTaskSuspendAll();
 		{
@@ -2566,16 +6516,33 @@ TCB_t *pxTCB;
 			{
 				/* Fill in an TaskStatus_t structure with information on each
 				task in the Ready state. */
-			#if (configUSE_EDF_SCHEDULER == 1)
+				#if ( configUSE_EDF_SCHEDULER == 1 )
+				{
+					#if ( configUSE_EDF_HYBRID_SCHEDULING == 1 )
+					{
+						/* The tasks of the fixed priority band are held in
+						pxReadyTasksLists. */
+						do
+						{
+							uxQueue--;
+							uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksLists[ uxQueue ] ), eReady );
+						} while( uxQueue > ( UBaseType_t ) configEDF_MAX_PRIORITY + 1U ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+					}
+					#endif
+
+					uxTask += prvListTasksWithinEDFReadyHeap( &( pxTaskStatusArray[ uxTask ] ) );
+					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xBackgroundTasksListEDF, eReady );
+				}
+				#else
+				{
+					do
+					{
+						uxQueue--;
+						uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksLists[ uxQueue ] ), eReady );
+					} while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+				}
+				#endif /* configUSE_EDF_SCHEDULER */
 
-            uxTask += prvListTasksWithinSingleList(&(pxTaskStatusArray[uxTask]), &(xReadyTasksListEDF), eReady);
-			#else
-            do
-            {	
-                uxQueue--;
-                uxTask += prvListTasksWithinSingleList(&(pxTaskStatusArray[uxTask]), &(pxReadyTasksLists[uxQueue]), eReady);
-            } while (uxQueue > (UBaseType_t)tskIDLE_PRIORITY); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-		  #endif
 				/* Fill in an TaskStatus_t structure with information on each
 				task in the Blocked state. */
 				uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
@@ -2648,12 +6615,35 @@ implementations require configUSE_TICKLESS_IDLE to be set to a value other than
 1. */
 #if ( configUSE_TICKLESS_IDLE != 0 )
 
-	void vTaskStepTick( const TickType_t xTicksToJump )
+	void vTaskStepTick( TickType_t xTicksToJump )
 	{
 		/* Correct the tick count value after a period during which the tick
 		was suppressed.  Note this does *not* call the tick hook function for
 		each stepped tick. */
 		configASSERT( ( xTickCount + xTicksToJump ) <= xNextTaskUnblockTime );
+
+		if( ( xTickCount + xTicksToJump ) == xNextTaskUnblockTime )
+		{
+			/* Leave the last tick to xTaskIncrementTick(), which is called
+			for it when the scheduler is resumed, so the tasks that are due
+			are unblocked on time.  Under EDF this releases each job at its
+			release time, so its deadline and release jitter are as if the
+			tick had not been suppressed. */
+			configASSERT( uxSchedulerSuspended );
+			configASSERT( xTicksToJump != ( TickType_t ) 0 );
+
+			taskENTER_CRITICAL();
+			{
+				xPendedTicks++;
+			}
+			taskEXIT_CRITICAL();
+			xTicksToJump--;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
 		xTickCount += xTicksToJump;
 		traceINCREASE_TICK_COUNT( xTicksToJump );
 	}
@@ -2661,6 +6651,271 @@ implementations require configUSE_TICKLESS_IDLE to be set to a value other than
 #endif /* configUSE_TICKLESS_IDLE */
 /*----------------------------------------------------------*/
 
+#if ( configUSE_EVENT_DRIVEN_TICK == 1 )
+
+	static TickType_t prvGetTicksToNextEvent( void )
+	{
+	TickType_t xReturn;
+
+		if( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE )
+		{
+			/* Each tick is pended until the scheduler is resumed, so none can
+			be stepped over. */
+			xReturn = ( TickType_t ) 1;
+		}
+		else
+		{
+			/* xNextTaskUnblockTime is never beyond the tick at which the tick
+			count wraps, so the delayed lists are always switched by
+			xTaskIncrementTick(). */
+			xReturn = xNextTaskUnblockTime - xTickCount;
+
+			#if ( configUSE_EDF_SCHEDULER == 1 )
+			{
+				#if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
+				{
+					/* As the time slicing in xTaskIncrementTick().  A task
+					made ready without a context switch only starts sharing the
+					processor at the next event. */
+					if( ( listIS_CONTAINED_WITHIN( &xBackgroundTasksListEDF, &( pxCurrentTCB->xStateListItem ) ) != pdFALSE ) &&
+						( listCURRENT_LIST_LENGTH( &xBackgroundTasksListEDF ) > ( UBaseType_t ) 1 ) )
+					{
+						xReturn = ( TickType_t ) 1;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					#if ( configUSE_EDF_HYBRID_SCHEDULING == 1 )
+					{
+						if( ( prvEDFIsFixedPriority( pxCurrentTCB ) != pdFALSE ) &&
+							( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 ) )
+						{
+							xReturn = ( TickType_t ) 1;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					#endif /* configUSE_EDF_HYBRID_SCHEDULING */
+				}
+				#endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
+
+				#if ( configUSE_EDF_OVERRUN_HANDLING == 1 )
+				{
+				TCB_t * const pxTCB = pxCurrentTCB;
+				TickType_t xTicksToMiss;
+
+					/* As prvEDFCheckForOverrun(), the miss is found at the
+					first tick after the deadline. */
+					if( ( pxTCB->xTaskPeriod != ( TickType_t ) 0 ) &&
+						( prvEDFIsServer( pxTCB ) == pdFALSE ) &&
+						( pxTCB->ucReleasePending == pdFALSE ) &&
+						( ( pxTCB->ucJobOverruns & tskEDF_JOB_DEADLINE_MISSED ) == 0U ) &&
+						( prvEDFTaskIsReady( pxTCB ) != pdFALSE ) )
+					{
+						if( prvEDFTimeIsBefore( pxTCB->xTaskReleaseTime + pxTCB->xTaskRelativeDeadline, xTickCount ) != pdFALSE )
+						{
+							xTicksToMiss = ( TickType_t ) 1;
+						}
+						else
+						{
+							xTicksToMiss = ( TickType_t ) ( pxTCB->xTaskReleaseTime + pxTCB->xTaskRelativeDeadline + ( TickType_t ) 1 - xTickCount );
+						}
+
+						if( xTicksToMiss < xReturn )
+						{
+							xReturn = xTicksToMiss;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configUSE_EDF_OVERRUN_HANDLING */
+
+				#if ( configUSE_EDF_BANDWIDTH_SERVER == 1 )
+				{
+					/* The deadline of a running server is postponed at the
+					tick that exhausts its budget. */
+					if( ( pxCurrentTCB->ucServer != pdFALSE ) && ( pxCurrentTCB->xServerBudget < xReturn ) )
+					{
+						xReturn = pxCurrentTCB->xServerBudget;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configUSE_EDF_BANDWIDTH_SERVER */
+			}
+			#else
+			{
+				#if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
+				{
+					if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
+					{
+						xReturn = ( TickType_t ) 1;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
+			}
+			#endif /* configUSE_EDF_SCHEDULER */
+
+			/* The application can shorten the time to the next event, for
+			example to process a tick at which its tick hook has work to do,
+			as it can shorten the idle time before the tick is suppressed. */
+			configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING( xReturn );
+		}
+
+		if( xReturn == ( TickType_t ) 0 )
+		{
+			/* An event that is already due is processed at the next tick. */
+			xReturn = ( TickType_t ) 1;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	TickType_t xTaskGetTicksToNextEvent( void )
+	{
+	TickType_t xReturn = prvGetTicksToNextEvent();
+
+		#if ( ( configUSE_EDF_OVERRUN_HANDLING == 1 ) && ( configGENERATE_RUN_TIME_STATS == 1 ) )
+		{
+		TCB_t * const pxTCB = pxCurrentTCB;
+		uint32_t ulExecuted, ulBudget, ulTicksToExhaust;
+
+			/* As prvEDFBudgetIsExhausted(), assuming the job keeps running.
+			If it is switched out first the next event is recalculated when
+			it is switched back in. */
+			if( ( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE ) &&
+				( pxTCB->xTaskPeriod != ( TickType_t ) 0 ) &&
+				( pxTCB->xTaskWCET != ( TickType_t ) 0 ) &&
+				( prvEDFIsServer( pxTCB ) == pdFALSE ) &&
+				( pxTCB->ucReleasePending == pdFALSE ) &&
+				( ( pxTCB->ucJobOverruns & tskEDF_JOB_BUDGET_EXHAUSTED ) == 0U ) &&
+				( prvEDFTaskIsReady( pxTCB ) != pdFALSE ) )
+			{
+				ulExecuted = prvEDFGetRunTime( pxTCB ) - pxTCB->ulJobStartRunTime;
+				ulBudget = ( uint32_t ) pxTCB->xTaskWCET * ( uint32_t ) configEDF_RUN_TIME_COUNTS_PER_TICK;
+
+				if( ulExecuted > ulBudget )
+				{
+					ulTicksToExhaust = 1UL;
+				}
+				else
+				{
+					ulTicksToExhaust = ( ( ulBudget - ulExecuted ) / ( uint32_t ) configEDF_RUN_TIME_COUNTS_PER_TICK ) + 1UL;
+				}
+
+				if( ulTicksToExhaust < ( uint32_t ) xReturn )
+				{
+					xReturn = ( TickType_t ) ulTicksToExhaust;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* ( ( configUSE_EDF_OVERRUN_HANDLING == 1 ) && ( configGENERATE_RUN_TIME_STATS == 1 ) ) */
+
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	BaseType_t xTaskAdvanceTicks( TickType_t xTicks )
+	{
+	TickType_t xTicksToSkip;
+	BaseType_t xSwitchRequired = pdFALSE;
+
+		/* Called by the port with interrupts masked.  The budget of the
+		running job is left out of the ticks to skip as the run time counter
+		already includes all of xTicks, so an exhausted budget is found at the
+		last tick, as it would be at each tick interrupt. */
+		while( xTicks > ( TickType_t ) 0 )
+		{
+			xTicksToSkip = prvGetTicksToNextEvent() - ( TickType_t ) 1;
+
+			if( xTicksToSkip >= xTicks )
+			{
+				xTicksToSkip = xTicks - ( TickType_t ) 1;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Nothing is due at the ticks before the next event, so the tick
+			count is stepped over them.  Note this does *not* call the tick
+			hook function for the stepped ticks. */
+			if( xTicksToSkip > ( TickType_t ) 0 )
+			{
+				xTickCount += xTicksToSkip;
+				traceINCREASE_TICK_COUNT( xTicksToSkip );
+
+				#if ( configUSE_EDF_BANDWIDTH_SERVER == 1 )
+				{
+					/* As prvEDFChargeServer().  The budget cannot run out in
+					the stepped ticks. */
+					if( pxCurrentTCB->ucServer != pdFALSE )
+					{
+						pxCurrentTCB->xServerBudget -= xTicksToSkip;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configUSE_EDF_BANDWIDTH_SERVER */
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Ticks that elapse after a switch is required, because the
+			interrupt was taken late, are processed before the switch, as
+			ticks pended while the scheduler is suspended are. */
+			if( xTaskIncrementTick() != pdFALSE )
+			{
+				xSwitchRequired = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			xTicks -= ( xTicksToSkip + ( TickType_t ) 1 );
+		}
+
+		return xSwitchRequired;
+	}
+
+#endif /* configUSE_EVENT_DRIVEN_TICK */
+/*----------------------------------------------------------*/
+
 BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp )
 {
 BaseType_t xYieldRequired = pdFALSE;
@@ -2699,7 +6954,7 @@ BaseType_t xYieldRequired = pdFALSE;
 				/* Remove the reference to the task from the blocked list.  An
 				interrupt won't touch the xStateListItem because the
 				scheduler is suspended. */
-				( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+				( void ) prvRemoveTaskFromStateList( pxTCB );
 
 				/* Is the task waiting on an event also?  If so remove it from
 				the event list too.  Interrupts can touch the event list item,
@@ -2724,6 +6979,11 @@ BaseType_t xYieldRequired = pdFALSE;
 				taskEXIT_CRITICAL();
 
 				/* Place the unblocked task into the appropriate ready list. */
+				#if ( configUSE_EDF_SCHEDULER == 1 )
+				{
+					prvEDFSetDeadline( pxTCB );
+				}
+				#endif
 				prvAddTaskToReadyList( pxTCB );
 
 				/* A task being unblocked cannot cause an immediate context
@@ -2733,7 +6993,7 @@ BaseType_t xYieldRequired = pdFALSE;
 					/* Preemption is on, but a context switch should only be
 					performed if the unblocked task has a priority that is
 					equal to or higher than the currently executing task. */
-					if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+					if( prvTaskPreempts( pxTCB ) != pdFALSE )
 					{
 						/* Pend the yield to be performed when the scheduler
 						is unsuspended. */
@@ -2832,7 +7092,7 @@ BaseType_t xSwitchRequired = pdFALSE;
 					}
 
 					/* It is time to remove the item from the Blocked state. */
-					( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+					( void ) prvRemoveTaskFromStateList( pxTCB );
 
 					/* Is the task waiting on an event also?  If so remove
 					it from the event list. */
@@ -2846,9 +7106,9 @@ BaseType_t xSwitchRequired = pdFALSE;
 					}
 					
 					#if ( configUSE_EDF_SCHEDULER == 1 )
-          listSET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem  ), ( pxTCB)->xTaskPeriod + xTickCount);
-					
-					//listSET_LIST_ITEM_VALUE( &( ( xIdleTaskHandle )->xStateListItem  ), ( xIdleTaskHandle)->xTaskPeriod + xTickCount);
+					{
+						prvEDFSetDeadline( pxTCB );
+					}
 					#endif
 					
 					/* Place the unblocked task into the appropriate ready
@@ -2860,7 +7120,10 @@ BaseType_t xSwitchRequired = pdFALSE;
 					#if (  configUSE_PREEMPTION == 1 )
 					{
 						#if ( configUSE_EDF_SCHEDULER == 1 )
-						if( pxTCB->xTaskPeriod  <= pxCurrentTCB->xTaskPeriod)
+						/* Preemption is on, but a context switch should
+						only be performed if the released job now has the
+						earliest deadline of the ready tasks. */
+						if( prvEDFSwitchRequired() != pdFALSE )
 						{
 							xSwitchRequired = pdTRUE;
 						}
@@ -2890,19 +7153,84 @@ BaseType_t xSwitchRequired = pdFALSE;
 					
 		}
 
+		#if ( ( configUSE_EDF_OVERRUN_HANDLING == 1 ) || ( configUSE_EDF_BANDWIDTH_SERVER == 1 ) )
+		{
+			/* The overrun policy of the running task, or the exhausted budget
+			of a running server, can move it behind another ready task. */
+			#if ( configUSE_EDF_OVERRUN_HANDLING == 1 )
+			{
+				prvEDFCheckForOverrun();
+			}
+			#endif
+
+			#if ( configUSE_EDF_BANDWIDTH_SERVER == 1 )
+			{
+				prvEDFChargeServer();
+			}
+			#endif
+
+			#if ( configUSE_PREEMPTION == 1 )
+			{
+				if( prvEDFSwitchRequired() != pdFALSE )
+				{
+					xSwitchRequired = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configUSE_PREEMPTION */
+		}
+		#endif /* configUSE_EDF_OVERRUN_HANDLING || configUSE_EDF_BANDWIDTH_SERVER */
+
 		/* Tasks of equal priority to the currently running task will share
 		processing time (time slice) if preemption is on, and the application
 		writer has not explicitly turned time slicing off. */
 		#if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
 		{
-			if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
+			#if ( configUSE_EDF_SCHEDULER == 1 )
 			{
-				xSwitchRequired = pdTRUE;
+				/* Under EDF only the background tasks are time sliced, as
+				the tasks with deadlines run in deadline order. */
+				if( ( listIS_CONTAINED_WITHIN( &xBackgroundTasksListEDF, &( pxCurrentTCB->xStateListItem ) ) != pdFALSE ) &&
+					( listCURRENT_LIST_LENGTH( &xBackgroundTasksListEDF ) > ( UBaseType_t ) 1 ) )
+				{
+					xSwitchRequired = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				#if ( configUSE_EDF_HYBRID_SCHEDULING == 1 )
+				{
+					/* The tasks of the fixed priority band are time sliced as
+					without EDF. */
+					if( ( prvEDFIsFixedPriority( pxCurrentTCB ) != pdFALSE ) &&
+						( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 ) )
+					{
+						xSwitchRequired = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configUSE_EDF_HYBRID_SCHEDULING */
 			}
-			else
+			#else
 			{
-				mtCOVERAGE_TEST_MARKER();
+				if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
+				{
+					xSwitchRequired = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
+			#endif /* configUSE_EDF_SCHEDULER */
 		}
 		#endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
 
@@ -3099,6 +7427,12 @@ void vTaskSwitchContext( void )
 				mtCOVERAGE_TEST_MARKER();
 			}
 			ulTaskSwitchedInTime = ulTotalRunTime;
+
+			#if ( configUSE_EDF_UTILISATION_MONITOR == 1 )
+			{
+				prvEDFAccountUtilisation( ulTotalRunTime );
+			}
+			#endif
 		}
 		#endif /* configGENERATE_RUN_TIME_STATS */
 
@@ -3121,7 +7455,7 @@ void vTaskSwitchContext( void )
 			 }
 			 #else
 			{
-			 pxCurrentTCB = (TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( &(xReadyTasksListEDF ) );
+				prvEDFSelectTask();
 			}
 			 #endif
 		traceTASK_SWITCHED_IN();
@@ -3143,6 +7477,14 @@ void vTaskSwitchContext( void )
 			_impure_ptr = &( pxCurrentTCB->xNewLib_reent );
 		}
 		#endif /* configUSE_NEWLIB_REENTRANT */
+
+		#if ( configUSE_EVENT_DRIVEN_TICK == 1 )
+		{
+			/* The next event can depend on the task switched in, or have been
+			brought forward by the task switched out blocking. */
+			portSET_NEXT_TICK_EVENT();
+		}
+		#endif
 	}
 }
 /*-----------------------------------------------------------*/
@@ -3154,11 +7496,23 @@ void vTaskPlaceOnEventList( List_t * const pxEventList, const TickType_t xTicksT
 	/* THIS FUNCTION MUST BE CALLED WITH EITHER INTERRUPTS DISABLED OR THE
 	SCHEDULER SUSPENDED AND THE QUEUE BEING ACCESSED LOCKED. */
 
-	/* Place the event list item of the TCB in the appropriate event list.
-	This is placed in the list in priority order so the highest priority task
-	is the first to be woken by the event.  The queue that contains the event
-	list is locked, preventing simultaneous access from interrupts. */
-	vListInsert( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+	#if ( configUSE_EDF_SCHEDULER == 1 )
+	{
+		/* Place the event list item of the TCB in the event list in deadline
+		order, so the task with the earliest deadline is the first to be woken
+		by the event. */
+		prvEDFPlaceOnEventList( pxEventList );
+	}
+	#else
+	{
+		/* Place the event list item of the TCB in the appropriate event list.
+		This is placed in the list in priority order so the highest priority
+		task is the first to be woken by the event.  The queue that contains
+		the event list is locked, preventing simultaneous access from
+		interrupts. */
+		vListInsert( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+	}
+	#endif /* configUSE_EDF_SCHEDULER */
 
 	prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
 }
@@ -3177,6 +7531,12 @@ void vTaskPlaceOnUnorderedEventList( List_t * pxEventList, const TickType_t xIte
 	task that is not in the Blocked state. */
 	listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
 
+	#if ( configUSE_EDF_SCHEDULER == 1 )
+	{
+		pxCurrentTCB->ucEventListOrdered = pdFALSE;
+	}
+	#endif
+
 	/* Place the event list item of the TCB at the end of the appropriate event
 	list.  It is safe to access the event list here because it is part of an
 	event group implementation - and interrupts don't access event groups
@@ -3206,6 +7566,12 @@ void vTaskPlaceOnUnorderedEventList( List_t * pxEventList, const TickType_t xIte
 		can be used in place of vListInsert. */
 		vListInsertEnd( pxEventList, &( pxCurrentTCB->xEventListItem ) );
 
+		#if ( configUSE_EDF_SCHEDULER == 1 )
+		{
+			pxCurrentTCB->ucEventListOrdered = pdFALSE;
+		}
+		#endif
+
 		/* If the task should block indefinitely then set the block time to a
 		value that will be recognised as an indefinite delay inside the
 		prvAddCurrentTaskToDelayedList() function. */
@@ -3245,7 +7611,12 @@ BaseType_t xReturn;
 
 	if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
 	{
-		( void ) uxListRemove( &( pxUnblockedTCB->xStateListItem ) );
+		( void ) prvRemoveTaskFromStateList( pxUnblockedTCB );
+		#if ( configUSE_EDF_SCHEDULER == 1 )
+		{
+			prvEDFSetDeadline( pxUnblockedTCB );
+		}
+		#endif
 		prvAddTaskToReadyList( pxUnblockedTCB );
 
 		#if( configUSE_TICKLESS_IDLE != 0 )
@@ -3269,7 +7640,7 @@ BaseType_t xReturn;
 		vListInsertEnd( &( xPendingReadyList ), &( pxUnblockedTCB->xEventListItem ) );
 	}
 
-	if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+	if( prvTaskPreempts( pxUnblockedTCB ) != pdFALSE )
 	{
 		/* Return true if the task removed from the event list has a higher
 		priority than the calling task.  This allows the calling task to know if
@@ -3323,10 +7694,15 @@ TCB_t *pxUnblockedTCB;
 	/* Remove the task from the delayed list and add it to the ready list.  The
 	scheduler is suspended so interrupts will not be accessing the ready
 	lists. */
-	( void ) uxListRemove( &( pxUnblockedTCB->xStateListItem ) );
+	( void ) prvRemoveTaskFromStateList( pxUnblockedTCB );
+	#if ( configUSE_EDF_SCHEDULER == 1 )
+	{
+		prvEDFSetDeadline( pxUnblockedTCB );
+	}
+	#endif
 	prvAddTaskToReadyList( pxUnblockedTCB );
 
-	if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+	if( prvTaskPreempts( pxUnblockedTCB ) != pdFALSE )
 	{
 		/* The unblocked task has a priority above that of the calling task, so
 		a context switch is required.  This function is called with the
@@ -3381,6 +7757,16 @@ BaseType_t xReturn;
 			else
 		#endif
 
+		#if ( configUSE_EDF_OVERRUN_HANDLING == 1 )
+			if( prvEDFJobIsAborted( pxCurrentTCB ) != pdFALSE )
+			{
+				/* The job was aborted, so the call fails as if it had timed
+				out.  The flag is cleared by xTaskJobComplete(). */
+				xReturn = pdTRUE;
+			}
+			else
+		#endif
+
 		#if ( INCLUDE_vTaskSuspend == 1 )
 			if( *pxTicksToWait == portMAX_DELAY )
 			{
@@ -3504,37 +7890,46 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
 		}
 		#endif /* configUSE_PREEMPTION */
 
-		#if ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) )
+		#if ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) && ( configUSE_EDF_SCHEDULER == 0 ) )
 		{
-			#if ( configUSE_EDF_SCHEDULER == 0 )
-			{
-				/* When using preemption tasks of equal priority will be
-				timesliced.  If a task that is sharing the idle priority is ready
-				to run then the idle task should yield before the end of the
-				timeslice.
+			/* When using preemption tasks of equal priority will be
+			timesliced.  If a task that is sharing the idle priority is ready
+			to run then the idle task should yield before the end of the
+			timeslice.
 
-				A critical region is not required here as we are just reading from
-				the list, and an occasional incorrect value will not matter.  If
-				the ready list at the idle priority contains more than one task
-				then a task other than the idle task is ready to execute. */
-				if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( UBaseType_t ) 1 )
-				{
-					taskYIELD();
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
+			A critical region is not required here as we are just reading from
+			the list, and an occasional incorrect value will not matter.  If
+			the ready list at the idle priority contains more than one task
+			then a task other than the idle task is ready to execute. */
+			if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( UBaseType_t ) 1 )
+			{
+				taskYIELD();
 			}
-			#else
+			else
 			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) && ( configUSE_EDF_SCHEDULER == 0 ) ) */
 
-				listSET_LIST_ITEM_VALUE( &( ( xIdleTaskHandle )->xStateListItem ), ( xIdleTaskHandle )->xTaskPeriod + xTaskGetTickCount() );
+		#if ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) )
+		{
+			/* The idle task is in the background, so it only runs while no
+			task with a deadline is ready.  The other background tasks take the
+			place of the tasks sharing the idle priority, so the idle task
+			yields to them before the end of its timeslice.  With
+			configIDLE_SHOULD_YIELD set to 0 it keeps the processor until the
+			tick timeslices it, as without EDF. */
+			if( listCURRENT_LIST_LENGTH( &xBackgroundTasksListEDF ) > ( UBaseType_t ) 1 )
+			{
 				taskYIELD();
 			}
-			#endif
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
-		#endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) ) */
+		#endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) ) */
 
 		#if ( configUSE_IDLE_HOOK == 1 )
 		{
@@ -3549,6 +7944,11 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
 		}
 		#endif /* configUSE_IDLE_HOOK */
 
+		/* Allow the port to perform any processing it needs to do each time
+		the idle task runs, for example a simulator that advances time while no
+		other task is able to run. */
+		portIDLE_TASK_PROCESSING();
+
 		/* This conditional compilation should use inequality to 0, not equality
 		to 1.  This is to ensure portSUPPRESS_TICKS_AND_SLEEP() is called when
 		user defined low power mode	implementations require
@@ -3728,6 +8128,7 @@ UBaseType_t uxPriority;
 	#if ( configUSE_EDF_SCHEDULER == 1 )
  {
  vListInitialise( &xReadyTasksListEDF );
+		vListInitialise( &xBackgroundTasksListEDF );
  }
  #endif
 
@@ -3754,7 +8155,7 @@ static void prvCheckTasksWaitingTermination( void )
 			taskENTER_CRITICAL();
 			{
 				pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xTasksWaitingTermination ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-				( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+				( void ) prvRemoveTaskFromStateList( pxTCB );
 				--uxCurrentNumberOfTasks;
 				--uxDeletedTasksWaitingCleanUp;
 			}
@@ -3802,6 +8203,12 @@ static void prvCheckTasksWaitingTermination( void )
 		}
 		#endif
 
+		#if ( configUSE_EDF_TASK_STATISTICS == 1 )
+		{
+			pxTaskStatus->xJobStatistics = pxTCB->xJobStatistics;
+		}
+		#endif
+
 		/* Obtaining the task state is a little fiddly, so is only done if the
 		value of eState passed into this function is eInvalid - otherwise the
 		state is just set to whatever is passed in. */
@@ -3896,6 +8303,52 @@ static void prvCheckTasksWaitingTermination( void )
 #endif /* configUSE_TRACE_FACILITY */
 /*-----------------------------------------------------------*/
 
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) )
+
+	static UBaseType_t prvListTasksWithinEDFReadyHeap( TaskStatus_t *pxTaskStatusArray )
+	{
+	TCB_t *pxTCB = pxEDFReadyHeapRoot, *pxPreviousTCB = NULL, *pxNextTCB;
+	UBaseType_t uxTask = 0;
+
+		/* Walk the heap using the parent links, so no stack is needed.  A task
+		is reached from its parent once, then from each of its children. */
+		while( pxTCB != NULL )
+		{
+			if( pxPreviousTCB == pxTCB->pxEDFHeapParent )
+			{
+				vTaskGetInfo( ( TaskHandle_t ) pxTCB, &( pxTaskStatusArray[ uxTask ] ), pdTRUE, eReady );
+				uxTask++;
+
+				if( pxTCB->pxEDFHeapLeft != NULL )
+				{
+					pxNextTCB = pxTCB->pxEDFHeapLeft;
+				}
+				else
+				{
+					/* The heap is complete, so a task without a left child has
+					no right child either. */
+					pxNextTCB = pxTCB->pxEDFHeapParent;
+				}
+			}
+			else if( ( pxPreviousTCB == pxTCB->pxEDFHeapLeft ) && ( pxTCB->pxEDFHeapRight != NULL ) )
+			{
+				pxNextTCB = pxTCB->pxEDFHeapRight;
+			}
+			else
+			{
+				pxNextTCB = pxTCB->pxEDFHeapParent;
+			}
+
+			pxPreviousTCB = pxTCB;
+			pxTCB = pxNextTCB;
+		}
+
+		return uxTask;
+	}
+
+#endif /* ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) */
+/*-----------------------------------------------------------*/
+
 #if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
 
 	static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte )
@@ -4123,6 +8576,28 @@ TCB_t *pxTCB;
 		needed as interrupts can no longer use mutexes? */
 		if( pxMutexHolder != NULL )
 		{
+			#if ( configUSE_EDF_SCHEDULER == 1 )
+			{
+				#if ( configUSE_EDF_HYBRID_SCHEDULING == 1 )
+				if( prvEDFIsFixedPriority( pxCurrentTCB ) != pdFALSE )
+				{
+					xReturn = prvEDFInheritPriority( pxMutexHolderTCB );
+				}
+				else if( prvEDFIsFixedPriority( pxMutexHolderTCB ) != pdFALSE )
+				{
+					/* A holder in the fixed priority band already runs ahead
+					of every task with a deadline. */
+					xReturn = pdFALSE;
+				}
+				else
+				#endif /* configUSE_EDF_HYBRID_SCHEDULING */
+				{
+					/* The order of the ready tasks does not depend on their
+					priorities, so the holder inherits the deadline instead. */
+					xReturn = prvEDFInheritDeadline( pxMutexHolderTCB );
+				}
+			}
+			#else
 			/* If the holder of the mutex has a priority below the priority of
 			the task attempting to obtain the mutex then it will temporarily
 			inherit the priority of the task attempting to obtain the mutex. */
@@ -4144,7 +8619,7 @@ TCB_t *pxTCB;
 				to be moved into a new list. */
 				if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxMutexHolderTCB->uxPriority ] ), &( pxMutexHolderTCB->xStateListItem ) ) != pdFALSE )
 				{
-					if( uxListRemove( &( pxMutexHolderTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+					if( prvRemoveTaskFromStateList( pxMutexHolderTCB ) == ( UBaseType_t ) 0 )
 					{
 						/* It is known that the task is in its ready list so
 						there is no need to check again and the port level
@@ -4189,6 +8664,7 @@ TCB_t *pxTCB;
 					mtCOVERAGE_TEST_MARKER();
 				}
 			}
+			#endif /* configUSE_EDF_SCHEDULER */
 		}
 		else
 		{
@@ -4218,6 +8694,24 @@ TCB_t *pxTCB;
 			configASSERT( pxTCB->uxMutexesHeld );
 			( pxTCB->uxMutexesHeld )--;
 
+			#if ( configUSE_EDF_SCHEDULER == 1 )
+			{
+				#if ( configUSE_EDF_HYBRID_SCHEDULING == 1 )
+				{
+					xReturn = prvEDFDisinheritPriority( pxTCB );
+				}
+				#endif
+
+				if( prvEDFDisinheritDeadline( pxTCB ) != pdFALSE )
+				{
+					xReturn = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#else
 			/* Has the holder of the mutex inherited the priority of another
 			task? */
 			if( pxTCB->uxPriority != pxTCB->uxBasePriority )
@@ -4230,7 +8724,7 @@ TCB_t *pxTCB;
 					given from an interrupt, and if a mutex is given by the
 					holding task then it must be the running state task.  Remove
 					the holding task from the ready/delayed list. */
-					if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+					if( prvRemoveTaskFromStateList( pxTCB ) == ( UBaseType_t ) 0 )
 					{
 						taskRESET_READY_PRIORITY( pxTCB->uxPriority );
 					}
@@ -4269,6 +8763,7 @@ TCB_t *pxTCB;
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
+			#endif /* configUSE_EDF_SCHEDULER */
 		}
 		else
 		{
@@ -4281,7 +8776,7 @@ TCB_t *pxTCB;
 #endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_MUTEXES == 1 )
+#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_EDF_SCHEDULER == 0 ) )
 
 	void vTaskPriorityDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder, UBaseType_t uxHighestPriorityWaitingTask )
 	{
@@ -4348,7 +8843,7 @@ TCB_t *pxTCB;
 					Ready list per priority. */
 					if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
 					{
-						if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+						if( prvRemoveTaskFromStateList( pxTCB ) == ( UBaseType_t ) 0 )
 						{
 							/* It is known that the task is in its ready list so
 							there is no need to check again and the port level
@@ -4383,7 +8878,211 @@ TCB_t *pxTCB;
 		}
 	}
 
-#endif /* configUSE_MUTEXES */
+#endif /* ( configUSE_MUTEXES == 1 ) && ( configUSE_EDF_SCHEDULER == 0 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) )
+
+	void vTaskDeadlineDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder, const List_t * const pxTasksWaitingForMutex )
+	{
+	TCB_t * const pxTCB = pxMutexHolder;
+	const ListItem_t * const pxListEnd = listGET_END_MARKER( pxTasksWaitingForMutex );
+	const ListItem_t *pxWaiter;
+	TCB_t *pxWaitingTCB = NULL;
+	TickType_t xDeadline;
+	BaseType_t xInherit, xIsReady;
+	const UBaseType_t uxOnlyOneMutexHeld = ( UBaseType_t ) 1;
+
+		if( pxMutexHolder != NULL )
+		{
+			/* If pxMutexHolder is not NULL then the holder must hold at least
+			one mutex. */
+			configASSERT( pxTCB->uxMutexesHeld );
+
+			/* As vTaskPriorityDisinheritAfterTimeout(), only disinherit if no
+			other mutexes are held, as the other mutexes may have caused the
+			inheritance. */
+			if( pxTCB->uxMutexesHeld == uxOnlyOneMutexHeld )
+			{
+				/* The tasks waiting for the mutex are held in deadline order,
+				behind any of the fixed priority band, which are held in
+				priority order.  The first of the EDF band has the earliest
+				deadline of those still waiting. */
+				for( pxWaiter = listGET_HEAD_ENTRY( pxTasksWaitingForMutex ); pxWaiter != pxListEnd; pxWaiter = listGET_NEXT( pxWaiter ) )
+				{
+					pxWaitingTCB = ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxWaiter );
+
+					if( prvEDFIsFixedPriority( pxWaitingTCB ) == pdFALSE )
+					{
+						break;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+
+				#if ( configUSE_EDF_HYBRID_SCHEDULING == 1 )
+				{
+				UBaseType_t uxPriorityToUse = pxTCB->uxBasePriority;
+
+					/* The holder keeps only as much of a priority it inherited
+					from the fixed priority band as the first task of that band
+					still waiting needs. */
+					if( listCURRENT_LIST_LENGTH( pxTasksWaitingForMutex ) > 0U )
+					{
+						const TCB_t * const pxHeadTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxTasksWaitingForMutex );
+
+						if( ( prvEDFIsFixedPriority( pxHeadTCB ) != pdFALSE ) && ( pxHeadTCB->uxPriority > uxPriorityToUse ) )
+						{
+							uxPriorityToUse = pxHeadTCB->uxPriority;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					if( pxTCB->uxPriority != uxPriorityToUse )
+					{
+						/* If a task has timed out because it already holds the
+						mutex it was trying to obtain then it cannot have
+						inherited its own priority. */
+						configASSERT( pxTCB != pxCurrentTCB );
+
+						/* As prvEDFInheritPriority(), a holder that is not
+						ready is placed by its new priority when it is next
+						made ready. */
+						xIsReady = prvEDFTaskIsReady( pxTCB );
+
+						if( xIsReady != pdFALSE )
+						{
+							( void ) prvRemoveTaskFromStateList( pxTCB );
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+
+						traceTASK_PRIORITY_DISINHERIT( pxTCB, uxPriorityToUse );
+						pxTCB->uxPriority = uxPriorityToUse;
+
+						if( xIsReady != pdFALSE )
+						{
+							prvAddTaskToReadyList( pxTCB );
+						}
+						else
+						{
+							prvEDFReorderWaitingTask( pxTCB );
+						}
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configUSE_EDF_HYBRID_SCHEDULING */
+
+				if( pxTCB->ucDeadlineInherited != 0U )
+				{
+					/* The holder keeps the earliest deadline of the tasks still
+					waiting if that is earlier than its own, as when it first
+					inherited a deadline.  A waiting task in the background has
+					no deadline to pass on.  The deadline of a waiting task is
+					held in its event list item. */
+					if( ( pxWaiter != pxListEnd ) && ( pxWaitingTCB->ucBackground == pdFALSE ) )
+					{
+						xDeadline = listGET_LIST_ITEM_VALUE( &( pxWaitingTCB->xEventListItem ) );
+
+						if( ( pxTCB->ucDeadlineInherited & tskEDF_INHERITED_BACKGROUND ) != 0U )
+						{
+							xInherit = pdTRUE;
+						}
+						else
+						{
+							xInherit = prvEDFTimeIsBefore( xDeadline, prvEDFOwnDeadline( pxTCB ) );
+						}
+					}
+					else
+					{
+						xDeadline = prvEDFOwnDeadline( pxTCB );
+						xInherit = pdFALSE;
+					}
+
+					if( ( xInherit == pdFALSE ) || ( xDeadline != pxTCB->xInheritedDeadline ) )
+					{
+						configASSERT( pxTCB != pxCurrentTCB );
+
+						/* If the holder is ready its place in the ready heap
+						changes, otherwise its deadline is set when it is next
+						made ready. */
+						xIsReady = prvEDFTaskIsReady( pxTCB );
+
+						if( xIsReady != pdFALSE )
+						{
+							( void ) prvRemoveTaskFromStateList( pxTCB );
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+
+						if( xInherit != pdFALSE )
+						{
+							pxTCB->xInheritedDeadline = xDeadline;
+						}
+						else
+						{
+							/* The holder returns to the background if it was
+							there before it inherited a deadline. */
+							if( ( pxTCB->ucDeadlineInherited & tskEDF_INHERITED_BACKGROUND ) != 0U )
+							{
+								pxTCB->ucBackground = pdTRUE;
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+
+							pxTCB->ucDeadlineInherited = 0U;
+						}
+
+						if( xIsReady != pdFALSE )
+						{
+							listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), xDeadline );
+							prvAddTaskToReadyList( pxTCB );
+						}
+						else
+						{
+							prvEDFReorderWaitingTask( pxTCB );
+						}
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* ( configUSE_MUTEXES == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) */
 /*-----------------------------------------------------------*/
 
 #if ( portCRITICAL_NESTING_IN_TCB == 1 )
@@ -4746,7 +9445,7 @@ TickType_t uxReturn;
 				/* Mark this task as waiting for a notification. */
 				pxCurrentTCB->ucNotifyState = taskWAITING_NOTIFICATION;
 
-				if( xTicksToWait > ( TickType_t ) 0 )
+				if( ( xTicksToWait > ( TickType_t ) 0 ) && ( prvEDFJobIsAborted( pxCurrentTCB ) == pdFALSE ) )
 				{
 					prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
 					traceTASK_NOTIFY_TAKE_BLOCK();
@@ -4819,7 +9518,7 @@ TickType_t uxReturn;
 				/* Mark this task as waiting for a notification. */
 				pxCurrentTCB->ucNotifyState = taskWAITING_NOTIFICATION;
 
-				if( xTicksToWait > ( TickType_t ) 0 )
+				if( ( xTicksToWait > ( TickType_t ) 0 ) && ( prvEDFJobIsAborted( pxCurrentTCB ) == pdFALSE ) )
 				{
 					prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
 					traceTASK_NOTIFY_WAIT_BLOCK();
@@ -4887,6 +9586,7 @@ TickType_t uxReturn;
 	TCB_t * pxTCB;
 	BaseType_t xReturn = pdPASS;
 	uint8_t ucOriginalNotifyState;
+	BaseType_t xReleased = pdTRUE;
 
 		configASSERT( xTaskToNotify );
 		pxTCB = xTaskToNotify;
@@ -4948,8 +9648,16 @@ TickType_t uxReturn;
 			notification then unblock it now. */
 			if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
 			{
-				( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-				prvAddTaskToReadyList( pxTCB );
+				( void ) prvRemoveTaskFromStateList( pxTCB );
+				#if ( configUSE_EDF_SCHEDULER == 1 )
+				{
+					xReleased = prvEDFReleaseNotifiedTask( pxTCB );
+				}
+				#else
+				{
+					prvAddTaskToReadyList( pxTCB );
+				}
+				#endif
 
 				/* The task should not have been on an event list. */
 				configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
@@ -4970,7 +9678,7 @@ TickType_t uxReturn;
 				}
 				#endif
 
-				if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+				if( ( xReleased != pdFALSE ) && ( prvTaskPreempts( pxTCB ) != pdFALSE ) )
 				{
 					/* The notified task has a priority above the currently
 					executing task so a yield is required. */
@@ -5002,6 +9710,7 @@ TickType_t uxReturn;
 	uint8_t ucOriginalNotifyState;
 	BaseType_t xReturn = pdPASS;
 	UBaseType_t uxSavedInterruptStatus;
+	BaseType_t xReleased = pdTRUE;
 
 		configASSERT( xTaskToNotify );
 
@@ -5085,17 +9794,26 @@ TickType_t uxReturn;
 
 				if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
 				{
-					( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-					prvAddTaskToReadyList( pxTCB );
+					( void ) prvRemoveTaskFromStateList( pxTCB );
+					#if ( configUSE_EDF_SCHEDULER == 1 )
+					{
+						xReleased = prvEDFReleaseNotifiedTask( pxTCB );
+					}
+					#else
+					{
+						prvAddTaskToReadyList( pxTCB );
+					}
+					#endif
 				}
 				else
 				{
 					/* The delayed and ready lists cannot be accessed, so hold
-					this task pending until the scheduler is resumed. */
+					this task pending until the scheduler is resumed, which
+					also holds back a job that arrived too early. */
 					vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
 				}
 
-				if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+				if( ( xReleased != pdFALSE ) && ( prvTaskPreempts( pxTCB ) != pdFALSE ) )
 				{
 					/* The notified task has a priority above the currently
 					executing task so a yield is required. */
@@ -5130,6 +9848,7 @@ TickType_t uxReturn;
 	TCB_t * pxTCB;
 	uint8_t ucOriginalNotifyState;
 	UBaseType_t uxSavedInterruptStatus;
+	BaseType_t xReleased = pdTRUE;
 
 		configASSERT( xTaskToNotify );
 
@@ -5173,17 +9892,26 @@ TickType_t uxReturn;
 
 				if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
 				{
-					( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-					prvAddTaskToReadyList( pxTCB );
+					( void ) prvRemoveTaskFromStateList( pxTCB );
+					#if ( configUSE_EDF_SCHEDULER == 1 )
+					{
+						xReleased = prvEDFReleaseNotifiedTask( pxTCB );
+					}
+					#else
+					{
+						prvAddTaskToReadyList( pxTCB );
+					}
+					#endif
 				}
 				else
 				{
 					/* The delayed and ready lists cannot be accessed, so hold
-					this task pending until the scheduler is resumed. */
+					this task pending until the scheduler is resumed, which
+					also holds back a job that arrived too early. */
 					vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
 				}
 
-				if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+				if( ( xReleased != pdFALSE ) && ( prvTaskPreempts( pxTCB ) != pdFALSE ) )
 				{
 					/* The notified task has a priority above the currently
 					executing task so a yield is required. */
@@ -5276,6 +10004,27 @@ TickType_t uxReturn;
 #endif
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+	void vTaskGetReleaseJitter( TaskHandle_t xTask, TaskReleaseJitter_t *pxReleaseJitter )
+	{
+	TCB_t *pxTCB;
+
+		configASSERT( pxReleaseJitter );
+
+		taskENTER_CRITICAL();
+		{
+			/* If null is passed in here then the jitter of the calling task
+			is being queried. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+			*pxReleaseJitter = pxTCB->xReleaseJitter;
+		}
+		taskEXIT_CRITICAL();
+	}
+
+#endif /* configUSE_EDF_SCHEDULER */
+/*-----------------------------------------------------------*/
+
 static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait, const BaseType_t xCanBlockIndefinitely )
 {
 TickType_t xTimeToWake;
@@ -5292,7 +10041,7 @@ const TickType_t xConstTickCount = xTickCount;
 
 	/* Remove the task from the ready list before adding it to the blocked list
 	as the same list item is used for both lists. */
-	if( uxListRemove( &( pxCurrentTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+	if( prvRemoveTaskFromStateList( pxCurrentTCB ) == ( UBaseType_t ) 0 )
 	{
 		/* The current task must be in a ready list, so there is no need to
 		check, and the port reset macro can be called directly. */
@@ -64,6 +64,19 @@ defining trmTIMER_SERVICE_TASK_NAME in FreeRTOSConfig.h. */
 	#define configTIMER_SERVICE_TASK_NAME "Tmr Svc"
 #endif
 
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+	/* The number of slots in each level of the timing wheel, and the mask
+	that selects the slot of a time from its digit at a level.  The low ticks
+	of the times are the digits of the first level, the next
+	configTIMER_WHEEL_SLOT_BITS bits those of the second level, and so on. */
+	#define tmrWHEEL_SLOTS					( ( UBaseType_t ) 1U << configTIMER_WHEEL_SLOT_BITS )
+	#define tmrWHEEL_SLOT_MASK				( ( TickType_t ) tmrWHEEL_SLOTS - ( TickType_t ) 1U )
+	#define tmrWHEEL_SHIFT( uxLevel )		( ( UBaseType_t ) configTIMER_WHEEL_SLOT_BITS * ( uxLevel ) )
+	#define tmrWHEEL_SLOT( uxLevel, xTime )	( &( xTimerWheel[ ( uxLevel ) ][ ( ( xTime ) >> tmrWHEEL_SHIFT( uxLevel ) ) & tmrWHEEL_SLOT_MASK ] ) )
+
+#endif /* configUSE_TIMER_WHEEL */
+
 /* Bit definitions used in the ucStatus member of a timer structure. */
 #define tmrSTATUS_IS_ACTIVE					( ( uint8_t ) 0x01 )
 #define tmrSTATUS_IS_STATICALLY_ALLOCATED	( ( uint8_t ) 0x02 )
@@ -132,10 +145,27 @@ timer service task is allowed to access these lists.
 xActiveTimerList1 and xActiveTimerList2 could be at function scope but that
 breaks some kernel aware debuggers, and debuggers that reply on removing the
 static qualifier. */
-PRIVILEGED_DATA static List_t xActiveTimerList1;
-PRIVILEGED_DATA static List_t xActiveTimerList2;
-PRIVILEGED_DATA static List_t *pxCurrentTimerList;
-PRIVILEGED_DATA static List_t *pxOverflowTimerList;
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+	/* When the timing wheel is used the active timers are instead kept,
+	unsorted, in its slots.  A timer is in the slot of the highest level at
+	which the digit of its expiry time differs from that of xWheelTime, the
+	last tick the wheel has been stepped to, selected by its digit at that
+	level.  The slot is reached when the lower levels turn over, and its timers
+	are moved down to the level at which they now differ, until they reach the
+	first level and expire.  uxWheelTimers counts the timers in the wheel. */
+	PRIVILEGED_DATA static List_t xTimerWheel[ configTIMER_WHEEL_LEVELS ][ tmrWHEEL_SLOTS ];
+	PRIVILEGED_DATA static TickType_t xWheelTime = ( TickType_t ) 0U;
+	PRIVILEGED_DATA static UBaseType_t uxWheelTimers = ( UBaseType_t ) 0U;
+
+#else
+
+	PRIVILEGED_DATA static List_t xActiveTimerList1;
+	PRIVILEGED_DATA static List_t xActiveTimerList2;
+	PRIVILEGED_DATA static List_t *pxCurrentTimerList;
+	PRIVILEGED_DATA static List_t *pxOverflowTimerList;
+
+#endif /* configUSE_TIMER_WHEEL */
 
 /* A queue that is used to send commands to the timer service task. */
 PRIVILEGED_DATA static QueueHandle_t xTimerQueue = NULL;
@@ -176,21 +206,41 @@ static void prvProcessReceivedCommands( void ) PRIVILEGED_FUNCTION;
 
 /*
  * Insert the timer into either xActiveTimerList1, or xActiveTimerList2,
- * depending on if the expire time causes a timer counter overflow.
+ * depending on if the expire time causes a timer counter overflow.  With the
+ * timing wheel, insert it into its slot of the wheel instead.
  */
 static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime ) PRIVILEGED_FUNCTION;
 
 /*
  * An active timer has reached its expire time.  Reload the timer if it is an
- * auto-reload timer, then call its callback.
+ * auto-reload timer, then call its callback.  With the timing wheel, step the
+ * wheel to xTimeNow instead, processing every timer that expires on the way in
+ * the same manner.
  */
 static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
 
-/*
- * The tick count has overflowed.  Switch the timer lists after ensuring the
- * current timer list does not still reference some timers.
- */
-static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+	/*
+	 * Insert the timer, the list item value of which holds its expiry time,
+	 * into the slot of the wheel selected by that time and xWheelTime.
+	 */
+	static void prvInsertTimerInWheel( Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Remove the timer from the slot of the wheel it is in, if any.
+	 */
+	static void prvRemoveTimerFromWheel( Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+#else
+
+	/*
+	 * The tick count has overflowed.  Switch the timer lists after ensuring
+	 * the current timer list does not still reference some timers.
+	 */
+	static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TIMER_WHEEL */
 
 /*
  * Obtain the current tick count, setting *pxTimerListsWereSwitched to pdTRUE
@@ -236,6 +286,15 @@ BaseType_t xReturn = pdFAIL;
 
 	if( xTimerQueue != NULL )
 	{
+		#if( ( configUSE_EDF_SCHEDULER == 1 ) && !defined( configTIMER_TASK_BUDGET ) )
+		{
+			/* Without a budget the timer service task has no deadline, so it
+			must be in the fixed priority band, above every task scheduled by
+			EDF, to run its callbacks with a bounded latency. */
+			configASSERT( ( UBaseType_t ) configTIMER_TASK_PRIORITY > ( UBaseType_t ) configEDF_MAX_PRIORITY );
+		}
+		#endif
+
 		#if( configSUPPORT_STATIC_ALLOCATION == 1 )
 		{
 			StaticTask_t *pxTimerTaskTCBBuffer = NULL;
@@ -243,19 +302,74 @@ BaseType_t xReturn = pdFAIL;
 			uint32_t ulTimerTaskStackSize;
 
 			vApplicationGetTimerTaskMemory( &pxTimerTaskTCBBuffer, &pxTimerTaskStackBuffer, &ulTimerTaskStackSize );
-			xTimerTaskHandle = xTaskCreateStatic(	prvTimerTask,
-													configTIMER_SERVICE_TASK_NAME,
-													ulTimerTaskStackSize,
-													NULL,
-													( ( UBaseType_t ) configTIMER_TASK_PRIORITY ) | portPRIVILEGE_BIT,
-													pxTimerTaskStackBuffer,
-													pxTimerTaskTCBBuffer );
+
+			#if( ( configUSE_EDF_SCHEDULER == 1 ) && defined( configTIMER_TASK_BUDGET ) )
+			{
+				xTimerTaskHandle = xTaskServerCreateStatic(	prvTimerTask,
+															configTIMER_SERVICE_TASK_NAME,
+															ulTimerTaskStackSize,
+															NULL,
+															( ( UBaseType_t ) configTIMER_TASK_PRIORITY ) | portPRIVILEGE_BIT,
+															pxTimerTaskStackBuffer,
+															pxTimerTaskTCBBuffer,
+															configTIMER_TASK_BUDGET,
+															configTIMER_TASK_PERIOD );
+			}
+			#elif( configUSE_EDF_SCHEDULER == 1 )
+			{
+				xTimerTaskHandle = xTaskPeriodicCreateStatic(	prvTimerTask,
+																configTIMER_SERVICE_TASK_NAME,
+																ulTimerTaskStackSize,
+																NULL,
+																( ( UBaseType_t ) configTIMER_TASK_PRIORITY ) | portPRIVILEGE_BIT,
+																pxTimerTaskStackBuffer,
+																pxTimerTaskTCBBuffer,
+																NULL );
+			}
+			#else
+			{
+				xTimerTaskHandle = xTaskCreateStatic(	prvTimerTask,
+														configTIMER_SERVICE_TASK_NAME,
+														ulTimerTaskStackSize,
+														NULL,
+														( ( UBaseType_t ) configTIMER_TASK_PRIORITY ) | portPRIVILEGE_BIT,
+														pxTimerTaskStackBuffer,
+														pxTimerTaskTCBBuffer );
+			}
+			#endif /* configUSE_EDF_SCHEDULER */
 
 			if( xTimerTaskHandle != NULL )
 			{
 				xReturn = pdPASS;
 			}
 		}
+		#elif( ( configUSE_EDF_SCHEDULER == 1 ) && defined( configTIMER_TASK_BUDGET ) )
+		{
+			/* The timer service task is a constant bandwidth server, so it is
+			admitted with the periodic tasks and never takes more than its
+			bandwidth from them, however many callbacks it has to run.  The
+			admission test can refuse it, so only pdPASS is success. */
+			if( xTaskServerCreate(	prvTimerTask,
+									configTIMER_SERVICE_TASK_NAME,
+									configTIMER_TASK_STACK_DEPTH,
+									NULL,
+									( ( UBaseType_t ) configTIMER_TASK_PRIORITY ) | portPRIVILEGE_BIT,
+									&xTimerTaskHandle,
+									configTIMER_TASK_BUDGET,
+									configTIMER_TASK_PERIOD ) == pdPASS )
+			{
+				xReturn = pdPASS;
+			}
+		}
+		#elif( configUSE_EDF_SCHEDULER == 1 )
+		{
+			xReturn = xTaskBackgroundCreate(	prvTimerTask,
+												configTIMER_SERVICE_TASK_NAME,
+												configTIMER_TASK_STACK_DEPTH,
+												NULL,
+												( ( UBaseType_t ) configTIMER_TASK_PRIORITY ) | portPRIVILEGE_BIT,
+												&xTimerTaskHandle );
+		}
 		#else
 		{
 			xReturn = xTaskCreate(	prvTimerTask,
@@ -504,6 +618,83 @@ Timer_t *pxTimer = xTimer;
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow )
+{
+List_t *pxSlot;
+Timer_t *pxTimer;
+UBaseType_t uxLevel, uxTimers;
+
+	/* The wheel is stepped over every tick up to xTimeNow, not just to the
+	next expiry time. */
+	( void ) xNextExpireTime;
+
+	while( ( xWheelTime != xTimeNow ) && ( uxWheelTimers > ( UBaseType_t ) 0U ) )
+	{
+		xWheelTime++;
+
+		/* Move the timers of the slot reached in each level above a level
+		that has turned over down the wheel.  The highest level goes first so
+		a timer can move down more than one level in a tick. */
+		for( uxLevel = ( UBaseType_t ) configTIMER_WHEEL_LEVELS - 1U; uxLevel > ( UBaseType_t ) 0U; uxLevel-- )
+		{
+			if( ( xWheelTime & ( ( ( TickType_t ) 1U << tmrWHEEL_SHIFT( uxLevel ) ) - ( TickType_t ) 1U ) ) == ( TickType_t ) 0U )
+			{
+				pxSlot = tmrWHEEL_SLOT( uxLevel, xWheelTime );
+
+				/* A timer that expires a whole turn of the highest level or
+				more from now goes back into the slot it came from, so only
+				the timers that were in the slot are moved. */
+				for( uxTimers = listCURRENT_LIST_LENGTH( pxSlot ); uxTimers > ( UBaseType_t ) 0U; uxTimers-- )
+				{
+					pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxSlot ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+					prvRemoveTimerFromWheel( pxTimer );
+					prvInsertTimerInWheel( pxTimer );
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		/* Every timer in the slot of the first level expires in this tick,
+		so they are processed together. */
+		pxSlot = tmrWHEEL_SLOT( 0U, xWheelTime );
+
+		while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+		{
+			pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxSlot ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+			prvRemoveTimerFromWheel( pxTimer );
+			traceTIMER_EXPIRED( pxTimer );
+
+			/* An auto-reload timer is reloaded relative to the tick it
+			expired in, which is always earlier than its next expiry time, so
+			unlike with the lists it never has to be processed again at once.
+			If its next expiry time is no later than xTimeNow it is met again
+			as the wheel is stepped on. */
+			if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0 )
+			{
+				listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xWheelTime + pxTimer->xTimerPeriodInTicks );
+				prvInsertTimerInWheel( pxTimer );
+			}
+			else
+			{
+				pxTimer->ucStatus &= ~tmrSTATUS_IS_ACTIVE;
+			}
+
+			/* Call the timer callback. */
+			pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+		}
+	}
+
+	/* An empty wheel has nothing to step over. */
+	xWheelTime = xTimeNow;
+}
+
+#else /* configUSE_TIMER_WHEEL */
+
 static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow )
 {
 BaseType_t xResult;
@@ -543,6 +734,8 @@ Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTi
 	/* Call the timer callback. */
 	pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
 }
+
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static portTASK_FUNCTION( prvTimerTask, pvParameters )
@@ -596,8 +789,14 @@ BaseType_t xTimerListsWereSwitched;
 		xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
 		if( xTimerListsWereSwitched == pdFALSE )
 		{
-			/* The tick count has not overflowed, has the timer expired? */
-			if( ( xListWasEmpty == pdFALSE ) && ( xNextExpireTime <= xTimeNow ) )
+			/* The tick count has not overflowed, has the timer expired?  The
+			times of the wheel are compared relative to the tick it was last
+			stepped to, as it is not switched when the tick count overflows. */
+			#if ( configUSE_TIMER_WHEEL == 1 )
+				if( ( xListWasEmpty == pdFALSE ) && ( ( TickType_t ) ( xTimeNow - xWheelTime ) >= ( TickType_t ) ( xNextExpireTime - xWheelTime ) ) )
+			#else
+				if( ( xListWasEmpty == pdFALSE ) && ( xNextExpireTime <= xTimeNow ) )
+			#endif
 			{
 				( void ) xTaskResumeAll();
 				prvProcessExpiredTimer( xNextExpireTime, xTimeNow );
@@ -610,12 +809,16 @@ BaseType_t xTimerListsWereSwitched;
 				received - whichever comes first.  The following line cannot
 				be reached unless xNextExpireTime > xTimeNow, except in the
 				case when the current timer list is empty. */
-				if( xListWasEmpty != pdFALSE )
+				#if ( configUSE_TIMER_WHEEL == 0 )
 				{
-					/* The current timer list is empty - is the overflow list
-					also empty? */
-					xListWasEmpty = listLIST_IS_EMPTY( pxOverflowTimerList );
+					if( xListWasEmpty != pdFALSE )
+					{
+						/* The current timer list is empty - is the overflow
+						list also empty? */
+						xListWasEmpty = listLIST_IS_EMPTY( pxOverflowTimerList );
+					}
 				}
+				#endif /* configUSE_TIMER_WHEEL */
 
 				vQueueWaitForMessageRestricted( xTimerQueue, ( xNextExpireTime - xTimeNow ), xListWasEmpty );
 
@@ -641,6 +844,39 @@ BaseType_t xTimerListsWereSwitched;
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty )
+{
+TickType_t xNextExpireTime = xWheelTime;
+
+	/* The timers in the first level expire before it next turns over, in the
+	ticks of the slots they are in.  The timers of the higher levels are not
+	moved down the wheel until it turns over, so the next time anything is due
+	is the first of the slots of the first level that holds a timer, or the
+	tick at which it turns over.  The wheel is stepped to that tick even if no
+	timer expires then.  If the wheel is empty the task can wait for a command
+	indefinitely. */
+	*pxListWasEmpty = ( uxWheelTimers == ( UBaseType_t ) 0U ) ? pdTRUE : pdFALSE;
+
+	if( *pxListWasEmpty == pdFALSE )
+	{
+		do
+		{
+			xNextExpireTime++;
+		} while( ( ( xNextExpireTime & tmrWHEEL_SLOT_MASK ) != ( TickType_t ) 0U ) &&
+				 ( listLIST_IS_EMPTY( tmrWHEEL_SLOT( 0U, xNextExpireTime ) ) != pdFALSE ) );
+	}
+	else
+	{
+		xNextExpireTime = ( TickType_t ) 0U;
+	}
+
+	return xNextExpireTime;
+}
+
+#else /* configUSE_TIMER_WHEEL */
+
 static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty )
 {
 TickType_t xNextExpireTime;
@@ -665,8 +901,24 @@ TickType_t xNextExpireTime;
 
 	return xNextExpireTime;
 }
+
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched )
+{
+	/* The slots of the wheel are selected by the digits of the expiry times,
+	which run on through an overflow of the tick count, so there are no lists
+	to switch. */
+	*pxTimerListsWereSwitched = pdFALSE;
+
+	return xTaskGetTickCount();
+}
+
+#else /* configUSE_TIMER_WHEEL */
+
 static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched )
 {
 TickType_t xTimeNow;
@@ -688,8 +940,89 @@ PRIVILEGED_DATA static TickType_t xLastTime = ( TickType_t ) 0U; /*lint !e956 Va
 
 	return xTimeNow;
 }
+
+#endif /* configUSE_TIMER_WHEEL */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime )
+{
+BaseType_t xProcessTimerNow = pdFALSE;
+
+	listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xNextExpiryTime );
+	listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
+
+	/* Has the expiry time elapsed between the command to start/reset a timer
+	was issued, and the time the command was processed?  Both times are taken
+	relative to the command time, so an overflow of the tick count between
+	them makes no difference. */
+	if( ( ( TickType_t ) ( xTimeNow - xCommandTime ) ) >= ( ( TickType_t ) ( xNextExpiryTime - xCommandTime ) ) ) /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+	{
+		xProcessTimerNow = pdTRUE;
+	}
+	else
+	{
+		/* An empty wheel has nothing to step over, so it is moved on to now
+		rather than stepped there later. */
+		if( uxWheelTimers == ( UBaseType_t ) 0U )
+		{
+			xWheelTime = xTimeNow;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		prvInsertTimerInWheel( pxTimer );
+	}
+
+	return xProcessTimerNow;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertTimerInWheel( Timer_t * const pxTimer )
+{
+const TickType_t xDifferentDigits = listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) ) ^ xWheelTime;
+UBaseType_t uxLevel;
+
+	/* Find the highest level at which the digits differ.  Any difference
+	above the highest level is treated as being at the highest level.  A timer
+	moved down the wheel when it turns over can be due at the tick the wheel
+	is at, in which case it goes into the slot of the first level that is
+	processed next. */
+	for( uxLevel = ( UBaseType_t ) 0U; uxLevel < ( ( UBaseType_t ) configTIMER_WHEEL_LEVELS - 1U ); uxLevel++ )
+	{
+		if( ( xDifferentDigits >> tmrWHEEL_SHIFT( uxLevel + 1U ) ) == ( TickType_t ) 0U )
+		{
+			break;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	vListInsertEnd( tmrWHEEL_SLOT( uxLevel, listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) ) ), &( pxTimer->xTimerListItem ) );
+	uxWheelTimers++;
+}
 /*-----------------------------------------------------------*/
 
+static void prvRemoveTimerFromWheel( Timer_t * const pxTimer )
+{
+	if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE ) /*lint !e961. The cast is only redundant when NULL is passed into the macro. */
+	{
+		( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+		uxWheelTimers--;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+
+#else /* configUSE_TIMER_WHEEL */
+
 static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime )
 {
 BaseType_t xProcessTimerNow = pdFALSE;
@@ -729,6 +1062,8 @@ BaseType_t xProcessTimerNow = pdFALSE;
 
 	return xProcessTimerNow;
 }
+
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static void	prvProcessReceivedCommands( void )
@@ -770,15 +1105,23 @@ TickType_t xTimeNow;
 			software timer. */
 			pxTimer = xMessage.u.xTimerParameters.pxTimer;
 
-			if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE ) /*lint !e961. The cast is only redundant when NULL is passed into the macro. */
+			#if ( configUSE_TIMER_WHEEL == 1 )
 			{
-				/* The timer is in a list, remove it. */
-				( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+				prvRemoveTimerFromWheel( pxTimer );
 			}
-			else
+			#else
 			{
-				mtCOVERAGE_TEST_MARKER();
+				if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE ) /*lint !e961. The cast is only redundant when NULL is passed into the macro. */
+				{
+					/* The timer is in a list, remove it. */
+					( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
+			#endif /* configUSE_TIMER_WHEEL */
 
 			traceTIMER_COMMAND_RECEIVED( pxTimer, xMessage.xMessageID, xMessage.u.xTimerParameters.xMessageValue );
 
@@ -879,6 +1222,8 @@ TickType_t xTimeNow;
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TIMER_WHEEL == 0 )
+
 static void prvSwitchTimerLists( void )
 {
 TickType_t xNextExpireTime, xReloadTime;
@@ -936,6 +1281,8 @@ BaseType_t xResult;
 	pxCurrentTimerList = pxOverflowTimerList;
 	pxOverflowTimerList = pxTemp;
 }
+
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static void prvCheckForValidListAndQueue( void )
@@ -947,10 +1294,26 @@ static void prvCheckForValidListAndQueue( void )
 	{
 		if( xTimerQueue == NULL )
 		{
-			vListInitialise( &xActiveTimerList1 );
-			vListInitialise( &xActiveTimerList2 );
-			pxCurrentTimerList = &xActiveTimerList1;
-			pxOverflowTimerList = &xActiveTimerList2;
+			#if ( configUSE_TIMER_WHEEL == 1 )
+			{
+			UBaseType_t uxLevel, uxSlot;
+
+				for( uxLevel = ( UBaseType_t ) 0U; uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS; uxLevel++ )
+				{
+					for( uxSlot = ( UBaseType_t ) 0U; uxSlot < tmrWHEEL_SLOTS; uxSlot++ )
+					{
+						vListInitialise( &( xTimerWheel[ uxLevel ][ uxSlot ] ) );
+					}
+				}
+			}
+			#else
+			{
+				vListInitialise( &xActiveTimerList1 );
+				vListInitialise( &xActiveTimerList2 );
+				pxCurrentTimerList = &xActiveTimerList1;
+				pxOverflowTimerList = &xActiveTimerList2;
+			}
+			#endif /* configUSE_TIMER_WHEEL */
 
 			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
 			{